@@ -0,0 +1,93 @@
+//////////////////////////////////////////////////////////////////////////////////
+// Third Year Project: RISC-V RV32i Pipelined Processor
+// File: Custom Function Unit
+// Description: Example accelerator for the custom-0/custom-1 instructions. Replace this module to add
+//              application specific instructions without changing the core.
+//              Interface:
+//                  Request: Func is {custom-1, func7, func3} of the instruction, SrcA/SrcB are rs1/rs2.
+//                  The core holds Req_Valid and the request until Req_Ready is seen.
+//                  Response: Rsp_Data is written to rd. Hold Rsp_Valid and the data until Rsp_Ready,
+//                  the core only has one request outstanding so a new one won't arrive before then.
+//                  Every function select must get a response or the core will wait forever.
+//              Functions:
+//                  CRC32.W: CRC-32 (reflected 0xEDB88320) of the word in rs2 continuing from rs1, one byte per cycle.
+//                  CRC32.B: As above for the low byte of rs2 only, responds the next cycle.
+//                  CSUM: Adds both halfwords of rs2 to the 16-bit ones' complement sum in rs1 (Internet checksum).
+// Author: Luke Shepherd
+// Date Created: October 2026
+//////////////////////////////////////////////////////////////////////////////////
+
+import definitions::*;
+
+module cfu (
+    input wire CLK, RST,
+
+    // Request channel
+    input wire Req_Valid,
+    output wire Req_Ready,
+    input wire [CFU_FUNC_WIDTH-1:0] Req_Func,
+    input wire [31:0] Req_SrcA, Req_SrcB,
+
+    // Response channel
+    output logic Rsp_Valid,
+    input wire Rsp_Ready,
+    output logic [31:0] Rsp_Data
+    );
+
+    logic Busy;
+    logic [1:0] Count; // Bytes still to go after this one
+    logic [31:0] CRC, Data;
+    logic [31:0] CRC_In, CRC_Out;
+    logic [7:0] Byte_In;
+    logic [17:0] Sum;
+    logic [16:0] Fold;
+
+    assign Req_Ready = !Busy && !Rsp_Valid;
+
+    // One byte of CRC-32, bit serial in the loop but unrolled into logic
+    always_comb begin
+        CRC_In = (Busy) ? CRC : Req_SrcA;
+        Byte_In = (Busy) ? Data[7:0] : Req_SrcB[7:0];
+        CRC_Out = CRC_In ^ {24'b0, Byte_In};
+        for (int i = 0; i < 8; i++) CRC_Out = (CRC_Out[0]) ? (CRC_Out >> 1) ^ 32'hEDB8_8320 : CRC_Out >> 1;
+    end
+
+    // Ones' complement add, the carries wrap around into the bottom
+    always_comb begin
+        Sum = Req_SrcA[15:0] + Req_SrcB[15:0] + Req_SrcB[31:16];
+        Fold = Sum[15:0] + Sum[17:16];
+    end
+
+    always_ff @ (posedge CLK) begin // Synchronous reset
+        if (RST) begin
+            Busy <= 1'b0;
+            Rsp_Valid <= 1'b0;
+        end
+        else if (Busy) begin
+            CRC <= CRC_Out;
+            Data <= Data >> 8;
+            Count <= Count - 1;
+            if (Count == 2'b0) begin
+                Busy <= 1'b0;
+                Rsp_Valid <= 1'b1;
+                Rsp_Data <= CRC_Out;
+            end
+        end
+        else if (Req_Valid && Req_Ready) begin
+            case (Req_Func)
+                CFU_CRC32_W:
+                    begin
+                        CRC <= CRC_Out; // First byte is done as the request is accepted
+                        Data <= Req_SrcB >> 8;
+                        Count <= 2'd2;
+                        Busy <= 1'b1;
+                    end
+                CFU_CRC32_B: begin Rsp_Data <= CRC_Out; Rsp_Valid <= 1'b1; end
+                CFU_CSUM: begin Rsp_Data <= {16'b0, Fold[15:0] + Fold[16]}; Rsp_Valid <= 1'b1; end
+                default: begin Rsp_Data <= 32'b0; Rsp_Valid <= 1'b1; end // Unknown functions still answer so the core moves on
+            endcase
+        end
+        else if (Rsp_Valid && Rsp_Ready)
+            Rsp_Valid <= 1'b0;
+    end
+endmodule
@@ -2,8 +2,9 @@
 // Third Year Project: RISC-V RV32i Pipelined Processor
 // File: 32-bit Adder                                                  
 // Description: Generic 32-bit adder used to increment the PC and for branch target calculations.  
+//              Uses the prefix adder so the target calculation doesn't leave a ripple carry chain in execute.
 // Author: Luke Shepherd                                                     
-// Date Created: November 2024                                                                                                                                                                                                                                                       
+// Date Modified: October 2026                                                                                                                                                                                                                                                       
 //////////////////////////////////////////////////////////////////////////////////
 
 module adder32 (
@@ -12,5 +13,12 @@ module adder32 (
     output wire [31:0] OUT
     );
 
-    assign OUT = A + B;
-endmodule
\ No newline at end of file
+    prefix_adder prefix_adder (
+        .A(A),
+        .B(B),
+        .Carry_In(1'b0),
+        .Sum(OUT),
+        .Carry_Out(),
+        .Overflow()
+    );
+endmodule
@@ -3,12 +3,68 @@
 // File: Definitions                                      
 // Description: Contains parameters in order to make code more readable.
 // Author: Luke Shepherd                                                     
-// Date Modified: March 2025                                                                                                                                                                                                                                                       
+// Date Modified: October 2026                                                                                                                                                                                                                                                       
 //////////////////////////////////////////////////////////////////////////////////
 
 package definitions;
 // Generic
 parameter int CLOCK_PERIOD = 100; // 10 MHz
+parameter bit PRECOMPUTED_FORWARDING = 1'b0; // Decide forwarding in decode and register it, leaves execute with plain mux selects
+parameter bit REGISTERED_REDIRECT = 1'b0; // Register mispredictions before redirecting fetch, takes the ALU out of the PC path for one more cycle of penalty
+parameter bit BRENT_KUNG_ADDER = 1'b0; // Build the prefix adders as Brent-Kung rather than Kogge-Stone, under half the cells for 9 levels instead of 5
+
+// Memory size parameters
+parameter int MEM_ADDR_WIDTH = 12; // Bytes of memory as a power of two, 12 for 4KB up to 20 for 1MB images
+parameter int MEM_WORD_ADDR_WIDTH = MEM_ADDR_WIDTH - 2; // Words of memory as a power of two, the depth of the BRAM
+parameter string MEM_INIT_FILE = "/home/s53512ls/git/RV32i-Processor/src/test.hex";
+
+// Split (Harvard) memory parameters, replace the unified memory above with separate instruction and data memories
+parameter bit SPLIT_MEMORY = 1'b0;
+parameter int IMEM_ADDR_WIDTH = 12; // Bytes of instruction memory as a power of two
+parameter int DMEM_ADDR_WIDTH = 12; // Bytes of data memory as a power of two
+parameter string IMEM_INIT_FILE = MEM_INIT_FILE; // A unified image works in both, each side only uses its own part
+parameter string DMEM_INIT_FILE = MEM_INIT_FILE;
+parameter logic [31:0] IMEM_WINDOW_BASE = 32'h8000_0000; // Loads and stores here reach instruction memory uncached, for program loading, aligned to its size
+
+// Instruction cache parameters, every size is a power of two
+parameter int ICACHE_SIZE = 1024; // Bytes of instructions held
+parameter int ICACHE_LINE_SIZE = 16; // Bytes refilled together, at least 8
+parameter int ICACHE_WAYS = 2; // Associativity, must leave at least 2 sets
+parameter int ICACHE_SETS = ICACHE_SIZE / (ICACHE_LINE_SIZE * ICACHE_WAYS);
+parameter int ICACHE_WORDS = ICACHE_LINE_SIZE / 4;
+parameter int ICACHE_WORD_BITS = $clog2(ICACHE_WORDS);
+parameter int ICACHE_SET_BITS = $clog2(ICACHE_SETS);
+parameter int ICACHE_WAY_BITS = (ICACHE_WAYS > 1) ? $clog2(ICACHE_WAYS) : 1;
+parameter int ICACHE_TAG_BITS = 30 - ICACHE_SET_BITS - ICACHE_WORD_BITS;
+
+// Data cache parameters, every size is a power of two
+parameter int DCACHE_SIZE = 1024; // Bytes of data held
+parameter int DCACHE_LINE_SIZE = 16; // Bytes refilled and written back together, at least 8
+parameter int DCACHE_WAYS = 2; // Associativity, must leave at least 2 sets
+parameter int DCACHE_WB_DEPTH = 2; // Evicted dirty lines waiting to be written back
+parameter bit DCACHE_NONBLOCKING = 1'b1; // Load misses leave the pipeline and write back when their word arrives, independent instructions carry on
+parameter int DCACHE_MSHRS = 2; // Line misses in flight at once, 2 to 4
+parameter int DCACHE_SETS = DCACHE_SIZE / (DCACHE_LINE_SIZE * DCACHE_WAYS);
+parameter int DCACHE_WORDS = DCACHE_LINE_SIZE / 4;
+parameter int DCACHE_WORD_BITS = $clog2(DCACHE_WORDS);
+parameter int DCACHE_SET_BITS = $clog2(DCACHE_SETS);
+parameter int DCACHE_WAY_BITS = (DCACHE_WAYS > 1) ? $clog2(DCACHE_WAYS) : 1;
+parameter int DCACHE_TAG_BITS = 30 - DCACHE_SET_BITS - DCACHE_WORD_BITS;
+parameter int DCACHE_WB_BITS = (DCACHE_WB_DEPTH > 1) ? $clog2(DCACHE_WB_DEPTH) : 1;
+parameter int DCACHE_MSHR_BITS = (DCACHE_MSHRS > 1) ? $clog2(DCACHE_MSHRS) : 1;
+
+// External bus parameters
+parameter bit AXI_MEMORY = 1'b0; // Caches refill and write back over the AXI4 master ports instead of the internal BRAM, needs both caches
+parameter int AXI_MAX_WRITES = 2; // Write bursts waiting on their response, reads of those lines wait so they can't overtake
+
+// Store buffer parameters
+parameter int STORE_BUFFER_DEPTH = 4; // Stores waiting to be written, a power of two of at least 2
+parameter int STORE_BUFFER_BITS = $clog2(STORE_BUFFER_DEPTH);
+
+// Barrel core parameters
+parameter int BARREL_HARTS = 4; // Must be at least 4 so each hart has only one instruction between fetch and memory
+parameter int BARREL_HART_BITS = $clog2(BARREL_HARTS);
+parameter logic [31:0] BARREL_HART_STRIDE = 32'h400; // Each hart starts in its own 1KB block of memory
 
 // MEM_Control parameters
 parameter MEM_BYTE = 3'b000;
@@ -23,11 +79,21 @@ parameter IMM_S = 3'b001;
 parameter IMM_B = 3'b010;
 parameter IMM_U = 3'b011;
 parameter IMM_J = 3'b100;
+parameter IMM_FUSED = 3'b101; // U-Type of the first instruction plus I-Type of the second
+parameter IMM_FUSED_PC = 3'b110; // As above but relative to the PC of the second instruction (AUIPC pairs)
+parameter IMM_CFU = 3'b111; // Custom instructions have no immediate, carries the function select to the CFU instead (and the rounding mode to the FPU)
+
+// Fuse_Sel parameters
+parameter FUSE_NONE = 2'b00;
+parameter FUSE_LUI_ADDI = 2'b01; // LI: LUI rd, hi; ADDI rd, rd, lo
+parameter FUSE_AUIPC_ADDI = 2'b10; // LA: AUIPC rd, hi; ADDI rd, rd, lo
+parameter FUSE_AUIPC_JALR = 2'b11; // CALL/TAIL: AUIPC rd, hi; JALR rd, lo(rd)
 
 // Result_Src_Sel parameters
 parameter RESULT_ALU = 2'b00;
 parameter RESULT_MEM = 2'b01;
 parameter RESULT_PC4 = 2'b10;
+parameter RESULT_MUL = 2'b11; // Product from the multiplier or a result from the FPU pipeline, both ready in writeback
 
 // Branch_Src_Sel parameters;
 parameter BRANCH_PC = 1'b0;
@@ -61,21 +127,118 @@ parameter WEAKLY_TAKEN = 2'b10;
 parameter STRONGLY_TAKEN = 2'b11;
 
 // ALU Control Signals
-parameter ALU_ADD = 4'b0000; // Add SrcA and SrcB - ADD(I), L(B/H/W), S(B/H/W), AUIPC
-parameter ALU_SUB = 4'b0001; // Subtract SrcA and SrcB - SUB 
-parameter ALU_AND = 4'b0010; // Bitwise logical AND on SrcA and SrcB - AND(I) 
-parameter ALU_OR = 4'b0011; // Bitwise logical OR on SrcA and SrcB - OR(I)
-parameter ALU_XOR = 4'b0100; // Bitwise logical XOR on SrcA and SrcB - XOR(I)
-parameter ALU_SLL = 4'b0101; // Left shift by SrcB[4:0] and zero extend - SLL(I)
-parameter ALU_SRL = 4'b0110; // Right shift by SrcB[4:0] and zero extend - SRL(I)
-parameter ALU_SRA = 4'b0111; // Right shift by SrcB[4:0] and sign extend - SRA(I)
-parameter ALU_BEQ = 4'b1000; // Subtract SrcA and SrcB, set branch to 1 if equal - BEQ
-parameter ALU_BNE = 4'b1001; // Subtract SrcA and SrcB, set branch to 1 if not equal - BNE
-parameter ALU_BLT = 4'b1010; // Subtract SrcA and SrcB, set branch and result to 1 if negative - BLT, SLT
-parameter ALU_BLTU = 4'b1011; // (Unsigned) Subtract SrcA and SrcB, set branch and result to 1 if negative - BLTU, SLTU
-parameter ALU_BGE = 4'b1100; // Subtract SrcA and SrcB, set branch to 1 if not negative - BGE
-parameter ALU_BGEU = 4'b1101; // (Unsigned) Subtract SrcA and SrcB, set branch to 1 if not negative - BGEU
-parameter ALU_LUI = 4'b1110; // Writes SrcB (Immediate) as result to RD - LUI
+parameter int ALU_CONTROL_WIDTH = 7;
+parameter ALU_ADD = 7'b0000000; // Add SrcA and SrcB - ADD(I), L(B/H/W), S(B/H/W), AUIPC
+parameter ALU_SUB = 7'b0000001; // Subtract SrcA and SrcB - SUB 
+parameter ALU_AND = 7'b0000010; // Bitwise logical AND on SrcA and SrcB - AND(I) 
+parameter ALU_OR = 7'b0000011; // Bitwise logical OR on SrcA and SrcB - OR(I)
+parameter ALU_XOR = 7'b0000100; // Bitwise logical XOR on SrcA and SrcB - XOR(I)
+parameter ALU_SLL = 7'b0000101; // Left shift by SrcB[4:0] and zero extend - SLL(I)
+parameter ALU_SRL = 7'b0000110; // Right shift by SrcB[4:0] and zero extend - SRL(I)
+parameter ALU_SRA = 7'b0000111; // Right shift by SrcB[4:0] and sign extend - SRA(I)
+parameter ALU_BEQ = 7'b0001000; // Subtract SrcA and SrcB, set branch to 1 if equal - BEQ
+parameter ALU_BNE = 7'b0001001; // Subtract SrcA and SrcB, set branch to 1 if not equal - BNE
+parameter ALU_BLT = 7'b0001010; // Subtract SrcA and SrcB, set branch and result to 1 if negative - BLT, SLT
+parameter ALU_BLTU = 7'b0001011; // (Unsigned) Subtract SrcA and SrcB, set branch and result to 1 if negative - BLTU, SLTU
+parameter ALU_BGE = 7'b0001100; // Subtract SrcA and SrcB, set branch to 1 if not negative - BGE
+parameter ALU_BGEU = 7'b0001101; // (Unsigned) Subtract SrcA and SrcB, set branch to 1 if not negative - BGEU
+parameter ALU_LUI = 7'b0001110; // Writes SrcB (Immediate) as result to RD - LUI
+parameter ALU_ZIP = 7'b0001111; // Interleave the halves of SrcA, bit i to 2i and bit i+16 to 2i+1 - ZIP
+parameter ALU_MUL = 7'b0010000; // Lower 32 bits of SrcA * SrcB from the multiplier - MUL
+parameter ALU_MULH = 7'b0010001; // Upper 32 bits of signed SrcA * signed SrcB - MULH
+parameter ALU_MULHSU = 7'b0010010; // Upper 32 bits of signed SrcA * unsigned SrcB - MULHSU
+parameter ALU_MULHU = 7'b0010011; // Upper 32 bits of unsigned SrcA * unsigned SrcB - MULHU
+parameter ALU_DIV = 7'b0010100; // Signed SrcA / SrcB from the divider - DIV
+parameter ALU_DIVU = 7'b0010101; // Unsigned SrcA / SrcB - DIVU
+parameter ALU_REM = 7'b0010110; // Remainder of signed SrcA / SrcB, takes the sign of SrcA - REM
+parameter ALU_REMU = 7'b0010111; // Remainder of unsigned SrcA / SrcB - REMU
+parameter ALU_SH1ADD = 7'b0011000; // Shift SrcA left by 1 and add SrcB - SH1ADD
+parameter ALU_SH2ADD = 7'b0011001; // Shift SrcA left by 2 and add SrcB - SH2ADD
+parameter ALU_SH3ADD = 7'b0011010; // Shift SrcA left by 3 and add SrcB - SH3ADD
+parameter ALU_UNZIP = 7'b0011011; // Even bits of SrcA to the low half, odd bits to the high half - UNZIP
+parameter ALU_SHA256SIG0 = 7'b0011100; // SrcA ror 7 ^ ror 18 ^ srl 3 - SHA256SIG0
+parameter ALU_SHA256SIG1 = 7'b0011101; // SrcA ror 17 ^ ror 19 ^ srl 10 - SHA256SIG1
+parameter ALU_SHA256SUM0 = 7'b0011110; // SrcA ror 2 ^ ror 13 ^ ror 22 - SHA256SUM0
+parameter ALU_SHA256SUM1 = 7'b0011111; // SrcA ror 6 ^ ror 11 ^ ror 25 - SHA256SUM1
+parameter ALU_ANDN = 7'b0100000; // Bitwise AND of SrcA with inverted SrcB - ANDN
+parameter ALU_ORN = 7'b0100001; // Bitwise OR of SrcA with inverted SrcB - ORN
+parameter ALU_XNOR = 7'b0100010; // Inverted bitwise XOR on SrcA and SrcB - XNOR
+parameter ALU_MIN = 7'b0100011; // Smaller of signed SrcA and SrcB - MIN
+parameter ALU_MINU = 7'b0100100; // Smaller of unsigned SrcA and SrcB - MINU
+parameter ALU_MAX = 7'b0100101; // Larger of signed SrcA and SrcB - MAX
+parameter ALU_MAXU = 7'b0100110; // Larger of unsigned SrcA and SrcB - MAXU
+parameter ALU_ROL = 7'b0100111; // Rotate SrcA left by SrcB[4:0] - ROL
+parameter ALU_ROR = 7'b0101000; // Rotate SrcA right by SrcB[4:0] - ROR(I)
+parameter ALU_CLZ = 7'b0101001; // Count leading zeros of SrcA - CLZ
+parameter ALU_CTZ = 7'b0101010; // Count trailing zeros of SrcA - CTZ
+parameter ALU_CPOP = 7'b0101011; // Count set bits of SrcA - CPOP
+parameter ALU_SEXT_B = 7'b0101100; // Sign extend the low byte of SrcA - SEXT.B
+parameter ALU_SEXT_H = 7'b0101101; // Sign extend the low halfword of SrcA - SEXT.H
+parameter ALU_PACK = 7'b0101110; // Low halfword of SrcB above the low halfword of SrcA - PACK, ZEXT.H (PACK with rs2 x0)
+parameter ALU_REV8 = 7'b0101111; // Reverse the byte order of SrcA - REV8
+parameter ALU_ORC_B = 7'b0110000; // Set each byte of SrcA to all ones if any of its bits are set - ORC.B
+parameter ALU_BCLR = 7'b0110001; // Clear bit SrcB[4:0] of SrcA - BCLR(I)
+parameter ALU_BEXT = 7'b0110010; // Extract bit SrcB[4:0] of SrcA into bit 0 - BEXT(I)
+parameter ALU_BINV = 7'b0110011; // Invert bit SrcB[4:0] of SrcA - BINV(I)
+parameter ALU_BSET = 7'b0110100; // Set bit SrcB[4:0] of SrcA - BSET(I)
+parameter ALU_CZERO_EQZ = 7'b0110101; // Zero if SrcB is zero, otherwise SrcA - CZERO.EQZ
+parameter ALU_CZERO_NEZ = 7'b0110110; // Zero if SrcB is not zero, otherwise SrcA - CZERO.NEZ
+parameter ALU_CFU = 7'b0110111; // Result comes from the custom function unit - custom-0, custom-1
+parameter ALU_LP_STARTI = 7'b0111000; // Loop start is PC + immediate, handled by the hardware loop unit in fetch - LP.STARTI
+parameter ALU_LP_ENDI = 7'b0111001; // Loop end is PC + immediate - LP.ENDI
+parameter ALU_LP_COUNT = 7'b0111010; // Loop count is SrcA - LP.COUNT
+parameter ALU_LP_COUNTI = 7'b0111011; // Loop count is the zero extended immediate - LP.COUNTI
+parameter ALU_LP_SETUP = 7'b0111100; // Loop from PC + 4 to PC + immediate, count is SrcA - LP.SETUP
+parameter ALU_LP_SETUPI = 7'b0111101; // Loop from PC + 4 to PC + rs1 field words, count is the immediate - LP.SETUPI
+parameter ALU_PACKH = 7'b0111110; // Low byte of SrcB above the low byte of SrcA, zero extended - PACKH
+parameter ALU_BREV8 = 7'b0111111; // Reverse the bits within each byte of SrcA - BREV8
+// Packed SIMD from the draft P-Extension, all have the top two bits as 10 so the ALU can pick the SIMD result on those alone
+parameter ALU_ADD8 = 7'b1000000; // Add each byte of SrcA and SrcB, carries stay inside the lane - ADD8
+parameter ALU_ADD16 = 7'b1000001; // Add each halfword of SrcA and SrcB - ADD16
+parameter ALU_SUB8 = 7'b1000010; // Subtract each byte of SrcB from SrcA - SUB8
+parameter ALU_SUB16 = 7'b1000011; // Subtract each halfword of SrcB from SrcA - SUB16
+parameter ALU_KADD8 = 7'b1000100; // Signed byte add clamped to -128..127 - KADD8
+parameter ALU_KADD16 = 7'b1000101; // Signed halfword add clamped to -32768..32767 - KADD16
+parameter ALU_UKADD8 = 7'b1000110; // Unsigned byte add clamped to 255 - UKADD8
+parameter ALU_UKADD16 = 7'b1000111; // Unsigned halfword add clamped to 65535 - UKADD16
+parameter ALU_CMPEQ8 = 7'b1001000; // Each byte all ones if the SrcA and SrcB bytes are equal - CMPEQ8
+parameter ALU_CMPEQ16 = 7'b1001001; // Each halfword all ones if equal - CMPEQ16
+parameter ALU_SCMPLT8 = 7'b1001010; // Each byte all ones if signed SrcA is less than SrcB - SCMPLT8
+parameter ALU_SCMPLT16 = 7'b1001011; // Each halfword all ones if signed SrcA is less than SrcB - SCMPLT16
+parameter ALU_UCMPLT8 = 7'b1001100; // Each byte all ones if unsigned SrcA is less than SrcB - UCMPLT8
+parameter ALU_UCMPLT16 = 7'b1001101; // Each halfword all ones if unsigned SrcA is less than SrcB - UCMPLT16
+parameter ALU_SMIN8 = 7'b1001110; // Smaller signed byte of each lane - SMIN8
+parameter ALU_SMIN16 = 7'b1001111; // Smaller signed halfword of each lane - SMIN16
+parameter ALU_SMAX8 = 7'b1010000; // Larger signed byte of each lane - SMAX8
+parameter ALU_SMAX16 = 7'b1010001; // Larger signed halfword of each lane - SMAX16
+parameter ALU_UMIN8 = 7'b1010010; // Smaller unsigned byte of each lane - UMIN8
+parameter ALU_UMIN16 = 7'b1010011; // Smaller unsigned halfword of each lane - UMIN16
+parameter ALU_UMAX8 = 7'b1010100; // Larger unsigned byte of each lane - UMAX8
+parameter ALU_UMAX16 = 7'b1010101; // Larger unsigned halfword of each lane - UMAX16
+parameter ALU_PKBB16 = 7'b1010110; // Bottom halfword of SrcA above bottom halfword of SrcB - PKBB16
+parameter ALU_PKBT16 = 7'b1010111; // Bottom halfword of SrcA above top halfword of SrcB - PKBT16
+parameter ALU_PKTB16 = 7'b1011000; // Top halfword of SrcA above bottom halfword of SrcB - PKTB16
+parameter ALU_PKTT16 = 7'b1011001; // Top halfword of SrcA above top halfword of SrcB - PKTT16
+parameter ALU_SWAP8 = 7'b1011010; // Swap the bytes within each halfword of SrcA - SWAP8
+// Single precision floating point on the integer registers (Zfinx), all have the top two bits set and come from the FPU
+parameter ALU_FADD = 7'b1100000; // SrcA + SrcB rounded - FADD.S
+parameter ALU_FSUB = 7'b1100001; // SrcA - SrcB rounded - FSUB.S
+parameter ALU_FMUL = 7'b1100010; // SrcA * SrcB rounded - FMUL.S
+parameter ALU_FDIV = 7'b1100011; // SrcA / SrcB from the iterative FP divider - FDIV.S
+parameter ALU_FSQRT = 7'b1100100; // Square root of SrcA from the iterative FP divider - FSQRT.S
+parameter ALU_FMIN = 7'b1100101; // Smaller of SrcA and SrcB, -0 below +0 and NaNs ignored - FMIN.S
+parameter ALU_FMAX = 7'b1100110; // Larger of SrcA and SrcB - FMAX.S
+parameter ALU_FEQ = 7'b1100111; // 1 if SrcA equals SrcB, 0 if either is NaN - FEQ.S
+parameter ALU_FLT = 7'b1101000; // 1 if SrcA is less than SrcB - FLT.S
+parameter ALU_FLE = 7'b1101001; // 1 if SrcA is less than or equal to SrcB - FLE.S
+parameter ALU_FCVT_W_S = 7'b1101010; // SrcA rounded to a signed integer, saturates - FCVT.W.S
+parameter ALU_FCVT_WU_S = 7'b1101011; // SrcA rounded to an unsigned integer, saturates - FCVT.WU.S
+parameter ALU_FCVT_S_W = 7'b1101100; // Signed integer SrcA rounded to single precision - FCVT.S.W
+parameter ALU_FCVT_S_WU = 7'b1101101; // Unsigned integer SrcA rounded to single precision - FCVT.S.WU
+parameter ALU_FSGNJ = 7'b1101110; // SrcA with the sign of SrcB - FSGNJ.S, FMV.S
+parameter ALU_FSGNJN = 7'b1101111; // SrcA with the inverted sign of SrcB - FSGNJN.S, FNEG.S
+parameter ALU_FSGNJX = 7'b1110000; // SrcA with its sign XOR the sign of SrcB - FSGNJX.S, FABS.S
+parameter ALU_FCLASS = 7'b1110001; // One hot class of SrcA - FCLASS.S
 
 // Opcode parameters
 parameter OP_LUI = 7'b0110111;
@@ -89,6 +252,11 @@ parameter OP_S_TYPE = 7'b0100011;
 parameter OP_R_TYPE = 7'b0110011; 
 parameter OP_FENCE_PAUSE = 7'b0001111;
 parameter OP_ECALL_EBREAK = 7'b1110011;
+parameter OP_P = 7'b1110111; // Packed SIMD
+parameter OP_CUSTOM_0 = 7'b0001011; // Custom function unit
+parameter OP_CUSTOM_1 = 7'b0101011;
+parameter OP_HWLOOP = 7'b1111011; // Hardware loops, custom-3
+parameter OP_FP = 7'b1010011; // Floating point on the integer registers (Zfinx)
 
 // Func3 R-Type parameters
 parameter F3_R_ADD_SUB = 3'b000;
@@ -123,11 +291,174 @@ parameter F3_B_BGE = 3'b101;
 parameter F3_B_BLTU = 3'b110;
 parameter F3_B_BGEU = 3'b111;
 
+// Func3 M-Extension parameters
+parameter F3_M_MUL = 3'b000;
+parameter F3_M_MULH = 3'b001;
+parameter F3_M_MULHSU = 3'b010;
+parameter F3_M_MULHU = 3'b011;
+parameter F3_M_DIV = 3'b100;
+parameter F3_M_DIVU = 3'b101;
+parameter F3_M_REM = 3'b110;
+parameter F3_M_REMU = 3'b111;
+
+// Func3 Zba parameters
+parameter F3_ZBA_SH1ADD = 3'b010;
+parameter F3_ZBA_SH2ADD = 3'b100;
+parameter F3_ZBA_SH3ADD = 3'b110;
+
+// Func3 Zbb parameters
+parameter F3_ZBB_MIN = 3'b100;
+parameter F3_ZBB_MINU = 3'b101;
+parameter F3_ZBB_MAX = 3'b110;
+parameter F3_ZBB_MAXU = 3'b111;
+parameter F3_ZBB_ZEXT_H = 3'b100; // Also Zbkb PACK
+
+// Func3 Zbkb parameters
+parameter F3_ZBKB_PACK = 3'b100;
+parameter F3_ZBKB_PACKH = 3'b111;
+
+// Func3 Zicond parameters
+parameter F3_ZICOND_EQZ = 3'b101;
+parameter F3_ZICOND_NEZ = 3'b111;
+
+// Func3 P-Extension parameters
+parameter F3_P_SIMD = 3'b000; // Lane-wise arithmetic, compares and SWAP8
+parameter F3_P_PACK = 3'b001; // Halfword packing
+
+// Func3 hardware loop parameters, the loop number is in the rd field
+parameter F3_LP_STARTI = 3'b000;
+parameter F3_LP_ENDI = 3'b001;
+parameter F3_LP_COUNT = 3'b010;
+parameter F3_LP_COUNTI = 3'b011;
+parameter F3_LP_SETUP = 3'b100;
+parameter F3_LP_SETUPI = 3'b101;
+
+// Func3 F-Extension parameters for operations that don't take a rounding mode
+parameter F3_F_FSGNJ = 3'b000;
+parameter F3_F_FSGNJN = 3'b001;
+parameter F3_F_FSGNJX = 3'b010;
+parameter F3_F_FMIN = 3'b000;
+parameter F3_F_FMAX = 3'b001;
+parameter F3_F_FLE = 3'b000;
+parameter F3_F_FLT = 3'b001;
+parameter F3_F_FEQ = 3'b010;
+parameter F3_F_FCLASS = 3'b001;
+
 // Func7 R-Type parameters
 parameter F7_R_ADD = 7'b0000000;
 parameter F7_R_SRL = 7'b0000000;
 parameter F7_R_MUL = 7'b0000001;
+parameter F7_R_ZBA = 7'b0010000;
+parameter F7_R_ZBB_INV = 7'b0100000; // ANDN, ORN, XNOR share SUB/SRA's func7
+parameter F7_R_ZBB_MINMAX = 7'b0000101;
+parameter F7_R_ZBB_ROTATE = 7'b0110000;
+parameter F7_R_ZBB_ZEXT = 7'b0000100; // ZEXT.H, PACK and PACKH
+parameter F7_R_ZICOND = 7'b0000111;
+
+// Func7 Zbs parameters, shared by the register and immediate forms
+parameter F7_ZBS_BCLR_BEXT = 7'b0100100;
+parameter F7_ZBS_BINV = 7'b0110100;
+parameter F7_ZBS_BSET = 7'b0010100;
 
 // Func7 I-Type parameters
 parameter F7_I_SRLI = 7'b0000000;
+parameter F7_I_ZBB_UNARY = 7'b0110000; // CLZ, CTZ, CPOP, SEXT.B, SEXT.H and RORI
+parameter F7_I_ZBB_ORC_B = 7'b0010100;
+parameter F7_I_ZBB_REV8 = 7'b0110100; // REV8 and the Zbkb BREV8
+parameter F7_I_ZBKB_ZIP = 7'b0000100; // ZIP and UNZIP
+parameter F7_I_ZKNH_SHA256 = 7'b0001000; // SHA-256 sigma and sum functions
+
+// Func7 F-Extension parameters
+parameter F7_F_FADD = 7'b0000000;
+parameter F7_F_FSUB = 7'b0000100;
+parameter F7_F_FMUL = 7'b0001000;
+parameter F7_F_FDIV = 7'b0001100;
+parameter F7_F_FSQRT = 7'b0101100;
+parameter F7_F_FSGNJ = 7'b0010000;
+parameter F7_F_FMIN_FMAX = 7'b0010100;
+parameter F7_F_FCVT_W_S = 7'b1100000; // FCVT.W.S and FCVT.WU.S
+parameter F7_F_FCMP = 7'b1010000;
+parameter F7_F_FCLASS = 7'b1110000;
+parameter F7_F_FCVT_S_W = 7'b1101000; // FCVT.S.W and FCVT.S.WU
+
+// Func7 P-Extension parameters, SIMD func3
+parameter F7_P_ADD8 = 7'b0100100;
+parameter F7_P_ADD16 = 7'b0100000;
+parameter F7_P_SUB8 = 7'b0100101;
+parameter F7_P_SUB16 = 7'b0100001;
+parameter F7_P_KADD8 = 7'b0001100;
+parameter F7_P_KADD16 = 7'b0001000;
+parameter F7_P_UKADD8 = 7'b0011100;
+parameter F7_P_UKADD16 = 7'b0011000;
+parameter F7_P_CMPEQ8 = 7'b0100111;
+parameter F7_P_CMPEQ16 = 7'b0100110;
+parameter F7_P_SCMPLT8 = 7'b0000111;
+parameter F7_P_SCMPLT16 = 7'b0000110;
+parameter F7_P_UCMPLT8 = 7'b0010111;
+parameter F7_P_UCMPLT16 = 7'b0010110;
+parameter F7_P_SMIN8 = 7'b1000100;
+parameter F7_P_SMIN16 = 7'b1000000;
+parameter F7_P_SMAX8 = 7'b1000101;
+parameter F7_P_SMAX16 = 7'b1000001;
+parameter F7_P_UMIN8 = 7'b1001100;
+parameter F7_P_UMIN16 = 7'b1001000;
+parameter F7_P_UMAX8 = 7'b1001101;
+parameter F7_P_UMAX16 = 7'b1001001;
+parameter F7_P_SWAP8 = 7'b1010110;
+
+// Func7 P-Extension parameters, pack func3, some share values with the SIMD func3
+parameter F7_P_PKBB16 = 7'b0000111;
+parameter F7_P_PKBT16 = 7'b0001111;
+parameter F7_P_PKTB16 = 7'b0010111;
+parameter F7_P_PKTT16 = 7'b0011111;
+
+// Rs2 field Zbb unary parameters
+parameter RS2_ZBB_CLZ = 5'b00000;
+parameter RS2_ZBB_CTZ = 5'b00001;
+parameter RS2_ZBB_CPOP = 5'b00010;
+parameter RS2_ZBB_SEXT_B = 5'b00100;
+parameter RS2_ZBB_SEXT_H = 5'b00101;
+parameter RS2_ZBB_ORC_B = 5'b00111;
+parameter RS2_ZBB_REV8 = 5'b11000;
+
+// Rs2 field Zbkb and Zknh unary parameters
+parameter RS2_ZBKB_BREV8 = 5'b00111;
+parameter RS2_ZBKB_ZIP = 5'b01111;
+parameter RS2_ZKNH_SHA256SUM0 = 5'b00000;
+parameter RS2_ZKNH_SHA256SUM1 = 5'b00001;
+parameter RS2_ZKNH_SHA256SIG0 = 5'b00010;
+parameter RS2_ZKNH_SHA256SIG1 = 5'b00011;
+
+// Rs2 field F-Extension unary parameters
+parameter RS2_F_W = 5'b00000; // Conversion to or from a signed word
+parameter RS2_F_WU = 5'b00001; // Conversion to or from an unsigned word
+
+// Rs2 field P-Extension unary parameters
+parameter RS2_P_SWAP8 = 5'b11000;
+
+// Custom function unit parameters
+parameter int CFU_FUNC_WIDTH = 11; // {custom-1, func7, func3} of the instruction
+parameter CFU_CRC32_W = 11'b0_0000000_000; // Example CFU: CRC-32 of the word in rs2 continuing from rs1, one byte per cycle
+parameter CFU_CRC32_B = 11'b0_0000000_001; // Example CFU: CRC-32 of the low byte of rs2 continuing from rs1
+parameter CFU_CSUM = 11'b0_0000000_010; // Example CFU: Adds both halfwords of rs2 to the 16-bit ones' complement sum in rs1
+
+// Floating point rounding modes, the rm field of the instruction
+parameter FRM_RNE = 3'b000; // Nearest, ties to even
+parameter FRM_RTZ = 3'b001; // Towards zero
+parameter FRM_RDN = 3'b010; // Down
+parameter FRM_RUP = 3'b011; // Up
+parameter FRM_RMM = 3'b100; // Nearest, ties away from zero
+parameter FRM_DYN = 3'b111; // Dynamic, there is no frm CSR so this rounds to nearest even
+
+// Floating point constants
+parameter FP_CANONICAL_NAN = 32'h7FC0_0000; // Every NaN result, the payload of an input NaN is never kept
+parameter int FP_DIV_CYCLES = 25; // Quotient or root bits from the iterative FP divider, 24 and a guard bit
+
+// FP_Kind parameters, what the FPU pipeline hands from memory to writeback
+parameter FP_ROUND_FLOAT = 2'b00; // Exponent and fraction with guard and sticky bits to round
+parameter FP_ROUND_INT = 2'b01; // Integer magnitude with guard and sticky bits to round and saturate
+parameter FP_EXACT = 2'b10; // Finished result, specials, compares and sign injection
+
+// Hardware loop parameters
+parameter int HWLOOPS = 2; // Loop 0 is the inner loop when two end on the same instruction
 endpackage
\ No newline at end of file
@@ -0,0 +1,78 @@
+//////////////////////////////////////////////////////////////////////////////////                                                           
+// Third Year Project: RISC-V RV32i Pipelined Processor
+// File: Parallel Prefix Adder
+// Description: 32-bit adder with carry in, carry out and signed overflow, built as a parallel prefix tree
+//              so the carries take log2(32) levels instead of rippling through 32 bits.
+//              Kogge-Stone: 5 levels of 129 prefix cells, every bit combines at every level.
+//              Brent-Kung: 9 levels of 57 prefix cells, an up-sweep then a down-sweep to fill the gaps.
+//              Selected by BRENT_KUNG_ADDER in definitions, the parameter lets a testbench build both.
+// Author: Luke Shepherd
+// Date Created: October 2026
+//////////////////////////////////////////////////////////////////////////////////
+
+import definitions::*;
+
+module prefix_adder #(parameter bit BRENT_KUNG = BRENT_KUNG_ADDER) (
+    input wire [31:0] A, B,
+    input wire Carry_In,
+    output wire [31:0] Sum,
+    output wire Carry_Out, Overflow
+    );
+
+    wire [31:0] Propagate = A ^ B;
+    wire [31:0] Generate = A & B;
+    logic [31:0] G, P; // Group generate/propagate from bit 0 (and the carry in) up to each bit
+
+    generate
+        if (BRENT_KUNG) begin : brent_kung
+            always_comb begin
+                G = Generate;
+                P = Propagate;
+                G[0] = Generate[0] | (Propagate[0] & Carry_In); // Carry in joins as the generate below bit 0
+                // Up-sweep, each level joins pairs of groups twice the size of the last
+                for (int l = 0; l < 5; l++) begin
+                    for (int i = (2 << l) - 1; i < 32; i += (2 << l)) begin
+                        G[i] = G[i] | (P[i] & G[i - (1 << l)]);
+                        P[i] = P[i] & P[i - (1 << l)];
+                    end
+                end
+                // Down-sweep, the bits between finished groups pick up the group below them
+                for (int l = 3; l >= 0; l--) begin
+                    for (int i = (3 << l) - 1; i < 32; i += (2 << l)) begin
+                        G[i] = G[i] | (P[i] & G[i - (1 << l)]);
+                        P[i] = P[i] & P[i - (1 << l)];
+                    end
+                end
+            end
+        end
+        else begin : kogge_stone
+            logic [31:0] G_Level [0:5], P_Level [0:5];
+
+            always_comb begin
+                G_Level[0] = Generate;
+                P_Level[0] = Propagate;
+                G_Level[0][0] = Generate[0] | (Propagate[0] & Carry_In);
+                // Each level doubles the span every bit has looked back over
+                for (int l = 0; l < 5; l++) begin
+                    for (int i = 0; i < 32; i++) begin
+                        if (i >= (1 << l)) begin
+                            G_Level[l + 1][i] = G_Level[l][i] | (P_Level[l][i] & G_Level[l][i - (1 << l)]);
+                            P_Level[l + 1][i] = P_Level[l][i] & P_Level[l][i - (1 << l)];
+                        end
+                        else begin
+                            G_Level[l + 1][i] = G_Level[l][i];
+                            P_Level[l + 1][i] = P_Level[l][i];
+                        end
+                    end
+                end
+                G = G_Level[5];
+                P = P_Level[5];
+            end
+        end
+    endgenerate
+
+    // The group generate up to a bit is the carry into the next one
+    assign Sum = Propagate ^ {G[30:0], Carry_In};
+    assign Carry_Out = G[31];
+    assign Overflow = G[31] ^ G[30]; // Carries into and out of the sign bit differ
+endmodule
@@ -8,7 +8,12 @@
 //                  Contains the registers and controls access to them.
 //              Immediate Extender:
 //                  Sign/Zero extends the immediate values to 32-bits based on type.
-// Date Modified: March 2025                                                                                                                                                                                                                                                       
+//              Fusion Detector:
+//                  Recognises LUI/AUIPC followed by a dependent ADDI/JALR so the
+//                  second instruction can use the combined constant directly.
+//              Hart Register File:
+//                  One set of registers per hart for the barrel multithreaded core.
+// Date Modified: October 2026                                                                                                                                                                                                                                                       
 //////////////////////////////////////////////////////////////////////////////////
 
 import definitions::*;
@@ -18,7 +23,10 @@ module decode (
     //     Input Signals      //
 
     // Global Control Signals //
-    input wire CLK, 
+    input wire CLK, RST,
+
+    // Hazard Control Signals //
+    input wire Stall_En, Flush_D,
     
     //  Fetch stage signals   //
     input wire [31:0] Instr_D,
@@ -36,7 +44,7 @@ module decode (
     //  Control unit signals  //
     output wire REG_W_En_D, MEM_W_En_D, Jump_En_D, Branch_En_D,
     output wire [2:0] MEM_Control_D,
-    output wire [3:0] ALU_Control_D,
+    output wire [ALU_CONTROL_WIDTH-1:0] ALU_Control_D,
     output wire Branch_Src_Sel_D,
     output wire ALU_SrcA_Sel_D, ALU_SrcB_Sel_D,
     output wire [1:0] Result_Src_Sel_D,
@@ -52,15 +60,29 @@ module decode (
     );
 
     wire [2:0] Imm_Type_Sel; 
+    wire [1:0] Fuse_Sel;
+    wire [31:0] Fuse_Instr;
 
     assign RD_D  = Instr_D[11:7];   // Destination register
     assign RS1_D = Instr_D[19:15];  // Source register 1 (For hazard unit)
     assign RS2_D = Instr_D[24:20];  // Source register 2 (For hazard unit)
     
+    fusion_detector fusion_detector (
+        .CLK(CLK),
+        .RST(RST),
+        .Stall_En(Stall_En),
+        .Flush_D(Flush_D),
+        .Instr(Instr_D),
+        .Fuse_Sel(Fuse_Sel),
+        .Fuse_Instr(Fuse_Instr)
+    );
+
     control_unit control_unit (
         .OP(Instr_D[6:0]),
         .Func3(Instr_D[14:12]),
         .Func7(Instr_D[31:25]),
+        .RS2(Instr_D[24:20]),
+        .Fuse_Sel(Fuse_Sel),
         .REG_W_En(REG_W_En_D),
         .MEM_W_En(MEM_W_En_D),
         .Jump_En(Jump_En_D),
@@ -87,22 +109,30 @@ module decode (
 
     immediate_extender imm_extender (
         .Instr(Instr_D),
+        .Fuse_Instr(Fuse_Instr),
         .Imm_Type_Sel(Imm_Type_Sel),
         .Imm_Ext(Imm_Ext_D)
     );
 endmodule
 
-module control_unit (
+module control_unit #(
+    parameter bit DIV_EN = 1'b1, // Decode DIV/DIVU/REM/REMU, a core without a divider sees them as illegal
+    parameter bit FDIV_EN = 1'b1, // Decode FDIV.S/FSQRT.S, likewise for the FP divider
+    parameter bit CFU_EN = 1'b1, // Decode custom-0/custom-1, likewise for the custom function unit
+    parameter bit HWLOOP_EN = 1'b1 // Decode the LP instructions, likewise for the hardware loop registers
+    ) (
     input wire [6:0] OP,
     input wire [2:0] Func3,
     input wire [6:0] Func7,
+    input wire [4:0] RS2, // Picks between unary operations that share a func7
+    input wire [1:0] Fuse_Sel, // Set when this instruction completes a fused pair with the previous one.
     output logic REG_W_En, MEM_W_En, Jump_En, Branch_En, 
     output logic [2:0] MEM_Control, // Determines how much memory should be loaded/stored and how it should be extended.
-    output logic [3:0] ALU_Control, // Determines what operation the ALU should perform.
+    output logic [ALU_CONTROL_WIDTH-1:0] ALU_Control, // Determines what operation the ALU should perform.
     output logic [2:0] Imm_Type_Sel, // Determines how the immediate should be handled.
     output logic Branch_Src_Sel, // Selects the input of the branch target calclulation (PC or Immediate) to allow JALR.
     output logic ALU_SrcA_Sel, ALU_SrcB_Sel, // Selects the ALU inputs between registers and PC/Immediate.
-    output logic [1:0] Result_Src_Sel // Selects the source of the result, 11 is unused.
+    output logic [1:0] Result_Src_Sel // Selects the source of the result.
     );
 
     always_comb begin
@@ -122,25 +152,203 @@ module control_unit (
         case (OP)
             OP_R_TYPE:
                 begin
-                    if (Func7 != F7_R_MUL) begin // MUL is unsupported so will be treated as a NOP that cannot alter state
+                    if (Func7 == F7_R_MUL) begin // M-Extension
+                        case (Func3)
+                            F3_M_MUL: ALU_Control = ALU_MUL;
+                            F3_M_MULH: ALU_Control = ALU_MULH;
+                            F3_M_MULHSU: ALU_Control = ALU_MULHSU;
+                            F3_M_MULHU: ALU_Control = ALU_MULHU;
+                            F3_M_DIV: ALU_Control = ALU_DIV;
+                            F3_M_DIVU: ALU_Control = ALU_DIVU;
+                            F3_M_REM: ALU_Control = ALU_REM;
+                            F3_M_REMU: ALU_Control = ALU_REMU;
+                        endcase
+                        // Divides leave REG_W_En clear, the divider writes its result back itself when it finishes
+                        if (!Func3[2]) begin // Multiplies take their result from the multiplier in writeback
+                            REG_W_En = 1;
+                            Result_Src_Sel = RESULT_MUL;
+                        end
+                    end
+                    else begin
                         // R-Type defaults
                         REG_W_En = 1; // Store result to register
                         ALU_SrcA_Sel = SRCA_REG; // Select register data
                         ALU_SrcB_Sel = SRCB_REG; // Select register data 
                         Result_Src_Sel = RESULT_ALU; // Select ALU output
-                        case (Func3)
-                            F3_R_ADD_SUB: ALU_Control = (Func7 == F7_R_ADD) ? ALU_ADD : ALU_SUB; 
-                            F3_R_SLL: ALU_Control = ALU_SLL; 
-                            F3_R_SLT: ALU_Control = ALU_BLT; // SLT uses same as BLT
-                            F3_R_SLTU: ALU_Control = ALU_BLTU; // SLTU uses same as BLTU
-                            F3_R_XOR: ALU_Control = ALU_XOR; 
-                            F3_R_SRL_SRA: ALU_Control = (Func7 == F7_R_SRL) ? ALU_SRL : ALU_SRA;
-                            F3_R_OR: ALU_Control = ALU_OR; 
-                            F3_R_AND: ALU_Control = ALU_AND; 
-                            default: ; // Just use defaults for unsupported instructions
+                        case (Func7)
+                            F7_R_ZBA: // Zba shifted adds for address generation
+                                case (Func3)
+                                    F3_ZBA_SH1ADD: ALU_Control = ALU_SH1ADD;
+                                    F3_ZBA_SH2ADD: ALU_Control = ALU_SH2ADD;
+                                    F3_ZBA_SH3ADD: ALU_Control = ALU_SH3ADD;
+                                    default: ; // Just use defaults for unsupported instructions
+                                endcase
+                            F7_R_ZBB_MINMAX: // Zbb integer minimum and maximum
+                                case (Func3)
+                                    F3_ZBB_MIN: ALU_Control = ALU_MIN;
+                                    F3_ZBB_MINU: ALU_Control = ALU_MINU;
+                                    F3_ZBB_MAX: ALU_Control = ALU_MAX;
+                                    F3_ZBB_MAXU: ALU_Control = ALU_MAXU;
+                                    default: ; // Just use defaults for unsupported instructions
+                                endcase
+                            F7_R_ZBB_ROTATE: // Zbb rotates use the shift func3 values
+                                case (Func3)
+                                    F3_R_SLL: ALU_Control = ALU_ROL;
+                                    F3_R_SRL_SRA: ALU_Control = ALU_ROR;
+                                    default: ; // Just use defaults for unsupported instructions
+                                endcase
+                            F7_R_ZBB_ZEXT: // Zbkb packing, ZEXT.H is PACK with rs2 as x0
+                                case (Func3)
+                                    F3_ZBKB_PACK: ALU_Control = ALU_PACK;
+                                    F3_ZBKB_PACKH: ALU_Control = ALU_PACKH;
+                                    default: ; // Just use defaults for unsupported instructions
+                                endcase
+                            F7_ZBS_BCLR_BEXT: // Zbs single bit operations use the shift func3 values
+                                case (Func3)
+                                    F3_R_SLL: ALU_Control = ALU_BCLR;
+                                    F3_R_SRL_SRA: ALU_Control = ALU_BEXT;
+                                    default: ; // Just use defaults for unsupported instructions
+                                endcase
+                            F7_ZBS_BINV: if (Func3 == F3_R_SLL) ALU_Control = ALU_BINV;
+                            F7_ZBS_BSET: if (Func3 == F3_R_SLL) ALU_Control = ALU_BSET;
+                            F7_R_ZICOND: // Zicond conditional zero for branchless selects
+                                case (Func3)
+                                    F3_ZICOND_EQZ: ALU_Control = ALU_CZERO_EQZ;
+                                    F3_ZICOND_NEZ: ALU_Control = ALU_CZERO_NEZ;
+                                    default: ; // Just use defaults for unsupported instructions
+                                endcase
+                            default:
+                                case (Func3)
+                                    F3_R_ADD_SUB: ALU_Control = (Func7 == F7_R_ADD) ? ALU_ADD : ALU_SUB; 
+                                    F3_R_SLL: ALU_Control = ALU_SLL; 
+                                    F3_R_SLT: ALU_Control = ALU_BLT; // SLT uses same as BLT
+                                    F3_R_SLTU: ALU_Control = ALU_BLTU; // SLTU uses same as BLTU
+                                    F3_R_XOR: ALU_Control = (Func7 == F7_R_ZBB_INV) ? ALU_XNOR : ALU_XOR; 
+                                    F3_R_SRL_SRA: ALU_Control = (Func7 == F7_R_SRL) ? ALU_SRL : ALU_SRA;
+                                    F3_R_OR: ALU_Control = (Func7 == F7_R_ZBB_INV) ? ALU_ORN : ALU_OR; 
+                                    F3_R_AND: ALU_Control = (Func7 == F7_R_ZBB_INV) ? ALU_ANDN : ALU_AND; 
+                                    default: ; // Just use defaults for unsupported instructions
+                                endcase
                         endcase
                     end
                 end
+            OP_P: // Packed SIMD, register operands like R-Type
+                begin
+                    REG_W_En = 1; // Store result to register
+                    ALU_SrcA_Sel = SRCA_REG; // Select register data
+                    ALU_SrcB_Sel = SRCB_REG; // Select register data
+                    Result_Src_Sel = RESULT_ALU; // Select ALU output
+                    case (Func3)
+                        F3_P_SIMD:
+                            case (Func7)
+                                F7_P_ADD8: ALU_Control = ALU_ADD8;
+                                F7_P_ADD16: ALU_Control = ALU_ADD16;
+                                F7_P_SUB8: ALU_Control = ALU_SUB8;
+                                F7_P_SUB16: ALU_Control = ALU_SUB16;
+                                F7_P_KADD8: ALU_Control = ALU_KADD8;
+                                F7_P_KADD16: ALU_Control = ALU_KADD16;
+                                F7_P_UKADD8: ALU_Control = ALU_UKADD8;
+                                F7_P_UKADD16: ALU_Control = ALU_UKADD16;
+                                F7_P_CMPEQ8: ALU_Control = ALU_CMPEQ8;
+                                F7_P_CMPEQ16: ALU_Control = ALU_CMPEQ16;
+                                F7_P_SCMPLT8: ALU_Control = ALU_SCMPLT8;
+                                F7_P_SCMPLT16: ALU_Control = ALU_SCMPLT16;
+                                F7_P_UCMPLT8: ALU_Control = ALU_UCMPLT8;
+                                F7_P_UCMPLT16: ALU_Control = ALU_UCMPLT16;
+                                F7_P_SMIN8: ALU_Control = ALU_SMIN8;
+                                F7_P_SMIN16: ALU_Control = ALU_SMIN16;
+                                F7_P_SMAX8: ALU_Control = ALU_SMAX8;
+                                F7_P_SMAX16: ALU_Control = ALU_SMAX16;
+                                F7_P_UMIN8: ALU_Control = ALU_UMIN8;
+                                F7_P_UMIN16: ALU_Control = ALU_UMIN16;
+                                F7_P_UMAX8: ALU_Control = ALU_UMAX8;
+                                F7_P_UMAX16: ALU_Control = ALU_UMAX16;
+                                F7_P_SWAP8: if (RS2 == RS2_P_SWAP8) ALU_Control = ALU_SWAP8; else REG_W_En = 0;
+                                default: REG_W_En = 0; // Unsupported P instruction so leave state alone
+                            endcase
+                        F3_P_PACK:
+                            case (Func7)
+                                F7_P_PKBB16: ALU_Control = ALU_PKBB16;
+                                F7_P_PKBT16: ALU_Control = ALU_PKBT16;
+                                F7_P_PKTB16: ALU_Control = ALU_PKTB16;
+                                F7_P_PKTT16: ALU_Control = ALU_PKTT16;
+                                default: REG_W_En = 0;
+                            endcase
+                        default: REG_W_En = 0;
+                    endcase
+                end
+            OP_CUSTOM_0, OP_CUSTOM_1: // Handed to the custom function unit with the fields it needs to pick an operation
+                begin
+                    REG_W_En = 1; // Store result to register
+                    ALU_Control = ALU_CFU;
+                    ALU_SrcA_Sel = SRCA_REG; // Select register data
+                    ALU_SrcB_Sel = SRCB_REG; // Select register data
+                    Imm_Type_Sel = IMM_CFU; // Function select travels to execute in place of an immediate
+                    Result_Src_Sel = RESULT_ALU; // CFU response replaces the ALU output in execute
+                end
+            OP_HWLOOP: // Loop registers are written from execute, start and end addresses come from the target adder
+                begin
+                    Branch_Src_Sel = BRANCH_PC; // PC relative
+                    Imm_Type_Sel = IMM_I; // Offset or count in the I-Type immediate
+                    case (Func3)
+                        F3_LP_STARTI: ALU_Control = ALU_LP_STARTI;
+                        F3_LP_ENDI: ALU_Control = ALU_LP_ENDI;
+                        F3_LP_COUNT: ALU_Control = ALU_LP_COUNT;
+                        F3_LP_COUNTI: ALU_Control = ALU_LP_COUNTI;
+                        F3_LP_SETUP: ALU_Control = ALU_LP_SETUP;
+                        F3_LP_SETUPI: ALU_Control = ALU_LP_SETUPI;
+                        default: ; // Just use defaults for unsupported instructions
+                    endcase
+                end
+            OP_FP: // Zfinx, operands and results use the integer registers
+                begin
+                    REG_W_En = 1; // Store result to register
+                    ALU_SrcA_Sel = SRCA_REG; // Select register data
+                    ALU_SrcB_Sel = SRCB_REG; // Select register data
+                    Imm_Type_Sel = IMM_CFU; // Rounding mode travels to execute in the low bits of the immediate
+                    Result_Src_Sel = RESULT_MUL; // FPU pipeline result arrives in writeback like a product
+                    case (Func7)
+                        F7_F_FADD: ALU_Control = ALU_FADD;
+                        F7_F_FSUB: ALU_Control = ALU_FSUB;
+                        F7_F_FMUL: ALU_Control = ALU_FMUL;
+                        F7_F_FDIV: begin ALU_Control = ALU_FDIV; REG_W_En = 0; end // FP divider writes its result back itself
+                        F7_F_FSQRT: begin REG_W_En = 0; if (RS2 == 5'b0) ALU_Control = ALU_FSQRT; end
+                        F7_F_FSGNJ:
+                            case (Func3)
+                                F3_F_FSGNJ: ALU_Control = ALU_FSGNJ;
+                                F3_F_FSGNJN: ALU_Control = ALU_FSGNJN;
+                                F3_F_FSGNJX: ALU_Control = ALU_FSGNJX;
+                                default: REG_W_En = 0;
+                            endcase
+                        F7_F_FMIN_FMAX:
+                            case (Func3)
+                                F3_F_FMIN: ALU_Control = ALU_FMIN;
+                                F3_F_FMAX: ALU_Control = ALU_FMAX;
+                                default: REG_W_En = 0;
+                            endcase
+                        F7_F_FCMP:
+                            case (Func3)
+                                F3_F_FEQ: ALU_Control = ALU_FEQ;
+                                F3_F_FLT: ALU_Control = ALU_FLT;
+                                F3_F_FLE: ALU_Control = ALU_FLE;
+                                default: REG_W_En = 0;
+                            endcase
+                        F7_F_FCVT_W_S:
+                            case (RS2)
+                                RS2_F_W: ALU_Control = ALU_FCVT_W_S;
+                                RS2_F_WU: ALU_Control = ALU_FCVT_WU_S;
+                                default: REG_W_En = 0;
+                            endcase
+                        F7_F_FCVT_S_W:
+                            case (RS2)
+                                RS2_F_W: ALU_Control = ALU_FCVT_S_W;
+                                RS2_F_WU: ALU_Control = ALU_FCVT_S_WU;
+                                default: REG_W_En = 0;
+                            endcase
+                        F7_F_FCLASS: if (Func3 == F3_F_FCLASS && RS2 == 5'b0) ALU_Control = ALU_FCLASS; else REG_W_En = 0; // Zfinx has no FMV.X.W
+                        default: REG_W_En = 0; // Unsupported F instruction so leave state alone
+                    endcase
+                end
             OP_JALR, OP_I_TYPE:
                 begin
                     // I-Type defaults
@@ -165,10 +373,33 @@ module control_unit (
                                     end
                                 default: ; // Just use defaults for unsupported instructions
                             endcase
-                        F3_I_LH_SLLI: // SLLI
+                        F3_I_LH_SLLI: // SLLI, a Zbs immediate, ZIP or a Zbb or Zknh unary operation picked by the rs2 field
                             begin
                                 Result_Src_Sel = RESULT_ALU; // SLLI uses ALU
-                                ALU_Control = ALU_SLL;
+                                case (Func7)
+                                    F7_I_ZBB_UNARY:
+                                        case (RS2)
+                                            RS2_ZBB_CLZ: ALU_Control = ALU_CLZ;
+                                            RS2_ZBB_CTZ: ALU_Control = ALU_CTZ;
+                                            RS2_ZBB_CPOP: ALU_Control = ALU_CPOP;
+                                            RS2_ZBB_SEXT_B: ALU_Control = ALU_SEXT_B;
+                                            RS2_ZBB_SEXT_H: ALU_Control = ALU_SEXT_H;
+                                            default: begin ALU_Control = ALU_SLL; REG_W_En = 1'b0; end // Reserved encoding so leave state alone
+                                        endcase
+                                    F7_I_ZKNH_SHA256: // Zknh SHA-256 functions, the rs2 field picks one
+                                        case (RS2)
+                                            RS2_ZKNH_SHA256SUM0: ALU_Control = ALU_SHA256SUM0;
+                                            RS2_ZKNH_SHA256SUM1: ALU_Control = ALU_SHA256SUM1;
+                                            RS2_ZKNH_SHA256SIG0: ALU_Control = ALU_SHA256SIG0;
+                                            RS2_ZKNH_SHA256SIG1: ALU_Control = ALU_SHA256SIG1;
+                                            default: begin ALU_Control = ALU_SLL; REG_W_En = 1'b0; end // Reserved encoding so leave state alone
+                                        endcase
+                                    F7_I_ZBKB_ZIP: if (RS2 == RS2_ZBKB_ZIP) ALU_Control = ALU_ZIP; else REG_W_En = 1'b0;
+                                    F7_ZBS_BCLR_BEXT: ALU_Control = ALU_BCLR; // Bit index comes from the immediate like SLLI
+                                    F7_ZBS_BINV: ALU_Control = ALU_BINV;
+                                    F7_ZBS_BSET: ALU_Control = ALU_BSET;
+                                    default: ALU_Control = ALU_SLL;
+                                endcase
                             end
                         F3_I_LW_SLTI: // SLTI
                             begin
@@ -181,10 +412,23 @@ module control_unit (
                                 Result_Src_Sel = RESULT_ALU; 
                                 ALU_Control = ALU_XOR;
                             end
-                        F3_I_LHU_SRLI_SRAI: // SRLI or SRAI
+                        F3_I_LHU_SRLI_SRAI: // SRLI, SRAI, the Zbb RORI, ORC.B and REV8 or the Zbkb BREV8 and UNZIP
                             begin
                                 Result_Src_Sel = RESULT_ALU; 
-                                ALU_Control = (Func7 == F7_I_SRLI) ? ALU_SRL : ALU_SRA;
+                                case (Func7)
+                                    F7_I_SRLI: ALU_Control = ALU_SRL;
+                                    F7_I_ZBB_UNARY: ALU_Control = ALU_ROR; // RORI takes its amount from the immediate like SRLI
+                                    F7_I_ZBB_ORC_B: if (RS2 == RS2_ZBB_ORC_B) ALU_Control = ALU_ORC_B; else REG_W_En = 1'b0;
+                                    F7_I_ZBB_REV8:
+                                        case (RS2)
+                                            RS2_ZBB_REV8: ALU_Control = ALU_REV8;
+                                            RS2_ZBKB_BREV8: ALU_Control = ALU_BREV8;
+                                            default: REG_W_En = 1'b0;
+                                        endcase
+                                    F7_I_ZBKB_ZIP: if (RS2 == RS2_ZBKB_ZIP) ALU_Control = ALU_UNZIP; else REG_W_En = 1'b0;
+                                    F7_ZBS_BCLR_BEXT: ALU_Control = ALU_BEXT; // BEXTI
+                                    default: ALU_Control = ALU_SRA;
+                                endcase
                             end
                         F3_I_ORI: ALU_Control = ALU_OR; // ORI
                         F3_I_ANDI: ALU_Control = ALU_AND; // ANDI
@@ -271,6 +515,38 @@ module control_unit (
                     Branch_En = 0; // Don't alter control flow
                 end
         endcase
+
+        // Fused pairs take the combined constant so they no longer depend on the first instruction's result
+        case (Fuse_Sel)
+            FUSE_LUI_ADDI: 
+                begin
+                    ALU_Control = ALU_LUI; // Result is the constant itself
+                    Imm_Type_Sel = IMM_FUSED;
+                end
+            FUSE_AUIPC_ADDI: 
+                begin
+                    ALU_SrcA_Sel = SRCA_PC; // Result is PC relative
+                    Imm_Type_Sel = IMM_FUSED_PC;
+                end
+            FUSE_AUIPC_JALR: 
+                begin
+                    Branch_Src_Sel = BRANCH_PC; // Target becomes PC relative like JAL
+                    Imm_Type_Sel = IMM_FUSED_PC;
+                end
+            default: ; // Not fused
+        endcase
+
+        // Instructions for units this core was built without are illegal, so ensure processor state is unchanged
+        if ((!DIV_EN && ALU_Control inside {ALU_DIV, ALU_DIVU, ALU_REM, ALU_REMU})
+            || (!FDIV_EN && ALU_Control inside {ALU_FDIV, ALU_FSQRT})
+            || (!CFU_EN && ALU_Control == ALU_CFU)
+            || (!HWLOOP_EN && ALU_Control inside {ALU_LP_STARTI, ALU_LP_ENDI, ALU_LP_COUNT, ALU_LP_COUNTI, ALU_LP_SETUP, ALU_LP_SETUPI})) begin
+            REG_W_En = 0; // Don't alter registers
+            MEM_W_En = 0; // Don't alter memory
+            Jump_En = 0; // Don't alter control flow
+            Branch_En = 0; // Don't alter control flow
+            ALU_Control = ALU_ADD; // Nothing in execute picks it up
+        end
     end
 endmodule
 
@@ -296,6 +572,7 @@ endmodule
 
 module immediate_extender ( 
     input wire [31:0] Instr, // Uses entire immediate range as input to cover all immediate variants
+    input wire [31:0] Fuse_Instr, // First instruction of a fused pair, supplies the upper immediate
     input wire [2:0] Imm_Type_Sel, // Output from decoder, chooses how to extend
     output logic [31:0] Imm_Ext  // The output 32-bit immediate for later use
     );
@@ -307,7 +584,63 @@ module immediate_extender (
             IMM_B: Imm_Ext = {{20{Instr[31]}}, Instr[7], Instr[30:25], Instr[11:8], 1'b0}; // Sign extend 12-bit broken up immediate using the MSB in B-Type format
             IMM_U: Imm_Ext = {Instr[31:12], 12'b0}; // Zero extend 20-bit immediate
             IMM_J: Imm_Ext = {{12{Instr[31]}}, Instr[19:12], Instr[20], Instr[30:21], 1'b0}; // Sign extend 20-bit immediate using the MSB in J-Type format
+            IMM_FUSED: Imm_Ext = {Fuse_Instr[31:12], 12'b0} + {{21{Instr[31]}}, Instr[30:20]}; // Combine U-Type and I-Type into the full constant
+            IMM_FUSED_PC: 
+                begin
+                    Imm_Ext = {Fuse_Instr[31:12], 12'b0} + {{21{Instr[31]}}, Instr[30:20]} - 32'h4; // Second instruction's PC is 4 past the AUIPC
+                    if (Instr[6:0] == OP_JALR) Imm_Ext = Imm_Ext & ~32'b1; // JALR clears the target's LSB, the PC is aligned so clearing it here is the same
+                end
+            IMM_CFU: Imm_Ext = {{(32 - CFU_FUNC_WIDTH){1'b0}}, Instr[5], Instr[31:25], Instr[14:12]}; // Opcode bit 5 tells custom-0 and custom-1 apart
             default: Imm_Ext = 32'bX; // Propagate X to highlight error (Consider replacing for synthesis)
         endcase
     end
+endmodule
+
+module fusion_detector (
+    input wire CLK, RST, Stall_En, Flush_D,
+    input wire [31:0] Instr,
+    output logic [1:0] Fuse_Sel,
+    output logic [31:0] Fuse_Instr // Previous instruction to leave decode
+    );
+
+    always_ff @ (posedge CLK) begin // Synchronous reset
+        if (RST || Flush_D)
+            Fuse_Instr <= 32'h0000_0013; // NOP cannot start a pair, also breaks pairs across a redirect
+        else if (!Stall_En)
+            Fuse_Instr <= Instr;
+    end
+
+    always_comb begin
+        Fuse_Sel = FUSE_NONE;
+        // Second instruction must read the first's result, which can't be x0
+        if (Fuse_Instr[11:7] != 5'b0 && Instr[19:15] == Fuse_Instr[11:7] && Instr[14:12] == F3_I_JALR_ADDI_LB) begin
+            if (Fuse_Instr[6:0] == OP_LUI && Instr[6:0] == OP_I_TYPE) 
+                Fuse_Sel = FUSE_LUI_ADDI;
+            else if (Fuse_Instr[6:0] == OP_AUIPC && Instr[6:0] == OP_I_TYPE)
+                Fuse_Sel = FUSE_AUIPC_ADDI;
+            else if (Fuse_Instr[6:0] == OP_AUIPC && Instr[6:0] == OP_JALR)
+                Fuse_Sel = FUSE_AUIPC_JALR;
+        end
+    end
+endmodule
+
+module hart_register_file (
+    input wire CLK, REG_W_En,
+    input wire [BARREL_HART_BITS-1:0] Hart_R, Hart_W,
+    input wire [4:0] REG_R_Addr1, REG_R_Addr2, REG_W_Addr,
+    input wire [31:0] REG_W_Data,
+    output logic [31:0] REG_R_Data1, REG_R_Data2
+    );
+
+    reg [31:0] registers [0:(BARREL_HARTS << 5) - 1]; // Indexed by {hart, register}
+
+    always_ff @ (posedge CLK) begin 
+        if (REG_W_En && REG_W_Addr != 5'b0) // Prevent write to x0
+            registers[{Hart_W, REG_W_Addr}] <= REG_W_Data;
+    end
+
+    always_comb begin // No internal forwarding, a hart's write always lands before its next read
+        REG_R_Data1 = (REG_R_Addr1 == 5'b0) ? 32'b0 : registers[{Hart_R, REG_R_Addr1}];
+        REG_R_Data2 = (REG_R_Addr2 == 5'b0) ? 32'b0 : registers[{Hart_R, REG_R_Addr2}];
+    end    
 endmodule
\ No newline at end of file
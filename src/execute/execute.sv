@@ -4,10 +4,28 @@
 // Description: Holds all Execute stage modules.
 //              ALU: 
 //                  Performs arithmetic and logical operations on two operands.
-//                  Also evaluates branch conditions.
+//                  Also evaluates branch conditions. One prefix adder does every add and subtract,
+//                  the compares, SLT and min/max all come from its carry and overflow flags.
+//                  Zbkb bit permutations and the Zknh SHA-256 functions are fixed rotates and XORs.
+//              Count Unit:
+//                  Leading/trailing zero and population counts for Zbb, built as trees
+//                  so they fit in the same cycle as the adder.
+//              Packed SIMD Unit:
+//                  Byte and halfword lane operations from the draft P-Extension. One adder split
+//                  into byte slices gives the sums, saturation, compares and min/max for every lane.
 //              Target Adder:
 //                  Calculates the target address of a branch instruction.
-// Date Modified: February 2025                                                                                                                                                                                                                                                       
+//              Multiplier:
+//                  Two stage pipelined 33x33 signed multiplier for the M-Extension,
+//                  operands are registered into memory and the product into writeback
+//                  so it maps onto an FPGA DSP block with input and output registers.
+//              CFU Port:
+//                  Valid/ready handshake to a custom function unit for custom-0/custom-1 instructions.
+//                  Execute holds until the response arrives, which then replaces the ALU output.
+//              Divider:
+//                  Iterative radix-2 divider for the M-Extension. The divisor is aligned to the
+//                  dividend's leading one so only as many cycles are spent as there are quotient bits.
+// Date Modified: October 2026                                                                                                                                                                                                                                                       
 //////////////////////////////////////////////////////////////////////////////////
 
 import definitions::*;
@@ -18,7 +36,7 @@ module execute (
 
     //  Control unit signals  //
     input wire Jump_En_E, Branch_En_E,
-    input wire [3:0] ALU_Control_E,
+    input wire [ALU_CONTROL_WIDTH-1:0] ALU_Control_E,
     input wire Branch_Src_Sel_E,
     input wire ALU_SrcA_Sel_E, ALU_SrcB_Sel_E,
 
@@ -35,6 +53,9 @@ module execute (
     input wire [1:0] FWD_SrcA, FWD_SrcB,
     input wire [31:0] ALU_Out_M, Result_W,
 
+    //  Custom function unit  //
+    input wire [31:0] CFU_Out_E,
+
     /*========================*/
     /*||||||||||||||||||||||||*/
     /*========================*/
@@ -43,15 +64,15 @@ module execute (
     output wire Branch_Taken_E,
     output wire [31:0] ALU_Out_E,
     output wire [31:0] PC_Target_E,
-    output wire [31:0] SrcB_Reg_E 
+    output wire [31:0] SrcA_Reg_E, SrcB_Reg_E // Operands after forwarding
 
     /*========================*/    
     );
 
     wire [31:0] SrcA, SrcB;
-    wire [31:0] SrcA_Reg;
     wire Branch_Out;
     wire [31:0] Branch_Src;
+    wire [31:0] ALU_Result;
 
     assign Branch_Taken_E = Jump_En_E | (Branch_En_E & Branch_Out);
 
@@ -59,21 +80,28 @@ module execute (
         .ALU_Control(ALU_Control_E),
         .SrcA(SrcA),
         .SrcB(SrcB),
-        .Result(ALU_Out_E),
+        .Result(ALU_Result),
         .Branch_Condition(Branch_Out)
     );
 
+    mux2_1 mux2_1_cfu ( // Custom instructions write back through the normal ALU result path
+        .SEL(ALU_Control_E == ALU_CFU),
+        .A(ALU_Result),
+        .B(CFU_Out_E),
+        .OUT(ALU_Out_E)
+    );
+
     mux3_1 mux3_1_fwda (
         .SEL(FWD_SrcA),
         .A(REG_R_Data1_E),
         .B(ALU_Out_M),
         .C(Result_W),
-        .OUT(SrcA_Reg)
+        .OUT(SrcA_Reg_E)
     );
 
     mux2_1 mux2_1_srca (
         .SEL(ALU_SrcA_Sel_E),
-        .A(SrcA_Reg), 
+        .A(SrcA_Reg_E), 
         .B(PC_E),
         .OUT(SrcA)
     );
@@ -96,7 +124,7 @@ module execute (
     mux2_1 mux2_1_branch (
         .SEL(Branch_Src_Sel_E),
         .A(PC_E), 
-        .B(SrcA_Reg),
+        .B(SrcA_Reg_E),
         .OUT(Branch_Src)
     );
 
@@ -108,73 +136,398 @@ module execute (
 endmodule
 
 module arithmetic_logic_unit (
-    input wire [3:0] ALU_Control,
+    input wire [ALU_CONTROL_WIDTH-1:0] ALU_Control,
     input wire [31:0] SrcA, SrcB,
     output logic [31:0] Result,
     output logic Branch_Condition
     );
+
+    wire [5:0] Zeros, Ones;
+    wire [31:0] Packed;
+    logic Sub;
+    logic [31:0] Adder_A, Adder_B, Sum;
+    wire Carry, Overflow;
+    logic Equal, Less, Less_Unsigned;
+    logic [31:0] Brev8, Zip, Unzip;
+
+    // Only the adds leave the adder in add mode, everything else that uses it compares
+    always_comb begin
+        Sub = !(ALU_Control inside {ALU_ADD, ALU_SH1ADD, ALU_SH2ADD, ALU_SH3ADD});
+        case (ALU_Control)
+            ALU_SH1ADD: Adder_A = {SrcA[30:0], 1'b0}; // Zba index scaling, shifts are just wiring into the adder
+            ALU_SH2ADD: Adder_A = {SrcA[29:0], 2'b0};
+            ALU_SH3ADD: Adder_A = {SrcA[28:0], 3'b0};
+            default: Adder_A = SrcA;
+        endcase
+        Adder_B = (Sub) ? ~SrcB : SrcB; // SrcA + ~SrcB + 1
+    end
+
+    prefix_adder prefix_adder (
+        .A(Adder_A),
+        .B(Adder_B),
+        .Carry_In(Sub),
+        .Sum(Sum),
+        .Carry_Out(Carry),
+        .Overflow(Overflow)
+    );
+
+    // Compare flags from SrcA - SrcB, equality doesn't need the carries so it's checked alongside the adder
+    always_comb begin
+        Equal = (SrcA == SrcB);
+        Less = Sum[31] ^ Overflow; // Negative unless the subtract overflowed
+        Less_Unsigned = !Carry; // A borrow out of the top bit
+    end
+
+    count_unit count_unit (
+        .SrcA(SrcA),
+        .Trailing(ALU_Control == ALU_CTZ),
+        .Zeros(Zeros),
+        .Ones(Ones)
+    );
+
+    packed_simd_unit packed_simd_unit (
+        .ALU_Control(ALU_Control),
+        .SrcA(SrcA),
+        .SrcB(SrcB),
+        .Result(Packed)
+    );
     
+    // Zbkb permutations are only wiring
+    always_comb begin
+        for (int i = 0; i < 32; i++) Brev8[i] = SrcA[(i & ~7) + 7 - (i & 7)];
+        for (int i = 0; i < 16; i++) begin
+            {Zip[2*i + 1], Zip[2*i]} = {SrcA[i + 16], SrcA[i]};
+            {Unzip[i + 16], Unzip[i]} = {SrcA[2*i + 1], SrcA[2*i]};
+        end
+    end
+
     // ALU operations
     always_comb begin
         Result = 32'b0; // Default values
         Branch_Condition = 1'b0;
         case (ALU_Control)
-            ALU_ADD: Result = SrcA + SrcB;
-            ALU_SUB: Result = SrcA - SrcB;
+            ALU_ADD, ALU_SUB, ALU_SH1ADD, ALU_SH2ADD, ALU_SH3ADD: Result = Sum;
             ALU_AND: Result = SrcA & SrcB;
             ALU_OR: Result = SrcA | SrcB;
             ALU_XOR: Result = SrcA ^ SrcB;
             ALU_SLL: Result = SrcA << SrcB;
             ALU_SRL: Result = SrcA >> SrcB;
             ALU_SRA: Result = $signed(SrcA) >>> SrcB;
-            ALU_BEQ: 
-                begin
-                    if (SrcA == SrcB) Branch_Condition = 1'b1;
-                    else Branch_Condition = 1'b0; 
-                end
-            ALU_BNE: 
-                begin
-                    if (SrcA != SrcB) Branch_Condition = 1'b1;
-                    else Branch_Condition = 1'b0;
-                end
+            ALU_BEQ: Branch_Condition = Equal;
+            ALU_BNE: Branch_Condition = !Equal;
             ALU_BLT:
                 begin
-                    if ($signed(SrcA) < $signed(SrcB)) 
-                    begin 
-                        Branch_Condition = 1'b1;
-                        Result = 32'b1; // Result for SLT
-                    end
-                    else 
-                    begin 
-                        Branch_Condition = 1'b0;
-                        Result = 32'b0; // Result for SLT
-                    end
+                    Branch_Condition = Less;
+                    Result = {31'b0, Less}; // Result for SLT
                 end
             ALU_BLTU: 
                 begin
-                    if (SrcA < SrcB) 
-                    begin  
-                        Branch_Condition = 1'b1;
-                        Result = 32'b1; // Result for SLTU
-                    end
-                    else 
-                    begin 
-                        Branch_Condition = 1'b0;
-                        Result = 32'b0; // Result for SLTU
-                    end
-                end
-            ALU_BGE: 
-                begin
-                    if ($signed(SrcA) >= $signed(SrcB)) Branch_Condition = 1'b1;
-                    else Branch_Condition = 1'b0;
-                end
-            ALU_BGEU: 
-                begin
-                    if (SrcA >= SrcB) Branch_Condition = 1'b1;
-                    else Branch_Condition = 1'b0;
+                    Branch_Condition = Less_Unsigned;
+                    Result = {31'b0, Less_Unsigned}; // Result for SLTU
                 end
+            ALU_BGE: Branch_Condition = !Less;
+            ALU_BGEU: Branch_Condition = !Less_Unsigned;
             ALU_LUI: Result = SrcB;
-            default: Result = 32'bX; // Propagate X to indicate error
+            ALU_ANDN: Result = SrcA & ~SrcB;
+            ALU_ORN: Result = SrcA | ~SrcB;
+            ALU_XNOR: Result = ~(SrcA ^ SrcB);
+            ALU_MIN: Result = (Less) ? SrcA : SrcB;
+            ALU_MINU: Result = (Less_Unsigned) ? SrcA : SrcB;
+            ALU_MAX: Result = (Less) ? SrcB : SrcA;
+            ALU_MAXU: Result = (Less_Unsigned) ? SrcB : SrcA;
+            ALU_ROL: Result = (SrcA << SrcB[4:0]) | (SrcA >> (6'd32 - SrcB[4:0])); // Shifting by 32 gives zero for a rotate of 0
+            ALU_ROR: Result = (SrcA >> SrcB[4:0]) | (SrcA << (6'd32 - SrcB[4:0]));
+            ALU_CLZ, ALU_CTZ: Result = {26'b0, Zeros};
+            ALU_CPOP: Result = {26'b0, Ones};
+            ALU_SEXT_B: Result = {{24{SrcA[7]}}, SrcA[7:0]};
+            ALU_SEXT_H: Result = {{16{SrcA[15]}}, SrcA[15:0]};
+            ALU_PACK: Result = {SrcB[15:0], SrcA[15:0]}; // ZEXT.H when rs2 is x0
+            ALU_PACKH: Result = {16'b0, SrcB[7:0], SrcA[7:0]};
+            ALU_BREV8: Result = Brev8;
+            ALU_ZIP: Result = Zip;
+            ALU_UNZIP: Result = Unzip;
+            ALU_SHA256SIG0: Result = {SrcA[6:0], SrcA[31:7]} ^ {SrcA[17:0], SrcA[31:18]} ^ (SrcA >> 3); // Rotates are wiring so each is one 3-input XOR
+            ALU_SHA256SIG1: Result = {SrcA[16:0], SrcA[31:17]} ^ {SrcA[18:0], SrcA[31:19]} ^ (SrcA >> 10);
+            ALU_SHA256SUM0: Result = {SrcA[1:0], SrcA[31:2]} ^ {SrcA[12:0], SrcA[31:13]} ^ {SrcA[21:0], SrcA[31:22]};
+            ALU_SHA256SUM1: Result = {SrcA[5:0], SrcA[31:6]} ^ {SrcA[10:0], SrcA[31:11]} ^ {SrcA[24:0], SrcA[31:25]};
+            ALU_REV8: Result = {SrcA[7:0], SrcA[15:8], SrcA[23:16], SrcA[31:24]}; // Byte reverse is only wiring
+            ALU_ORC_B: Result = {{8{|SrcA[31:24]}}, {8{|SrcA[23:16]}}, {8{|SrcA[15:8]}}, {8{|SrcA[7:0]}}};
+            ALU_BCLR: Result = SrcA & ~(32'b1 << SrcB[4:0]);
+            ALU_BEXT: Result = {31'b0, SrcA[SrcB[4:0]]};
+            ALU_BINV: Result = SrcA ^ (32'b1 << SrcB[4:0]);
+            ALU_BSET: Result = SrcA | (32'b1 << SrcB[4:0]);
+            ALU_CZERO_EQZ: Result = (SrcB == 32'b0) ? 32'b0 : SrcA;
+            ALU_CZERO_NEZ: Result = (SrcB != 32'b0) ? 32'b0 : SrcA;
+            ALU_MUL, ALU_MULH, ALU_MULHSU, ALU_MULHU: Result = 32'b0; // Produced by the multiplier
+            ALU_DIV, ALU_DIVU, ALU_REM, ALU_REMU: Result = 32'b0; // Produced by the divider
+            ALU_CFU: Result = 32'b0; // Produced by the custom function unit
+            ALU_LP_STARTI, ALU_LP_ENDI, ALU_LP_COUNT, ALU_LP_COUNTI, ALU_LP_SETUP, ALU_LP_SETUPI: Result = 32'b0; // Written to the hardware loop unit
+            default: // Packed SIMD, floating point comes from the FPU, otherwise propagate X to indicate error
+                case (ALU_Control[ALU_CONTROL_WIDTH-1 -: 2])
+                    2'b10: Result = Packed;
+                    2'b11: Result = 32'b0;
+                    default: Result = 32'bX;
+                endcase
         endcase
     end
 endmodule
+
+module count_unit (
+    input wire [31:0] SrcA,
+    input wire Trailing, // Count trailing rather than leading zeros
+    output logic [5:0] Zeros, Ones
+    );
+
+    logic [31:0] Scan;
+    logic [15:0] Half;
+    logic [7:0] Quarter;
+    logic [3:0] Eighth;
+    logic [1:0] Sixteenth;
+    logic [4:0] Empty; // Upper part at each level held no set bits
+    logic [1:0] Sum2 [0:15];
+    logic [2:0] Sum4 [0:7];
+    logic [3:0] Sum8 [0:3];
+    logic [4:0] Sum16 [0:1];
+
+    always_comb begin // Trailing zeros are the leading zeros of the reversed operand, a mux instead of a second counter
+        for (int i = 0; i < 32; i++) Scan[i] = (Trailing) ? SrcA[31 - i] : SrcA[i];
+    end
+
+    // Leading zeros by binary search, each level keeps the half holding the leading one and gives one bit of the count
+    always_comb begin
+        Empty[4] = (Scan[31:16] == 16'b0);
+        Half = (Empty[4]) ? Scan[15:0] : Scan[31:16];
+        Empty[3] = (Half[15:8] == 8'b0);
+        Quarter = (Empty[3]) ? Half[7:0] : Half[15:8];
+        Empty[2] = (Quarter[7:4] == 4'b0);
+        Eighth = (Empty[2]) ? Quarter[3:0] : Quarter[7:4];
+        Empty[1] = (Eighth[3:2] == 2'b0);
+        Sixteenth = (Empty[1]) ? Eighth[1:0] : Eighth[3:2];
+        Empty[0] = !Sixteenth[1];
+        Zeros = (Scan == 32'b0) ? 6'd32 : {1'b0, Empty};
+    end
+
+    // Population count as an adder tree rather than a chain of 32 increments
+    always_comb begin
+        for (int i = 0; i < 16; i++) Sum2[i] = SrcA[2*i] + SrcA[2*i + 1];
+        for (int i = 0; i < 8; i++) Sum4[i] = Sum2[2*i] + Sum2[2*i + 1];
+        for (int i = 0; i < 4; i++) Sum8[i] = Sum4[2*i] + Sum4[2*i + 1];
+        for (int i = 0; i < 2; i++) Sum16[i] = Sum8[2*i] + Sum8[2*i + 1];
+        Ones = Sum16[0] + Sum16[1];
+    end
+endmodule
+
+module packed_simd_unit (
+    input wire [ALU_CONTROL_WIDTH-1:0] ALU_Control,
+    input wire [31:0] SrcA, SrcB,
+    output logic [31:0] Result
+    );
+
+    logic Half, Sub; // Lanes are halfwords rather than bytes, lanes subtract SrcB
+    logic [31:0] B_In, Sum;
+    logic [3:0] Carry, Overflow; // From each byte slice of the adder
+    logic [3:0] Lane_C, Lane_V, Lane_N, Lane_Z, Lane_S; // Flags of the lane each byte belongs to, Lane_S is the sign of SrcA
+
+    always_comb begin
+        Half = ALU_Control inside {ALU_ADD16, ALU_SUB16, ALU_KADD16, ALU_UKADD16, ALU_CMPEQ16, ALU_SCMPLT16, ALU_UCMPLT16, 
+                                   ALU_SMIN16, ALU_SMAX16, ALU_UMIN16, ALU_UMAX16};
+        Sub = !(ALU_Control inside {ALU_ADD8, ALU_ADD16, ALU_KADD8, ALU_KADD16, ALU_UKADD8, ALU_UKADD16}); // Compares and min/max subtract too
+        B_In = (Sub) ? ~SrcB : SrcB;
+
+        // Byte slices, the low byte's carry only crosses into the high byte of a halfword lane
+        for (int i = 0; i < 4; i += 2) begin
+            {Carry[i], Sum[8*i +: 8]} = SrcA[8*i +: 8] + B_In[8*i +: 8] + Sub;
+            {Carry[i + 1], Sum[8*(i + 1) +: 8]} = SrcA[8*(i + 1) +: 8] + B_In[8*(i + 1) +: 8] + ((Half) ? Carry[i] : Sub);
+        end
+        for (int i = 0; i < 4; i++) Overflow[i] = (SrcA[8*i + 7] == B_In[8*i + 7]) && (Sum[8*i + 7] != SrcA[8*i + 7]);
+
+        // Halfword lanes take their flags from the top byte
+        for (int i = 0; i < 4; i++) begin
+            Lane_C[i] = (Half) ? Carry[i | 1] : Carry[i];
+            Lane_V[i] = (Half) ? Overflow[i | 1] : Overflow[i];
+            Lane_N[i] = (Half) ? Sum[8*(i | 1) + 7] : Sum[8*i + 7];
+            Lane_S[i] = (Half) ? SrcA[8*(i | 1) + 7] : SrcA[8*i + 7];
+            Lane_Z[i] = (Half) ? (Sum[16*(i / 2) +: 16] == 16'b0) : (Sum[8*i +: 8] == 8'b0);
+        end
+
+        Result = 32'b0;
+        case (ALU_Control)
+            ALU_ADD8, ALU_ADD16, ALU_SUB8, ALU_SUB16: Result = Sum;
+            ALU_KADD8, ALU_KADD16: // Clamp towards the sign of the operands, which matches SrcA's when it overflows
+                for (int i = 0; i < 4; i++) 
+                    if (!Lane_V[i]) Result[8*i +: 8] = Sum[8*i +: 8];
+                    else if (Half && i % 2 == 0) Result[8*i +: 8] = {8{!Lane_S[i]}};
+                    else Result[8*i +: 8] = {Lane_S[i], {7{!Lane_S[i]}}};
+            ALU_UKADD8, ALU_UKADD16: for (int i = 0; i < 4; i++) Result[8*i +: 8] = (Lane_C[i]) ? 8'hFF : Sum[8*i +: 8];
+            ALU_CMPEQ8, ALU_CMPEQ16: for (int i = 0; i < 4; i++) Result[8*i +: 8] = {8{Lane_Z[i]}};
+            ALU_SCMPLT8, ALU_SCMPLT16: for (int i = 0; i < 4; i++) Result[8*i +: 8] = {8{Lane_N[i] ^ Lane_V[i]}};
+            ALU_UCMPLT8, ALU_UCMPLT16: for (int i = 0; i < 4; i++) Result[8*i +: 8] = {8{!Lane_C[i]}}; // No carry out means a borrow
+            ALU_SMIN8, ALU_SMIN16: for (int i = 0; i < 4; i++) Result[8*i +: 8] = (Lane_N[i] ^ Lane_V[i]) ? SrcA[8*i +: 8] : SrcB[8*i +: 8];
+            ALU_SMAX8, ALU_SMAX16: for (int i = 0; i < 4; i++) Result[8*i +: 8] = (Lane_N[i] ^ Lane_V[i]) ? SrcB[8*i +: 8] : SrcA[8*i +: 8];
+            ALU_UMIN8, ALU_UMIN16: for (int i = 0; i < 4; i++) Result[8*i +: 8] = (!Lane_C[i]) ? SrcA[8*i +: 8] : SrcB[8*i +: 8];
+            ALU_UMAX8, ALU_UMAX16: for (int i = 0; i < 4; i++) Result[8*i +: 8] = (!Lane_C[i]) ? SrcB[8*i +: 8] : SrcA[8*i +: 8];
+            ALU_PKBB16: Result = {SrcA[15:0], SrcB[15:0]}; // Shuffles are only wiring
+            ALU_PKBT16: Result = {SrcA[15:0], SrcB[31:16]};
+            ALU_PKTB16: Result = {SrcA[31:16], SrcB[15:0]};
+            ALU_PKTT16: Result = {SrcA[31:16], SrcB[31:16]};
+            ALU_SWAP8: Result = {SrcA[23:16], SrcA[31:24], SrcA[7:0], SrcA[15:8]};
+            default: ; // Not a packed operation
+        endcase
+    end
+endmodule
+
+module multiplier (
+    input wire CLK, Stall_M, Stall_W,
+    input wire [ALU_CONTROL_WIDTH-1:0] ALU_Control_E,
+    input wire [31:0] SrcA_E, SrcB_E, // Forwarded register operands
+    output wire [31:0] MUL_Out_W
+    );
+
+    logic signed [32:0] SrcA_M, SrcB_M; // Extended by one bit so every variant is a signed multiply
+    logic signed [65:0] Product_W;
+    logic High_M, High_W; // Return the upper 32 bits
+
+    always_ff @ (posedge CLK) begin // Each stage holds with the pipeline register it sits beside
+        if (!Stall_M) begin
+            SrcA_M <= {(ALU_Control_E == ALU_MULH || ALU_Control_E == ALU_MULHSU) && SrcA_E[31], SrcA_E};
+            SrcB_M <= {(ALU_Control_E == ALU_MULH) && SrcB_E[31], SrcB_E};
+            High_M <= (ALU_Control_E != ALU_MUL);
+        end
+        if (!Stall_W) begin
+            Product_W <= SrcA_M * SrcB_M;
+            High_W <= High_M;
+        end
+    end
+
+    assign MUL_Out_W = (High_W) ? Product_W[63:32] : Product_W[31:0];
+endmodule
+
+module cfu_port (
+    input wire CLK, RST, Stall_M,
+    input wire Redirect_En, // A registered redirect is removing the instruction in execute
+    input wire [ALU_CONTROL_WIDTH-1:0] ALU_Control_E,
+    input wire [31:0] SrcA_E, SrcB_E, // Forwarded register operands
+    input wire [31:0] Imm_Ext_E, // Function select
+    output wire CFU_Wait_E, // Hold execute until the response arrives
+    output wire [31:0] CFU_Out_E,
+
+    // Request channel, held until accepted
+    output wire CFU_Req_Valid,
+    input wire CFU_Req_Ready,
+    output wire [CFU_FUNC_WIDTH-1:0] CFU_Req_Func,
+    output wire [31:0] CFU_Req_SrcA, CFU_Req_SrcB,
+
+    // Response channel, held by the CFU until accepted
+    input wire CFU_Rsp_Valid,
+    output wire CFU_Rsp_Ready,
+    input wire [31:0] CFU_Rsp_Data
+    );
+
+    wire CFU_E;
+    logic Issued; // Request accepted, waiting for the response
+
+    assign CFU_E = (ALU_Control_E == ALU_CFU);
+
+    // Only ask once, and never for an instruction that is about to be removed so a response can't be orphaned
+    assign CFU_Req_Valid = CFU_E && !Issued && !(REGISTERED_REDIRECT && Redirect_En);
+    assign CFU_Req_Func = Imm_Ext_E[CFU_FUNC_WIDTH-1:0];
+    assign CFU_Req_SrcA = SrcA_E;
+    assign CFU_Req_SrcB = SrcB_E;
+
+    // Take the response as the instruction leaves execute
+    assign CFU_Rsp_Ready = CFU_E && Issued && !Stall_M;
+    assign CFU_Wait_E = CFU_E && !(Issued && CFU_Rsp_Valid);
+    assign CFU_Out_E = CFU_Rsp_Data;
+
+    always_ff @ (posedge CLK) begin // Synchronous reset
+        if (RST)
+            Issued <= 1'b0;
+        else if (CFU_Rsp_Valid && CFU_Rsp_Ready)
+            Issued <= 1'b0;
+        else if (CFU_Req_Valid && CFU_Req_Ready)
+            Issued <= 1'b1;
+    end
+endmodule
+
+module divider (
+    input wire CLK, RST, Stall_E, Flush_M,
+    input wire [ALU_CONTROL_WIDTH-1:0] ALU_Control_E,
+    input wire [4:0] RD_E,
+    input wire [31:0] SrcA_E, SrcB_E, // Forwarded register operands
+    input wire DIV_W_En, // Writeback has taken the result this cycle
+    output logic DIV_Busy, DIV_Done,
+    output logic [4:0] DIV_RD, // Destination held until the result is written
+    output logic [31:0] DIV_Out
+    );
+
+    wire Start, Signed_Op;
+    logic [31:0] SrcA_Mag, SrcB_Mag;
+    logic [5:0] CLZ_A, CLZ_B;
+    logic Running, Neg_Q, Neg_R, Want_Rem;
+    logic [4:0] Count; // Quotient bits still to produce, minus one
+    logic [31:0] Quotient, Remainder, Divisor;
+
+    // A divide leaving execute starts, one removed by a registered redirect never does
+    assign Start = (ALU_Control_E == ALU_DIV || ALU_Control_E == ALU_DIVU || ALU_Control_E == ALU_REM || ALU_Control_E == ALU_REMU) && !Stall_E && !Flush_M;
+    assign Signed_Op = (ALU_Control_E == ALU_DIV || ALU_Control_E == ALU_REM);
+    assign SrcA_Mag = (Signed_Op && SrcA_E[31]) ? -SrcA_E : SrcA_E;
+    assign SrcB_Mag = (Signed_Op && SrcB_E[31]) ? -SrcB_E : SrcB_E;
+
+    always_comb begin // Count leading zeros, the highest set bit is found last
+        CLZ_A = 6'd32;
+        CLZ_B = 6'd32;
+        for (int i = 0; i < 32; i++) begin
+            if (SrcA_Mag[i]) CLZ_A = 6'(31 - i);
+            if (SrcB_Mag[i]) CLZ_B = 6'(31 - i);
+        end
+    end
+
+    always_ff @ (posedge CLK) begin // Synchronous reset
+        if (RST) begin
+            Running <= 1'b0;
+            DIV_Done <= 1'b0;
+        end
+        else if (Start) begin
+            DIV_RD <= RD_E;
+            Want_Rem <= (ALU_Control_E == ALU_REM || ALU_Control_E == ALU_REMU);
+            Quotient <= 32'b0;
+            Remainder <= SrcA_Mag;
+            Neg_R <= Signed_Op && SrcA_E[31]; // Remainder takes the sign of the dividend
+            Neg_Q <= Signed_Op && (SrcA_E[31] ^ SrcB_E[31]);
+            if (SrcB_E == 32'b0) begin // Divide by zero gives all ones and leaves the dividend as the remainder
+                Quotient <= 32'hFFFF_FFFF;
+                Remainder <= SrcA_E;
+                Neg_Q <= 1'b0;
+                Neg_R <= 1'b0;
+                DIV_Done <= 1'b1;
+            end
+            else if (CLZ_A > CLZ_B) // Divisor is bigger so the quotient is zero
+                DIV_Done <= 1'b1;
+            else begin
+                Divisor <= SrcB_Mag << (CLZ_B - CLZ_A); // Line up the leading ones
+                Count <= 5'(CLZ_B - CLZ_A);
+                Running <= 1'b1;
+            end
+        end
+        else if (Running) begin // Restoring division, one quotient bit per cycle
+            if (Remainder >= Divisor) begin
+                Remainder <= Remainder - Divisor;
+                Quotient <= {Quotient[30:0], 1'b1};
+            end
+            else
+                Quotient <= {Quotient[30:0], 1'b0};
+            Divisor <= Divisor >> 1;
+            Count <= Count - 1;
+            if (Count == 5'b0) begin
+                Running <= 1'b0;
+                DIV_Done <= 1'b1;
+            end
+        end
+        else if (DIV_W_En)
+            DIV_Done <= 1'b0;
+    end
+
+    // Overflow (-2^31 / -1) needs no special case, the magnitudes give 2^31 which negates back to itself
+    assign DIV_Out = (Want_Rem) ? ((Neg_R) ? -Remainder : Remainder) : ((Neg_Q) ? -Quotient : Quotient);
+    assign DIV_Busy = (Running || DIV_Done) && !DIV_W_En; // Dependents can read through the register file as it is written
+endmodule
@@ -0,0 +1,493 @@
+//////////////////////////////////////////////////////////////////////////////////
+// Third Year Project: RISC-V RV32i Pipelined Processor
+// File: Floating Point Unit
+// Description: Single precision floating point on the integer registers (Zfinx).
+//              FP Pipeline:
+//                  Adds, multiplies, conversions, compares, min/max, sign injection and classify.
+//                  Operands are registered into memory like the multiplier, memory aligns, adds or
+//                  multiplies and normalises, then writeback only has to round. One result per cycle
+//                  reaches writeback two cycles after execute.
+//              FP Divider:
+//                  Iterative divide and square root, one quotient or root bit per cycle then a cycle
+//                  to round. Shares the integer divider's scoreboard and free write port slots.
+//              FP Rounder:
+//                  Rounds a value with its guard and sticky bits for the instruction's rounding mode.
+//              Every rounding mode and subnormals follow IEEE 754. There is no fcsr so the exception
+//              flags aren't kept and the dynamic rounding mode is round to nearest even.
+// Author: Luke Shepherd
+// Date Created: October 2026
+//////////////////////////////////////////////////////////////////////////////////
+
+import definitions::*;
+
+module floating_point_unit (
+    input wire CLK, Stall_M, Stall_W,
+    input wire [ALU_CONTROL_WIDTH-1:0] ALU_Control_E,
+    input wire [2:0] RM_E, // Rounding mode, the func3 of the instruction
+    input wire [31:0] SrcA_E, SrcB_E, // Forwarded register operands
+    output logic FPU_W, // The instruction in writeback takes the FPU result
+    output logic [31:0] FPU_Out_W
+    );
+
+    // Memory stage
+    logic FPU_M;
+    logic [ALU_CONTROL_WIDTH-1:0] Op_M;
+    logic [2:0] RM_M;
+    logic [31:0] A_M, B_M;
+
+    wire Sign_A, Sign_B;
+    wire Zero_A, Zero_B, Subnormal_A, Subnormal_B, Inf_A, Inf_B, NaN_A, NaN_B, Signalling_A, Signalling_B;
+    wire [7:0] Exp_A, Exp_B;
+    wire [23:0] Sig_A, Sig_B;
+
+    // Addition
+    logic Swap, Add_Sign, Add_Subtract;
+    logic [7:0] Big_Exp, Small_Exp, Align;
+    logic [23:0] Big_Sig, Small_Sig;
+    logic [26:0] Aligned, Aligned_Lost, Addend, Add_Norm;
+    logic [27:0] Sum;
+    logic [4:0] Add_LZC, Add_Shift;
+    logic [9:0] Add_Exp;
+
+    // Multiplication
+    logic [47:0] Product, Mul_Norm, Mul_Shifted, Mul_Lost;
+    logic [5:0] Mul_LZC, Mul_Denorm;
+    logic [9:0] Mul_Exp; // Two's complement, subnormal when zero or negative
+
+    // Conversions
+    logic [31:0] Int_Mag, Int_Norm;
+    logic [4:0] Int_LZC;
+    logic [23:0] Whole;
+    logic [32:0] Fraction;
+
+    // Compares
+    logic Less, Equal, Less_Total; // Less_Total puts -0 below +0 for min/max
+
+    // Result handed to writeback
+    logic [1:0] Kind, Kind_W;
+    logic Sign, Sign_W, Guard, Guard_W, Sticky, Sticky_W, Overflow, Overflow_W, Unsigned, Unsigned_W;
+    logic [31:0] Value, Value_W;
+    logic [2:0] RM_W;
+
+    always_ff @ (posedge CLK) begin // Each stage holds with the pipeline register it sits beside
+        if (!Stall_M) begin
+            FPU_M <= (ALU_Control_E[ALU_CONTROL_WIDTH-1 -: 2] == 2'b11);
+            Op_M <= ALU_Control_E;
+            RM_M <= RM_E;
+            A_M <= SrcA_E;
+            B_M <= (ALU_Control_E == ALU_FSUB) ? {~SrcB_E[31], SrcB_E[30:0]} : SrcB_E; // Subtract adds the negated operand
+        end
+        if (!Stall_W) begin
+            FPU_W <= FPU_M;
+            Kind_W <= Kind;
+            RM_W <= RM_M;
+            Sign_W <= Sign;
+            Value_W <= Value;
+            Guard_W <= Guard;
+            Sticky_W <= Sticky;
+            Overflow_W <= Overflow;
+            Unsigned_W <= Unsigned;
+        end
+    end
+
+    fp_unpack unpack_a (
+        .X(A_M),
+        .Sign(Sign_A),
+        .Zero(Zero_A),
+        .Subnormal(Subnormal_A),
+        .Inf(Inf_A),
+        .NaN(NaN_A),
+        .Signalling(Signalling_A),
+        .Exp(Exp_A),
+        .Sig(Sig_A)
+    );
+
+    fp_unpack unpack_b (
+        .X(B_M),
+        .Sign(Sign_B),
+        .Zero(Zero_B),
+        .Subnormal(Subnormal_B),
+        .Inf(Inf_B),
+        .NaN(NaN_B),
+        .Signalling(Signalling_B),
+        .Exp(Exp_B),
+        .Sig(Sig_B)
+    );
+
+    // Addition, the larger magnitude goes first so only the smaller one is ever shifted right
+    always_comb begin
+        Swap = (B_M[30:0] > A_M[30:0]);
+        Add_Sign = (Swap) ? Sign_B : Sign_A;
+        Big_Exp = (Swap) ? Exp_B : Exp_A;
+        Big_Sig = (Swap) ? Sig_B : Sig_A;
+        Small_Exp = (Swap) ? Exp_A : Exp_B;
+        Small_Sig = (Swap) ? Sig_A : Sig_B;
+        Add_Subtract = Sign_A ^ Sign_B;
+
+        // Guard, round and sticky bits below the significand are enough for a correctly rounded sum
+        Align = (Big_Exp - Small_Exp > 8'd27) ? 8'd27 : Big_Exp - Small_Exp;
+        {Aligned, Aligned_Lost} = {Small_Sig, 3'b0, 27'b0} >> Align;
+        Addend = {Aligned[26:1], Aligned[0] || (Aligned_Lost != 27'b0)};
+        Sum = (Add_Subtract) ? {1'b0, Big_Sig, 3'b0} - {1'b0, Addend} : {1'b0, Big_Sig, 3'b0} + {1'b0, Addend};
+
+        Add_LZC = 5'd27;
+        for (int i = 0; i < 27; i++) if (Sum[i]) Add_LZC = 5'(26 - i);
+        if (Sum[27]) begin // Carried out so shift right, the bit lost joins the sticky bit
+            Add_Norm = {Sum[27:2], Sum[1] || Sum[0]};
+            Add_Exp = {2'b0, Big_Exp} + 10'd1;
+            Add_Shift = 5'b0;
+        end
+        else begin // Cancellation, shift left but never below the smallest exponent so the result becomes subnormal instead
+            Add_Shift = ({3'b0, Add_LZC} < Big_Exp - 8'd1) ? Add_LZC : 5'(Big_Exp - 8'd1);
+            Add_Norm = Sum[26:0] << Add_Shift;
+            Add_Exp = {2'b0, Big_Exp} - {5'b0, Add_Shift};
+        end
+    end
+
+    // Multiplication, the significand product maps onto a DSP block
+    always_comb begin
+        Product = Sig_A * Sig_B;
+        Mul_LZC = 6'd47;
+        for (int i = 0; i < 48; i++) if (Product[i]) Mul_LZC = 6'(47 - i);
+        Mul_Norm = Product << Mul_LZC;
+        Mul_Exp = {2'b0, Exp_A} + {2'b0, Exp_B} - 10'd126 - {4'b0, Mul_LZC};
+        // Too small for a normal number so shift the significand down to the subnormal range
+        if (Mul_Exp[9] || Mul_Exp == 10'b0) Mul_Denorm = (10'd1 - Mul_Exp > 10'd48) ? 6'd48 : 6'(10'd1 - Mul_Exp);
+        else Mul_Denorm = 6'b0;
+        {Mul_Shifted, Mul_Lost} = {Mul_Norm, 48'b0} >> Mul_Denorm;
+    end
+
+    // Conversions
+    always_comb begin
+        Int_Mag = (Op_M == ALU_FCVT_S_W && A_M[31]) ? -A_M : A_M;
+        Int_LZC = 5'd31;
+        for (int i = 0; i < 32; i++) if (Int_Mag[i]) Int_LZC = 5'(31 - i);
+        Int_Norm = Int_Mag << Int_LZC;
+        // Integer part of a float and the bits below it, anything under 2^-9 only matters to the sticky bit
+        {Whole, Fraction} = {Sig_A, 33'b0} >> ((Exp_A < 8'd117) ? 8'd33 : 8'd150 - Exp_A);
+    end
+
+    // Compares, ordered by sign then magnitude
+    always_comb begin
+        Equal = !NaN_A && !NaN_B && (A_M == B_M || (Zero_A && Zero_B));
+        Less_Total = (Sign_A != Sign_B) ? Sign_A : (Sign_A) ? (A_M[30:0] > B_M[30:0]) : (A_M[30:0] < B_M[30:0]);
+        Less = !NaN_A && !NaN_B && !(Zero_A && Zero_B) && Less_Total;
+    end
+
+    always_comb begin
+        Kind = FP_EXACT; // Default values
+        Sign = 1'b0;
+        Value = 32'b0;
+        Guard = 1'b0;
+        Sticky = 1'b0;
+        Overflow = 1'b0;
+        Unsigned = 1'b0;
+        case (Op_M)
+            ALU_FADD, ALU_FSUB:
+                if (NaN_A || NaN_B || (Inf_A && Inf_B && Add_Subtract)) Value = FP_CANONICAL_NAN;
+                else if (Inf_A) Value = A_M;
+                else if (Inf_B) Value = B_M;
+                else if (Sum == 28'b0) Value = {(Add_Subtract) ? (RM_M == FRM_RDN) : Sign_A, 31'b0}; // Exact zero is only negative rounding down
+                else begin
+                    Kind = FP_ROUND_FLOAT;
+                    Sign = Add_Sign;
+                    Value = {1'b0, (Add_Norm[26]) ? Add_Exp[7:0] : 8'b0, Add_Norm[25:3]};
+                    Guard = Add_Norm[2];
+                    Sticky = Add_Norm[1] || Add_Norm[0];
+                    Overflow = (Add_Exp >= 10'd255);
+                end
+            ALU_FMUL:
+                if (NaN_A || NaN_B || (Inf_A && Zero_B) || (Zero_A && Inf_B)) Value = FP_CANONICAL_NAN;
+                else if (Inf_A || Inf_B) Value = {Sign_A ^ Sign_B, 31'h7F80_0000};
+                else if (Zero_A || Zero_B) Value = {Sign_A ^ Sign_B, 31'b0};
+                else begin
+                    Kind = FP_ROUND_FLOAT;
+                    Sign = Sign_A ^ Sign_B;
+                    Value = {1'b0, (Mul_Denorm != 6'b0) ? 8'b0 : Mul_Exp[7:0], Mul_Shifted[46:24]};
+                    Guard = Mul_Shifted[23];
+                    Sticky = (Mul_Shifted[22:0] != 23'b0) || (Mul_Lost != 48'b0);
+                    Overflow = !Mul_Exp[9] && (Mul_Exp >= 10'd255);
+                end
+            ALU_FCVT_S_W, ALU_FCVT_S_WU:
+                if (A_M != 32'b0) begin
+                    Kind = FP_ROUND_FLOAT;
+                    Sign = (Op_M == ALU_FCVT_S_W) && A_M[31];
+                    Value = {1'b0, 8'd158 - {3'b0, Int_LZC}, Int_Norm[30:8]};
+                    Guard = Int_Norm[7];
+                    Sticky = (Int_Norm[6:0] != 7'b0);
+                end
+            ALU_FCVT_W_S, ALU_FCVT_WU_S:
+                if (NaN_A) Value = (Op_M == ALU_FCVT_W_S) ? 32'h7FFF_FFFF : 32'hFFFF_FFFF;
+                else begin
+                    Kind = FP_ROUND_INT;
+                    Sign = Sign_A;
+                    Unsigned = (Op_M == ALU_FCVT_WU_S);
+                    Overflow = Inf_A || (Exp_A >= 8'd159); // At least 2^32, too big for either
+                    if (Exp_A >= 8'd150) Value = {8'b0, Sig_A} << (Exp_A - 8'd150); // Already an integer
+                    else begin
+                        Value = {8'b0, Whole};
+                        Guard = Fraction[32];
+                        Sticky = (Fraction[31:0] != 32'b0);
+                    end
+                end
+            ALU_FMIN, ALU_FMAX: // A NaN is only returned if both are NaN
+                if (NaN_A && NaN_B) Value = FP_CANONICAL_NAN;
+                else if (NaN_A) Value = B_M;
+                else if (NaN_B) Value = A_M;
+                else Value = (Less_Total == (Op_M == ALU_FMIN)) ? A_M : B_M;
+            ALU_FEQ: Value = {31'b0, Equal};
+            ALU_FLT: Value = {31'b0, Less};
+            ALU_FLE: Value = {31'b0, Less || Equal};
+            ALU_FSGNJ: Value = {B_M[31], A_M[30:0]};
+            ALU_FSGNJN: Value = {~B_M[31], A_M[30:0]};
+            ALU_FSGNJX: Value = {A_M[31] ^ B_M[31], A_M[30:0]};
+            ALU_FCLASS: Value = {22'b0, NaN_A && !Signalling_A, Signalling_A,
+                                 !Sign_A && Inf_A, !Sign_A && !Zero_A && !Subnormal_A && !Inf_A && !NaN_A, !Sign_A && Subnormal_A, !Sign_A && Zero_A,
+                                 Sign_A && Zero_A, Sign_A && Subnormal_A, Sign_A && !Zero_A && !Subnormal_A && !Inf_A && !NaN_A, Sign_A && Inf_A};
+            default: ; // Not an FPU pipeline operation
+        endcase
+    end
+
+    // Writeback only rounds and saturates
+    wire [32:0] Rounded;
+
+    fp_rounder fp_rounder (
+        .RM(RM_W),
+        .Sign(Sign_W),
+        .Value(Value_W),
+        .Guard(Guard_W),
+        .Sticky(Sticky_W),
+        .Rounded(Rounded)
+    );
+
+    always_comb begin
+        case (Kind_W)
+            FP_ROUND_FLOAT: // Overflow goes to infinity unless rounding towards zero, which stops at the largest finite number
+                if (Overflow_W) FPU_Out_W = {Sign_W, (RM_W == FRM_RTZ || RM_W == ((Sign_W) ? FRM_RUP : FRM_RDN)) ? 31'h7F7F_FFFF : 31'h7F80_0000};
+                else FPU_Out_W = {Sign_W, Rounded[30:0]};
+            FP_ROUND_INT: // Out of range values saturate to the nearest representable integer
+                if (Unsigned_W) FPU_Out_W = (Sign_W) ? 32'b0 : (Overflow_W || Rounded[32]) ? 32'hFFFF_FFFF : Rounded[31:0];
+                else if (Sign_W) FPU_Out_W = (Overflow_W || Rounded > 33'h0_8000_0000) ? 32'h8000_0000 : -Rounded[31:0];
+                else FPU_Out_W = (Overflow_W || Rounded > 33'h0_7FFF_FFFF) ? 32'h7FFF_FFFF : Rounded[31:0];
+            default: FPU_Out_W = Value_W;
+        endcase
+    end
+endmodule
+
+module fp_divider (
+    input wire CLK, RST, Stall_E, Flush_M,
+    input wire [ALU_CONTROL_WIDTH-1:0] ALU_Control_E,
+    input wire [2:0] RM_E, // Rounding mode, the func3 of the instruction
+    input wire [4:0] RD_E,
+    input wire [31:0] SrcA_E, SrcB_E, // Forwarded register operands
+    input wire FDIV_W_En, // Writeback has taken the result this cycle
+    output logic FDIV_Busy, FDIV_Done,
+    output logic [4:0] FDIV_RD, // Destination held until the result is written
+    output logic [31:0] FDIV_Out
+    );
+
+    wire Start, Sqrt_Op;
+    wire Sign_A, Sign_B;
+    wire Zero_A, Zero_B, Subnormal_A, Subnormal_B, Inf_A, Inf_B, NaN_A, NaN_B;
+    wire [7:0] Exp_A, Exp_B;
+    wire [23:0] Sig_A, Sig_B;
+    logic [4:0] LZC_A, LZC_B;
+    logic [23:0] Norm_A, Norm_B; // Subnormals are normalised first so every quotient bit is significant
+    logic [9:0] Norm_Exp_A, Norm_Exp_B;
+
+    logic Running, Rounding, Sqrt, Sign;
+    logic [2:0] RM;
+    logic [4:0] Count; // Bits still to produce, minus one
+    logic [9:0] Exp; // Two's complement biased exponent of the result
+    logic [24:0] Quotient; // Quotient or root with a guard bit, the top bit is always set
+    logic [27:0] Remainder, Trial_Rem;
+    logic [23:0] Divisor;
+    logic [49:0] Radicand; // Square root takes the top two bits each cycle
+
+    // Final rounding
+    logic [5:0] Denorm;
+    logic [24:0] Shifted;
+    logic [25:0] Lost;
+    logic Overflow;
+    wire [32:0] Rounded;
+
+    // A divide or square root leaving execute starts, one removed by a registered redirect never does
+    assign Start = (ALU_Control_E == ALU_FDIV || ALU_Control_E == ALU_FSQRT) && !Stall_E && !Flush_M;
+    assign Sqrt_Op = (ALU_Control_E == ALU_FSQRT);
+
+    fp_unpack unpack_a (
+        .X(SrcA_E),
+        .Sign(Sign_A),
+        .Zero(Zero_A),
+        .Subnormal(Subnormal_A),
+        .Inf(Inf_A),
+        .NaN(NaN_A),
+        .Signalling(),
+        .Exp(Exp_A),
+        .Sig(Sig_A)
+    );
+
+    fp_unpack unpack_b (
+        .X(SrcB_E),
+        .Sign(Sign_B),
+        .Zero(Zero_B),
+        .Subnormal(Subnormal_B),
+        .Inf(Inf_B),
+        .NaN(NaN_B),
+        .Signalling(),
+        .Exp(Exp_B),
+        .Sig(Sig_B)
+    );
+
+    always_comb begin // Count leading zeros, the highest set bit is found last
+        LZC_A = 5'd0;
+        LZC_B = 5'd0;
+        for (int i = 0; i < 24; i++) begin
+            if (Sig_A[i]) LZC_A = 5'(23 - i);
+            if (Sig_B[i]) LZC_B = 5'(23 - i);
+        end
+        Norm_A = Sig_A << LZC_A;
+        Norm_B = Sig_B << LZC_B;
+        Norm_Exp_A = {2'b0, Exp_A} - {5'b0, LZC_A};
+        Norm_Exp_B = {2'b0, Exp_B} - {5'b0, LZC_B};
+    end
+
+    // Square root step, subtract 4 times the root so far plus one when it fits
+    assign Trial_Rem = {Remainder[25:0], Radicand[49:48]};
+
+    always_ff @ (posedge CLK) begin // Synchronous reset
+        if (RST) begin
+            Running <= 1'b0;
+            Rounding <= 1'b0;
+            FDIV_Done <= 1'b0;
+        end
+        else if (Start) begin
+            FDIV_RD <= RD_E;
+            RM <= RM_E;
+            Sqrt <= Sqrt_Op;
+            Quotient <= 25'b0;
+            Count <= 5'(FP_DIV_CYCLES - 1);
+            if (Sqrt_Op) begin
+                Sign <= 1'b0;
+                if (NaN_A || (Sign_A && !Zero_A)) begin FDIV_Out <= FP_CANONICAL_NAN; FDIV_Done <= 1'b1; end
+                else if (Zero_A || Inf_A) begin FDIV_Out <= SrcA_E; FDIV_Done <= 1'b1; end // Keeps the sign of zero
+                else begin
+                    // Make the unbiased exponent even so it halves exactly, the significand takes the odd factor of two
+                    Exp <= (Norm_Exp_A + 10'd126 + {9'b0, Norm_Exp_A[0]}) >> 1;
+                    Radicand <= (Norm_Exp_A[0]) ? {1'b0, Norm_A, 25'b0} : {Norm_A, 26'b0};
+                    Remainder <= 28'b0;
+                    Running <= 1'b1;
+                end
+            end
+            else begin
+                Sign <= Sign_A ^ Sign_B;
+                if (NaN_A || NaN_B || (Zero_A && Zero_B) || (Inf_A && Inf_B)) begin FDIV_Out <= FP_CANONICAL_NAN; FDIV_Done <= 1'b1; end
+                else if (Inf_A || Zero_B) begin FDIV_Out <= {Sign_A ^ Sign_B, 31'h7F80_0000}; FDIV_Done <= 1'b1; end
+                else if (Zero_A || Inf_B) begin FDIV_Out <= {Sign_A ^ Sign_B, 31'b0}; FDIV_Done <= 1'b1; end
+                else begin
+                    // A smaller dividend is doubled so the quotient lands in [1, 2)
+                    Exp <= Norm_Exp_A - Norm_Exp_B + 10'd127 - {9'b0, Norm_A < Norm_B};
+                    Remainder <= (Norm_A < Norm_B) ? {3'b0, Norm_A, 1'b0} : {4'b0, Norm_A};
+                    Divisor <= Norm_B;
+                    Running <= 1'b1;
+                end
+            end
+        end
+        else if (Running) begin // Restoring, one bit per cycle
+            if (Sqrt) begin
+                if (Trial_Rem >= {1'b0, Quotient, 2'b01}) begin
+                    Remainder <= Trial_Rem - {1'b0, Quotient, 2'b01};
+                    Quotient <= {Quotient[23:0], 1'b1};
+                end
+                else begin
+                    Remainder <= Trial_Rem;
+                    Quotient <= {Quotient[23:0], 1'b0};
+                end
+                Radicand <= Radicand << 2;
+            end
+            else begin
+                if (Remainder >= {4'b0, Divisor}) begin
+                    Remainder <= (Remainder - {4'b0, Divisor}) << 1;
+                    Quotient <= {Quotient[23:0], 1'b1};
+                end
+                else begin
+                    Remainder <= Remainder << 1;
+                    Quotient <= {Quotient[23:0], 1'b0};
+                end
+            end
+            Count <= Count - 1;
+            if (Count == 5'b0) begin
+                Running <= 1'b0;
+                Rounding <= 1'b1;
+            end
+        end
+        else if (Rounding) begin // Rounded result is registered so writeback sees no extra logic
+            FDIV_Out <= (Overflow) ? {Sign, (RM == FRM_RTZ || RM == ((Sign) ? FRM_RUP : FRM_RDN)) ? 31'h7F7F_FFFF : 31'h7F80_0000} : {Sign, Rounded[30:0]};
+            Rounding <= 1'b0;
+            FDIV_Done <= 1'b1;
+        end
+        else if (FDIV_W_En)
+            FDIV_Done <= 1'b0;
+    end
+
+    // A quotient too small to be normal shifts down into the subnormal range, any remainder is sticky
+    always_comb begin
+        if (Exp[9] || Exp == 10'b0) Denorm = (10'd1 - Exp > 10'd26) ? 6'd26 : 6'(10'd1 - Exp);
+        else Denorm = 6'b0;
+        {Shifted, Lost} = {Quotient, 26'b0} >> Denorm;
+        Overflow = !Exp[9] && (Exp >= 10'd255);
+    end
+
+    fp_rounder fp_rounder (
+        .RM(RM),
+        .Sign(Sign),
+        .Value({1'b0, (Denorm != 6'b0) ? 8'b0 : Exp[7:0], Shifted[23:1]}),
+        .Guard(Shifted[0]),
+        .Sticky(Remainder != 28'b0 || Lost != 26'b0),
+        .Rounded(Rounded)
+    );
+
+    assign FDIV_Busy = (Running || Rounding || FDIV_Done) && !FDIV_W_En; // Dependents can read through the register file as it is written
+endmodule
+
+module fp_unpack (
+    input wire [31:0] X,
+    output logic Sign, Zero, Subnormal, Inf, NaN, Signalling,
+    output logic [7:0] Exp, // Subnormals share the smallest normal exponent
+    output logic [23:0] Sig // Significand with the hidden bit
+    );
+
+    always_comb begin
+        Sign = X[31];
+        Zero = (X[30:0] == 31'b0);
+        Subnormal = (X[30:23] == 8'b0) && !Zero;
+        Inf = (X[30:23] == 8'hFF) && (X[22:0] == 23'b0);
+        NaN = (X[30:23] == 8'hFF) && (X[22:0] != 23'b0);
+        Signalling = NaN && !X[22];
+        Exp = (X[30:23] == 8'b0) ? 8'd1 : X[30:23];
+        Sig = {X[30:23] != 8'b0, X[22:0]};
+    end
+endmodule
+
+module fp_rounder (
+    input wire [2:0] RM,
+    input wire Sign,
+    input wire [31:0] Value, // Exponent and fraction of a float, or the magnitude of an integer
+    input wire Guard, Sticky, // The bit below Value and whether any below that are set
+    output logic [32:0] Rounded
+    );
+
+    logic Round_Up;
+
+    always_comb begin
+        case (RM)
+            FRM_RTZ: Round_Up = 1'b0;
+            FRM_RDN: Round_Up = Sign && (Guard || Sticky);
+            FRM_RUP: Round_Up = !Sign && (Guard || Sticky);
+            FRM_RMM: Round_Up = Guard;
+            default: Round_Up = Guard && (Sticky || Value[0]); // Nearest even, also the dynamic mode
+        endcase
+        // A carry out of the fraction renormalises into the exponent, out of the largest finite number it makes infinity
+        Rounded = {1'b0, Value} + {32'b0, Round_Up};
+    end
+endmodule
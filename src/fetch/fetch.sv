@@ -5,14 +5,27 @@
 //              Program Counter: 
 //                  Points to the next instruction to be executed.
 //                  Uses synchronous reset.        
+//                  With REGISTERED_REDIRECT set a misprediction resolved in
+//                  execute is held for a cycle before it overwrites the PC.
 //              Branch Predictor:
 //                  Implements a 2-bit saturating counter to predict
 //                  whether a branch will be taken or not.
 //              Branch Target Buffer:
 //                  Stores the target and pc addresses of a branch instruction
 //                  and a valid bit.
+//              Hardware Loop:
+//                  Start, end and count registers for two zero-overhead loops set up by the
+//                  custom-3 LP instructions. Fetch jumps from the last instruction back to the
+//                  start itself, decrementing its own copy of the count, so a loop costs no branch,
+//                  no BTB entry and no mispredict on exit. Execute keeps the resolved count, which
+//                  fetch's copy goes back to on any redirect. The LP instructions write from execute
+//                  and refetch after themselves so nothing is fetched with stale loop registers.
+//              Barrel Fetch:
+//                  Replicated program counters selected round-robin for the
+//                  barrel multithreaded core. There are no hardware loop registers,
+//                  the barrel core decodes the LP instructions as illegal.
 // Author: Luke Shepherd                                                     
-// Date Modified: March 2025                                                                                                                                                                                                                                                       
+// Date Modified: October 2026                                                                                                                                                                                                                                                       
 //////////////////////////////////////////////////////////////////////////////////
 
 import definitions::*;
@@ -25,29 +38,51 @@ module fetch (
     input wire CLK, RST,
     
     // Hazard Control Signals //
-    input wire PC_En,
+    input wire PC_En, Stall_E,
 
     //     Branch Signals     //
     input wire Predict_Taken_E, Branch_Taken_E, Valid_E,
     input wire [31:0] PC_Target_E, PC_Plus_4_E, PC_E,
 
+    //     Hardware Loops     //
+    input wire [ALU_CONTROL_WIDTH-1:0] ALU_Control_E,
+    input wire [4:0] RD_E, RS1_E, // Loop number and the LP.SETUPI end offset
+    input wire [31:0] SrcA_Reg_E, Imm_Ext_E,
+
     /*========================*/
     /*||||||||||||||||||||||||*/
     /*========================*/
     //     Output Signals     //
 
     output wire [31:0] PC_F, PC_Plus_4_F, // Instr_F goes directly to decode since it is read into a register.
-    output wire Predict_Taken_F, Valid_F
+    output wire Predict_Taken_F, Valid_F,
+    output logic Redirect_En // Registered misprediction being applied this cycle, always 0 without REGISTERED_REDIRECT
     
     /*========================*/
     );
 
-    wire [31:0] PC_In, PC_Next, PC_Predict, PC_Prediction;
-    wire Predict_Out, PC_Overwrite_Sel, PC_Sel;
+    wire [31:0] PC_In, PC_Resolved, PC_Redirect, PC_Next, PC_Predict, PC_Prediction, PC_Loop, Loop_Start_F;
+    wire Predict_Out, PC_Overwrite_Sel, PC_Sel, Loop_Back_F;
+    wire Resolve_E; // Execute holds a real instruction that is leaving, rather than one held or behind a pending redirect
+    wire Loop_Setup_E, Mispredict_E, Restore;
+    logic [31:0] Redirect_PC;
 
+    assign Resolve_E = !Redirect_En && !Stall_E;
+    assign Loop_Setup_E = ALU_Control_E inside {ALU_LP_STARTI, ALU_LP_ENDI, ALU_LP_COUNT, ALU_LP_COUNTI, ALU_LP_SETUP, ALU_LP_SETUPI};
+    assign Mispredict_E = (Branch_Taken_E != Predict_Taken_E) || Loop_Setup_E; // Loop setup refetches the next instruction like a mispredict
+    assign Restore = (REGISTERED_REDIRECT) ? Redirect_En : Resolve_E && Mispredict_E; // Fetch is redirected so its loop counts go back to execute's
     assign PC_Sel = !Predict_Taken_E && Branch_Taken_E; // If we didn't predict and we should have taken we need to overwrite
-    assign Predict_Taken_F = Predict_Out && Valid_F; // Only predict if we have a corresponding branch target prediction
-    assign PC_Overwrite_Sel = Predict_Taken_E && !Branch_Taken_E; // Overwrite if we predicted it to be taken but it shouldn't have been
+    assign Predict_Taken_F = Predict_Out && Valid_F && !Loop_Back_F; // Only predict if we have a corresponding branch target prediction, a loop end goes to the start
+    assign PC_Overwrite_Sel = (Predict_Taken_E && !Branch_Taken_E) || Loop_Setup_E; // Overwrite if we predicted it to be taken but it shouldn't have been
+    assign PC_In = (REGISTERED_REDIRECT) ? PC_Redirect : PC_Resolved;
+
+    always_ff @ (posedge CLK) begin // Synchronous reset
+        if (RST)
+            Redirect_En <= 1'b0;
+        else
+            Redirect_En <= REGISTERED_REDIRECT && Resolve_E && Mispredict_E;
+        Redirect_PC <= (Branch_Taken_E) ? PC_Target_E : PC_Plus_4_E;
+    end
 
     program_counter pc (
         .CLK(CLK),
@@ -68,7 +103,7 @@ module fetch (
         .RST(RST),
         .Branch_Taken(Branch_Taken_E),
         .Predict_Taken(Predict_Taken_E),
-        .Valid(Valid_E),
+        .Valid(Valid_E && Resolve_E),
         .Predict_Out(Predict_Out)
     );
 
@@ -78,7 +113,7 @@ module fetch (
         .PC_Target(PC_Target_E),
         .PC_F(PC_F),
         .PC_E(PC_E),
-        .Branch_Taken(Branch_Taken_E),
+        .Branch_Taken(Branch_Taken_E && Resolve_E),
         .Valid(Valid_F),
         .PC_Prediction(PC_Prediction)
     );
@@ -88,13 +123,48 @@ module fetch (
         .SEL(PC_Overwrite_Sel),
         .A(PC_Next),
         .B(PC_Plus_4_E),
-        .OUT(PC_In)
+        .OUT(PC_Resolved)
+    );
+
+    // A registered redirect only has to choose between the prediction and the stored PC
+    mux2_1 mux2_1_pc_redirect (
+        .SEL(Redirect_En),
+        .A(PC_Predict),
+        .B(Redirect_PC),
+        .OUT(PC_Redirect)
+    );
+
+    hardware_loop hwloop (
+        .CLK(CLK),
+        .RST(RST),
+        .PC_En(PC_En),
+        .Restore(Restore),
+        .Resolve_E(Resolve_E),
+        .PC_F(PC_F),
+        .ALU_Control_E(ALU_Control_E),
+        .Loop_E(RD_E[0]),
+        .Offset_E(RS1_E),
+        .PC_E(PC_E),
+        .PC_Plus_4_E(PC_Plus_4_E),
+        .PC_Target_E(PC_Target_E),
+        .SrcA_E(SrcA_Reg_E),
+        .Imm_Ext_E(Imm_Ext_E),
+        .Loop_Back_F(Loop_Back_F),
+        .Loop_Start_F(Loop_Start_F)
+    );
+
+    // At the end of a hardware loop that is going round again we go back to its start
+    mux2_1 mux2_1_pc_loop (
+        .SEL(Loop_Back_F),
+        .A(PC_Plus_4_F),
+        .B(Loop_Start_F),
+        .OUT(PC_Loop)
     );
 
     // If we predict a branch taken we use the predicted PC from the BTB
     mux2_1 mux2_1_pc_predict (
         .SEL(Predict_Taken_F),
-        .A(PC_Plus_4_F),
+        .A(PC_Loop),
         .B(PC_Prediction),
         .OUT(PC_Predict)
     );
@@ -208,3 +278,125 @@ module branch_target_buffer (
         end
     end
 endmodule
+
+module hardware_loop (
+    input wire CLK, RST,
+    input wire PC_En, Restore, Resolve_E,
+    input wire [31:0] PC_F,
+    input wire [ALU_CONTROL_WIDTH-1:0] ALU_Control_E,
+    input wire Loop_E, // Loop an LP instruction writes
+    input wire [4:0] Offset_E, // LP.SETUPI end in words
+    input wire [31:0] PC_E, PC_Plus_4_E, PC_Target_E, SrcA_E, Imm_Ext_E,
+    output logic Loop_Back_F,
+    output logic [31:0] Loop_Start_F
+    );
+
+    logic [31:0] Start [0:HWLOOPS-1];
+    logic [31:0] Last [0:HWLOOPS-1]; // Address of the last instruction, compared with the PC directly
+    logic [31:0] Count [0:HWLOOPS-1]; // Iterations left once the instruction in execute is done
+    logic [31:0] Count_F [0:HWLOOPS-1]; // Iterations left as fetch sees them, ahead of Count by the loop ends in flight
+    logic [31:0] Count_Next [0:HWLOOPS-1];
+    logic [HWLOOPS-1:0] End_F, End_E;
+    logic Back_E;
+
+    // Fetch ends a loop at its last instruction while there are iterations left, an inner loop going round hides an outer one's end
+    always_comb begin
+        Loop_Back_F = 1'b0;
+        Loop_Start_F = Start[0];
+        for (int i = 0; i < HWLOOPS; i++) begin
+            End_F[i] = (PC_F == Last[i]) && (Count_F[i] != 32'b0) && !Loop_Back_F;
+            if (End_F[i] && Count_F[i] != 32'b1) begin
+                Loop_Back_F = 1'b1;
+                Loop_Start_F = Start[i];
+            end
+        end
+    end
+
+    // Execute sees the same loop ends in program order, so the resolved counts follow fetch's without tagging instructions
+    always_comb begin
+        Back_E = 1'b0;
+        for (int i = 0; i < HWLOOPS; i++) begin
+            End_E[i] = (PC_E == Last[i]) && (Count[i] != 32'b0) && !Back_E;
+            if (End_E[i] && Count[i] != 32'b1) Back_E = 1'b1;
+        end
+
+        for (int i = 0; i < HWLOOPS; i++) Count_Next[i] = Count[i];
+        if (Resolve_E) begin
+            case (ALU_Control_E)
+                ALU_LP_COUNT, ALU_LP_SETUP: Count_Next[Loop_E] = SrcA_E;
+                ALU_LP_COUNTI, ALU_LP_SETUPI: Count_Next[Loop_E] = {20'b0, Imm_Ext_E[11:0]};
+                ALU_LP_STARTI, ALU_LP_ENDI: ;
+                default: for (int i = 0; i < HWLOOPS; i++) if (End_E[i]) Count_Next[i] = Count[i] - 1;
+            endcase
+        end
+    end
+
+    always_ff @ (posedge CLK) begin // Synchronous reset
+        if (RST) begin
+            for (int i = 0; i < HWLOOPS; i++) begin
+                Count[i] <= 32'b0; // No loops active
+                Count_F[i] <= 32'b0;
+            end
+        end
+        else begin
+            Count <= Count_Next;
+            if (Restore) // Anything fetched past the redirect is gone along with its loop ends
+                Count_F <= Count_Next;
+            else if (PC_En)
+                for (int i = 0; i < HWLOOPS; i++) if (End_F[i]) Count_F[i] <= Count_F[i] - 1;
+
+            if (Resolve_E) begin
+                case (ALU_Control_E)
+                    ALU_LP_STARTI: Start[Loop_E] <= PC_Target_E;
+                    ALU_LP_ENDI: Last[Loop_E] <= PC_Target_E - 32'h4; // End label is the address after the loop
+                    ALU_LP_SETUP:
+                        begin
+                            Start[Loop_E] <= PC_Plus_4_E;
+                            Last[Loop_E] <= PC_Target_E - 32'h4;
+                        end
+                    ALU_LP_SETUPI:
+                        begin
+                            Start[Loop_E] <= PC_Plus_4_E;
+                            Last[Loop_E] <= PC_E + {25'b0, Offset_E, 2'b0} - 32'h4;
+                        end
+                    default: ;
+                endcase
+            end
+        end
+    end
+endmodule
+
+module barrel_fetch (
+    input wire CLK, RST,
+    input wire Branch_Taken_E,
+    input wire [BARREL_HART_BITS-1:0] Hart_E,
+    input wire [31:0] PC_Target_E,
+    output logic [BARREL_HART_BITS-1:0] Hart_F,
+    output wire [31:0] PC_F, PC_Plus_4_F
+    );
+
+    logic [31:0] pc [0:BARREL_HARTS-1];
+
+    assign PC_F = pc[Hart_F];
+
+    adder32 pc_adder (
+        .A(PC_F),
+        .B(32'h4),
+        .OUT(PC_Plus_4_F)
+    );
+
+    always_ff @ (posedge CLK) begin // Synchronous reset
+        if (RST) begin
+            Hart_F <= '0;
+            for (int i = 0; i < BARREL_HARTS; i++) begin
+                pc[i] <= i * BARREL_HART_STRIDE; // Each hart gets its own entry point
+            end
+        end
+        else begin
+            Hart_F <= (Hart_F == BARREL_HARTS - 1) ? '0 : Hart_F + 1'b1; // Round-robin, harts never stall
+            pc[Hart_F] <= PC_Plus_4_F;
+            if (Branch_Taken_E) // A hart's branch resolves before its next fetch so there is nothing to predict or flush
+                pc[Hart_E] <= {PC_Target_E[31:2], 2'b0}; // Force word alignment, Hart_E is never Hart_F
+        end
+    end
+endmodule
\ No newline at end of file
@@ -2,8 +2,16 @@
 // Third Year Project: RISC-V RV32i Pipelined Processor
 // File: Hazard Control Unit                                                   
 // Description: Evaluates operands to produce pipeline control signals to enable forwarding, stalling and flushing mechanisms.
+//              Each stage has its own stall so a slow memory response only holds the stages behind it,
+//              a stage that stalls while the one after it moves on sends a bubble (flush) forward.
+//              The divider and FP divider are tracked by a one entry scoreboard, only instructions that
+//              use its destination or need either divider themselves wait for it.
+//              Loads that miss the data cache leave the pipeline and are tracked by a scoreboard of their
+//              destinations until written back, only instructions that read or overwrite one wait for it.
+//              A custom instruction holds execute until the CFU responds.
+//              Hardware loop setup flushes what was fetched behind it like a mispredict.
 // Author: Luke Shepherd                                                     
-// Date Modified: March 2025                                                                                                                                                                                                                                                       
+// Date Modified: October 2026                                                                                                                                                                                                                                                       
 //////////////////////////////////////////////////////////////////////////////////
 
 import definitions::*;
@@ -12,9 +20,13 @@ module hazard_control_unit (
     /*========================*/
     //     Input Signals      //
 
+    // Global control signals //
+    input wire CLK, RST,
+
     //     Load RAW Hazard    //
     input wire [4:0] RS1_D, RS2_D, RD_E,
     input wire [1:0] Result_Src_Sel_E, 
+    input wire REG_W_En_E,
 
     //   Regular RAW Hazard   //
     input wire [4:0] RS1_E, RS2_E,       
@@ -22,9 +34,35 @@ module hazard_control_unit (
     input wire REG_W_En_M, 
     input wire [4:0] RD_W,
     input wire REG_W_En_W,
+    input wire [1:0] FWD_SrcA_E, FWD_SrcB_E, // Precomputed selects registered from decode
+
+    //    Divider Scoreboard  //
+    input wire [4:0] RD_D,
+    input wire REG_W_En_D,
+    input wire [ALU_CONTROL_WIDTH-1:0] ALU_Control_D, ALU_Control_E,
+    input wire DIV_Busy, DIV_Done,
+    input wire [4:0] DIV_RD,
+    input wire FDIV_Busy, FDIV_Done,
+    input wire [4:0] FDIV_RD,
+
+    //     Load Scoreboard    //
+    input wire Load_Miss_M, // The load in memory missed and moves on without its result
+    input wire Fill_Done, Fill_W_En, // A missed load's result is waiting, then being written
+    input wire [4:0] Fill_RD,
+
+    // Custom Function Unit   //
+    input wire CFU_Wait_E,
 
     //  Branch Misprediction  //
     input wire Branch_Taken_E, Predict_Taken_E,
+    input wire Redirect_En,
+
+    //   Memory Handshaking   //
+    input wire Instr_Ready_F, // Fetch can accept PC_F this cycle
+    input wire MEM_W_En_M,
+    input wire [1:0] Result_Src_Sel_M, Result_Src_Sel_W,
+    input wire Data_Ready_M, // Data memory can accept the access in memory this cycle
+    input wire Data_Valid_W, // Load data for the instruction in writeback is present
     
     /*========================*/
     /*||||||||||||||||||||||||*/
@@ -33,14 +71,18 @@ module hazard_control_unit (
 
     //    Control Signals     //
     output logic [1:0] FWD_SrcA, FWD_SrcB,
-    output logic Stall_En, Flush_D, Flush_E, PC_En
+    output logic [1:0] FWD_SrcA_D, FWD_SrcB_D, // Selects for the instruction in decode once it reaches execute
+    output logic Stall_En, Flush_D, Flush_E, Flush_M, PC_En,
+    output logic Stall_E, Stall_M, Stall_W, Flush_W
     
     /*========================*/
     );
 
     // Forwarding SrcA for RAW hazards
     always_comb begin
-        if (RS1_E == RD_M && REG_W_En_M && RD_M != 5'b0)  
+        if (PRECOMPUTED_FORWARDING)
+            FWD_SrcA = FWD_SrcA_E; // Already decided a cycle earlier
+        else if (RS1_E == RD_M && REG_W_En_M && RD_M != 5'b0)  
             FWD_SrcA = FWD_MEM;
         else if (RS1_E == RD_W && REG_W_En_W && RD_W != 5'b0)
             FWD_SrcA = FWD_WB;
@@ -50,7 +92,9 @@ module hazard_control_unit (
 
     // Forwarding SrcB for RAW hazards
     always_comb begin
-        if (RS2_E == RD_M && REG_W_En_M && RD_M != 5'b0)  
+        if (PRECOMPUTED_FORWARDING)
+            FWD_SrcB = FWD_SrcB_E;
+        else if (RS2_E == RD_M && REG_W_En_M && RD_M != 5'b0)  
             FWD_SrcB = FWD_MEM;
         else if (RS2_E == RD_W && REG_W_En_W && RD_W != 5'b0)
             FWD_SrcB = FWD_WB;
@@ -58,19 +102,93 @@ module hazard_control_unit (
             FWD_SrcB = FWD_NONE;
     end
 
+    // Precompute SrcA forwarding, whatever is in execute and memory now will be in memory and writeback next cycle
+    always_comb begin
+        if (RS1_D == RD_E && REG_W_En_E && RD_E != 5'b0)  
+            FWD_SrcA_D = FWD_MEM;
+        else if (RS1_D == RD_M && REG_W_En_M && RD_M != 5'b0)
+            FWD_SrcA_D = FWD_WB;
+        else
+            FWD_SrcA_D = FWD_NONE;
+    end
+
+    // Precompute SrcB forwarding
+    always_comb begin
+        if (RS2_D == RD_E && REG_W_En_E && RD_E != 5'b0)  
+            FWD_SrcB_D = FWD_MEM;
+        else if (RS2_D == RD_M && REG_W_En_M && RD_M != 5'b0)
+            FWD_SrcB_D = FWD_WB;
+        else
+            FWD_SrcB_D = FWD_NONE;
+    end
+
+    wire Load_Use_D, Wait_M, Wait_W, Mispredict, Loop_Setup_E;
+    wire DIV_D, DIV_E, DIV_Pending, DIV_Use_D, Write_Slot;
+    wire [4:0] DIV_Pending_RD;
+    logic [31:0] Load_Pending; // Destinations of missed loads still to be written
+    wire [31:0] Load_Pending_Now;
+    wire Load_Overwrite_D, Miss_Use_D;
+
+    // Loads, multiplies and the FPU pipeline only have their result in writeback so a dependent instruction waits a cycle
+    assign Load_Use_D = (RS1_D == RD_E || RS2_D == RD_E) && (Result_Src_Sel_E == RESULT_MEM || Result_Src_Sel_E == RESULT_MUL);
+    // A load that may miss can't be overtaken by a write to its destination (divides write theirs later), a cycle later the scoreboard catches it
+    assign Load_Overwrite_D = DCACHE_NONBLOCKING && (REG_W_En_D || DIV_D) && REG_W_En_E && RD_D == RD_E && Result_Src_Sel_E == RESULT_MEM;
+
+    // A miss in memory counts straight away, a result being written clears as the register file forwards it, x0 never waits
+    assign Load_Pending_Now = ((Load_Pending & ~((Fill_W_En) ? 32'b1 << Fill_RD : 32'b0)) | ((Load_Miss_M) ? 32'b1 << RD_M : 32'b0)) & ~32'b1;
+    assign Miss_Use_D = Load_Pending_Now[RS1_D] || Load_Pending_Now[RS2_D] || ((REG_W_En_D || DIV_D) && Load_Pending_Now[RD_D]);
+
+    always_ff @ (posedge CLK) begin // Synchronous reset
+        if (RST) Load_Pending <= 32'b0;
+        else Load_Pending <= Load_Pending_Now;
+    end
+
+    // A divide in execute is about to start so counts as pending along with one in either divider
+    assign DIV_D = ALU_Control_D inside {ALU_DIV, ALU_DIVU, ALU_REM, ALU_REMU, ALU_FDIV, ALU_FSQRT};
+    assign DIV_E = ALU_Control_E inside {ALU_DIV, ALU_DIVU, ALU_REM, ALU_REMU, ALU_FDIV, ALU_FSQRT};
+    assign DIV_Pending = DIV_E || DIV_Busy || FDIV_Busy;
+    assign DIV_Pending_RD = (DIV_E) ? RD_E : (FDIV_Busy) ? FDIV_RD : DIV_RD;
+    // Reading or overwriting the pending destination has to wait, as does a second divide
+    assign DIV_Use_D = DIV_Pending && (DIV_D || (DIV_Pending_RD != 5'b0 && (RS1_D == DIV_Pending_RD || RS2_D == DIV_Pending_RD || (REG_W_En_D && RD_D == DIV_Pending_RD))));
+    // A finished divide or missed load needs a free write port, if everything in flight writes then make a gap
+    assign Write_Slot = (DIV_Done || FDIV_Done || Fill_Done) && REG_W_En_E && REG_W_En_M && REG_W_En_W;
+
+    assign Wait_M = ((REG_W_En_M && Result_Src_Sel_M == RESULT_MEM) || MEM_W_En_M) && !Data_Ready_M;
+    assign Wait_W = REG_W_En_W && Result_Src_Sel_W == RESULT_MEM && !Data_Valid_W;
+
+    // Back-pressure, a stage has to wait if it is busy or the stage after it is waiting
+    assign Stall_W = Wait_W;
+    assign Stall_M = Stall_W || Wait_M;
+    assign Stall_E = Stall_M || CFU_Wait_E;
+
+    // A held branch doesn't resolve until it leaves execute, a registered redirect only exists once it has
+    assign Loop_Setup_E = ALU_Control_E inside {ALU_LP_STARTI, ALU_LP_ENDI, ALU_LP_COUNT, ALU_LP_COUNTI, ALU_LP_SETUP, ALU_LP_SETUPI};
+    assign Mispredict = (REGISTERED_REDIRECT) ? Redirect_En : ((Branch_Taken_E != Predict_Taken_E) || Loop_Setup_E) && !Stall_E;
+
+    // Send a bubble forward when a stage holds but the one after it moves on
+    assign Flush_W = Stall_M && !Stall_W;
+    assign Flush_M = (Stall_E || (REGISTERED_REDIRECT && Redirect_En)) && !Stall_M; // A registered redirect is a cycle late so a misfetched instruction has reached execute
+
     // Branch misprediction and load hazard handling
     always_comb begin
         // Flush the pipeline of misfetched instructions
-        if (Branch_Taken_E != Predict_Taken_E) begin
+        if (Mispredict) begin
             PC_En = 1'b1;
-            Flush_E = 1'b1;
+            Flush_E = 1'b1; // Also removes a misfetched instruction held in execute
             Flush_D = 1'b1;
             Stall_En = 1'b0;
         end
-        // Insert a bubble in the case of Load RAW hazard
-        else if ((RS1_D == RD_E || RS2_D == RD_E) && Result_Src_Sel_E == RESULT_MEM) begin
+        // Insert a bubble in the case of Load RAW hazard, a divider or missed load hazard or when execute is held
+        else if (Load_Use_D || Load_Overwrite_D || Miss_Use_D || DIV_Use_D || Write_Slot || Stall_E) begin
             PC_En = 1'b0;
             Flush_D = 1'b0; // Don't flush just stall the decode stage
+            Flush_E = !Stall_E;
+            Stall_En = 1'b1;
+        end
+        // Hold fetch and decode while the instruction isn't ready, so the first of a fusible pair waits for the second
+        else if (!Instr_Ready_F) begin
+            PC_En = 1'b0;
+            Flush_D = 1'b0;
             Flush_E = 1'b1;
             Stall_En = 1'b1;
         end
@@ -0,0 +1,419 @@
+//////////////////////////////////////////////////////////////////////////////////                                                           
+// Third Year Project: RISC-V RV32i Pipelined Processor
+// Module: Barrel Core                                           
+// Description: Fine-grained multithreaded variant of the core. Fetch issues one
+//              instruction per cycle from each hart in turn, so with at least 4
+//              harts a hart never has two instructions between decode and memory.
+//              Every result is in the register file before the hart reads it again
+//              and every branch resolves before its next fetch, so the forwarding,
+//              stall and flush logic of the single-threaded core is not needed.
+//              Unsupported:
+//                  There is no divider, so DIV/DIVU/REM/REMU decode as illegal and
+//                  leave state alone. Zfinx is decoded but there is no FP divider,
+//                  so FDIV.S and FSQRT.S are illegal the same way. There is no custom
+//                  function unit, so custom-0 and custom-1 are illegal too, and no
+//                  hardware loop registers, so the LP instructions are as well.
+// Author: Luke Shepherd                                                     
+// Date Created: October 2026                                                                                                                                                                                                                                                           
+//////////////////////////////////////////////////////////////////////////////////
+
+import definitions::*;
+
+module barrel_core (
+    input wire CLK,
+    input wire RST
+    );
+
+    // Hart ID carried alongside each instruction
+    logic [BARREL_HART_BITS-1:0] Hart_F, Hart_D, Hart_E, Hart_M, Hart_W;
+
+    // Fetch Signals
+    wire [31:0] PC_F, PC_Plus_4_F;
+
+    // Decode Signals
+    wire [31:0] Instr_D, PC_D, PC_Plus_4_D;
+    wire REG_W_En_D, MEM_W_En_D, Jump_En_D, Branch_En_D;
+    wire [2:0] MEM_Control_D;
+    wire [ALU_CONTROL_WIDTH-1:0] ALU_Control_D;
+    wire [2:0] Imm_Type_Sel_D;
+    wire Branch_Src_Sel_D;
+    wire ALU_SrcA_Sel_D, ALU_SrcB_Sel_D;
+    wire [1:0] Result_Src_Sel_D;
+    wire [4:0] RD_D, RS1_D, RS2_D;
+    wire [31:0] REG_R_Data1_D, REG_R_Data2_D;
+    wire [31:0] Imm_Ext_D;
+
+    // Execute Signals
+    wire [31:0] PC_E, PC_Plus_4_E;
+    wire REG_W_En_E, MEM_W_En_E, Jump_En_E, Branch_En_E;
+    wire [2:0] MEM_Control_E;
+    wire [ALU_CONTROL_WIDTH-1:0] ALU_Control_E;
+    wire Branch_Src_Sel_E;
+    wire ALU_SrcA_Sel_E, ALU_SrcB_Sel_E;
+    wire [1:0] Result_Src_Sel_E;
+    wire [4:0] RD_E;
+    wire [31:0] REG_R_Data1_E, REG_R_Data2_E;
+    wire [31:0] SrcB_Reg_E;
+    wire [31:0] Imm_Ext_E;
+    wire Branch_Taken_E;
+    wire [31:0] ALU_Out_E, PC_Target_E;
+
+    // Memory Signals
+    wire REG_W_En_M, MEM_W_En_M;
+    wire [2:0] MEM_Control_M;
+    wire [1:0] Result_Src_Sel_M;
+    wire [4:0] RD_M;
+    wire [31:0] SrcB_Reg_M;
+    wire [31:0] ALU_Out_M;
+    wire [31:0] PC_Plus_4_M;
+    wire [31:0] Data_Out_Ext_M;
+
+    // Writeback Signals
+    wire REG_W_En_W;
+    wire [1:0] Result_Src_Sel_W;
+    wire [31:0] Data_Out_Ext_W;
+    wire [31:0] ALU_Out_W;
+    wire [31:0] PC_Plus_4_W;
+    wire [4:0] REG_W_Addr_W;
+    wire [31:0] REG_W_Data_W;
+    wire [31:0] MUL_Out_W;
+    wire FPU_W;
+    wire [31:0] FPU_Out_W;
+
+    assign RD_D  = Instr_D[11:7];
+    assign RS1_D = Instr_D[19:15];
+    assign RS2_D = Instr_D[24:20];
+
+    always_ff @ (posedge CLK) begin // Hart ID pipeline, never stalled or flushed
+        if (RST) begin
+            Hart_D <= '0;
+            Hart_E <= '0;
+            Hart_M <= '0;
+            Hart_W <= '0;
+        end
+        else begin
+            Hart_D <= Hart_F;
+            Hart_E <= Hart_D;
+            Hart_M <= Hart_E;
+            Hart_W <= Hart_M;
+        end
+    end
+
+    barrel_fetch fetch (
+        .CLK(CLK),
+        .RST(RST),
+        .Branch_Taken_E(Branch_Taken_E),
+        .Hart_E(Hart_E),
+        .PC_Target_E(PC_Target_E),
+        // ------------------------------ 
+        .Hart_F(Hart_F),
+        .PC_F(PC_F),
+        .PC_Plus_4_F(PC_Plus_4_F)
+    );
+
+    ifid_register ifid_reg (
+        .CLK(CLK),
+        .RST(RST),
+        .Flush_D(1'b0), 
+        .Stall_En(1'b0), 
+        .PC_F(PC_F),
+        .PC_Plus_4_F(PC_Plus_4_F),
+        .Predict_Taken_F(1'b0), // No prediction, the hart's next fetch waits for the branch anyway
+        .Valid_F(1'b0),
+        // ------------------------------
+        .PC_D(PC_D),
+        .PC_Plus_4_D(PC_Plus_4_D),
+        .Predict_Taken_D(),
+        .Valid_D()
+    );
+
+    control_unit #(
+        .DIV_EN(1'b0),
+        .FDIV_EN(1'b0),
+        .CFU_EN(1'b0),
+        .HWLOOP_EN(1'b0)
+    ) control_unit (
+        .OP(Instr_D[6:0]),
+        .Func3(Instr_D[14:12]),
+        .Func7(Instr_D[31:25]),
+        .RS2(Instr_D[24:20]),
+        .Fuse_Sel(FUSE_NONE), // Consecutive instructions belong to different harts
+        .REG_W_En(REG_W_En_D),
+        .MEM_W_En(MEM_W_En_D),
+        .Jump_En(Jump_En_D),
+        .Branch_En(Branch_En_D),
+        .MEM_Control(MEM_Control_D),
+        .ALU_Control(ALU_Control_D),
+        .Imm_Type_Sel(Imm_Type_Sel_D),
+        .Branch_Src_Sel(Branch_Src_Sel_D),
+        .ALU_SrcA_Sel(ALU_SrcA_Sel_D),
+        .ALU_SrcB_Sel(ALU_SrcB_Sel_D),
+        .Result_Src_Sel(Result_Src_Sel_D)
+    );
+
+    hart_register_file reg_file (
+        .CLK(CLK),
+        .REG_W_En(REG_W_En_W),
+        .Hart_R(Hart_D),
+        .Hart_W(Hart_W),
+        .REG_R_Addr1(RS1_D),
+        .REG_R_Addr2(RS2_D),
+        .REG_W_Addr(REG_W_Addr_W),
+        .REG_W_Data(REG_W_Data_W),
+        .REG_R_Data1(REG_R_Data1_D),
+        .REG_R_Data2(REG_R_Data2_D)
+    );
+
+    immediate_extender imm_extender (
+        .Instr(Instr_D),
+        .Fuse_Instr(32'h0000_0013), // Unused without fusion
+        .Imm_Type_Sel(Imm_Type_Sel_D),
+        .Imm_Ext(Imm_Ext_D)
+    );
+
+    idex_register idex_reg (
+        .CLK(CLK),
+        .RST(RST),
+        .Flush_E(1'b0),
+        .Stall_E(1'b0),
+        .Stall_W(1'b0),
+        .REG_W_En_D(REG_W_En_D),
+        .MEM_W_En_D(MEM_W_En_D),
+        .Jump_En_D(Jump_En_D),
+        .Branch_En_D(Branch_En_D),
+        .MEM_Control_D(MEM_Control_D),
+        .ALU_Control_D(ALU_Control_D),
+        .Branch_Src_Sel_D(Branch_Src_Sel_D),
+        .ALU_SrcA_Sel_D(ALU_SrcA_Sel_D),
+        .ALU_SrcB_Sel_D(ALU_SrcB_Sel_D),
+        .Result_Src_Sel_D(Result_Src_Sel_D),
+        .RD_D(RD_D),
+        .RS1_D(RS1_D),
+        .RS2_D(RS2_D),
+        .REG_R_Data1_D(REG_R_Data1_D),
+        .REG_R_Data2_D(REG_R_Data2_D),
+        .FWD_SrcA_D(FWD_NONE),
+        .FWD_SrcB_D(FWD_NONE),
+        .SrcA_Reg_E(32'b0), // Never held
+        .SrcB_Reg_E(32'b0),
+        .Imm_Ext_D(Imm_Ext_D),
+        .PC_D(PC_D),
+        .PC_Plus_4_D(PC_Plus_4_D),
+        .Predict_Taken_D(1'b0),
+        .Valid_D(1'b0),
+        // ------------------------------
+        .REG_W_En_E(REG_W_En_E),
+        .MEM_W_En_E(MEM_W_En_E),
+        .Jump_En_E(Jump_En_E),
+        .Branch_En_E(Branch_En_E),
+        .MEM_Control_E(MEM_Control_E),
+        .ALU_Control_E(ALU_Control_E),
+        .Branch_Src_Sel_E(Branch_Src_Sel_E),
+        .ALU_SrcA_Sel_E(ALU_SrcA_Sel_E),
+        .ALU_SrcB_Sel_E(ALU_SrcB_Sel_E),
+        .Result_Src_Sel_E(Result_Src_Sel_E),
+        .RD_E(RD_E),
+        .RS1_E(),
+        .RS2_E(),
+        .REG_R_Data1_E(REG_R_Data1_E),
+        .REG_R_Data2_E(REG_R_Data2_E),
+        .FWD_SrcA_E(),
+        .FWD_SrcB_E(),
+        .Imm_Ext_E(Imm_Ext_E),
+        .PC_E(PC_E),
+        .PC_Plus_4_E(PC_Plus_4_E),
+        .Predict_Taken_E(),
+        .Valid_E()
+    );
+
+    execute execute (
+        .Jump_En_E(Jump_En_E),
+        .Branch_En_E(Branch_En_E),
+        .ALU_Control_E(ALU_Control_E),
+        .Branch_Src_Sel_E(Branch_Src_Sel_E),
+        .ALU_SrcA_Sel_E(ALU_SrcA_Sel_E),
+        .ALU_SrcB_Sel_E(ALU_SrcB_Sel_E),
+        .FWD_SrcA(FWD_NONE), // Instructions in M and W always belong to other harts
+        .FWD_SrcB(FWD_NONE),
+        .REG_R_Data1_E(REG_R_Data1_E),
+        .REG_R_Data2_E(REG_R_Data2_E),
+        .ALU_Out_M(ALU_Out_M),
+        .Result_W(REG_W_Data_W),
+        .CFU_Out_E(32'b0), // No custom function unit, custom instructions decode as illegal
+        .Imm_Ext_E(Imm_Ext_E),
+        .PC_E(PC_E),
+        // ------------------------------
+        .Branch_Taken_E(Branch_Taken_E),
+        .ALU_Out_E(ALU_Out_E),
+        .PC_Target_E(PC_Target_E),
+        .SrcA_Reg_E(),
+        .SrcB_Reg_E(SrcB_Reg_E)
+    );
+
+    multiplier multiplier ( // Products reach writeback before the hart's next instruction decodes
+        .CLK(CLK),
+        .Stall_M(1'b0),
+        .Stall_W(1'b0),
+        .ALU_Control_E(ALU_Control_E),
+        .SrcA_E(REG_R_Data1_E),
+        .SrcB_E(REG_R_Data2_E),
+        // ------------------------------
+        .MUL_Out_W(MUL_Out_W)
+    );
+
+    floating_point_unit fpu ( // Like the multiplier, results reach writeback in time
+        .CLK(CLK),
+        .Stall_M(1'b0),
+        .Stall_W(1'b0),
+        .ALU_Control_E(ALU_Control_E),
+        .RM_E(Imm_Ext_E[2:0]),
+        .SrcA_E(REG_R_Data1_E),
+        .SrcB_E(REG_R_Data2_E),
+        // ------------------------------
+        .FPU_W(FPU_W),
+        .FPU_Out_W(FPU_Out_W)
+    );
+
+    exmem_register exmem_reg (
+        .CLK(CLK),
+        .RST(RST),
+        .Flush_M(1'b0),
+        .Stall_M(1'b0),
+        .REG_W_En_E(REG_W_En_E),
+        .MEM_W_En_E(MEM_W_En_E),
+        .MEM_Control_E(MEM_Control_E),
+        .Result_Src_Sel_E(Result_Src_Sel_E),
+        .RD_E(RD_E),
+        .SrcB_Reg_E(SrcB_Reg_E),
+        .ALU_Out_E(ALU_Out_E),
+        .PC_Plus_4_E(PC_Plus_4_E),
+        // ------------------------------
+        .REG_W_En_M(REG_W_En_M),
+        .MEM_W_En_M(MEM_W_En_M),
+        .MEM_Control_M(MEM_Control_M),
+        .Result_Src_Sel_M(Result_Src_Sel_M),
+        .RD_M(RD_M),
+        .SrcB_Reg_M(SrcB_Reg_M),
+        .ALU_Out_M(ALU_Out_M),
+        .PC_Plus_4_M(PC_Plus_4_M)
+    );
+
+    memory #(
+        .ICACHE_EN(1'b0), // Fetch and loads/stores can't wait so use the BRAM directly
+        .DCACHE_EN(1'b0),
+        .STORE_BUFFER_EN(1'b0),
+        .NONBLOCKING(1'b0),
+        .AXI_EN(1'b0) // Keeps the internal BRAM so the bus ports are tied off
+    ) memory (
+        .CLK(CLK),
+        .RST(RST),
+        .MEM_W_En_M(MEM_W_En_M),
+        .MEM_R_En_M(REG_W_En_M && Result_Src_Sel_M == RESULT_MEM),
+        .MEM_Control_M(MEM_Control_M),
+        .SrcB_Reg_M(SrcB_Reg_M),
+        .RD_M(RD_M),
+        .ALU_Out_M(ALU_Out_M),
+        .PC_F(PC_F[31:2]), // PC address to fetch instructions
+        .Flush_D(1'b0), // Decode is never flushed or stalled
+        .Stall_En(1'b0),
+        .Fill_W_En(1'b0),
+        // ------------------------------
+        .Data_Out_Ext_M(Data_Out_Ext_M),
+        .Instr_D(Instr_D), // Output instruction read straight into decode stage
+        .Instr_Ready_F(), // The BRAM never waits, a slower memory would need the harts to stall together
+        .Data_Ready_M(),
+        .Data_Valid_W(),
+        .Data_Fault_M(),
+        .Instr_Fault_D(),
+        .Load_Miss_M(), // No data cache so loads never miss
+        .Fill_Done(),
+        .Fill_RD(),
+        .Fill_Out(),
+        .ICache_Hits(),
+        .ICache_Misses(),
+        .I_ARVALID(),
+        .I_ARREADY(1'b0),
+        .I_ARADDR(),
+        .I_ARLEN(),
+        .I_ARSIZE(),
+        .I_ARBURST(),
+        .I_RVALID(1'b0),
+        .I_RREADY(),
+        .I_RDATA(32'b0),
+        .I_RRESP(2'b0),
+        .I_RLAST(1'b0),
+        .D_ARVALID(),
+        .D_ARREADY(1'b0),
+        .D_ARADDR(),
+        .D_ARLEN(),
+        .D_ARSIZE(),
+        .D_ARBURST(),
+        .D_RVALID(1'b0),
+        .D_RREADY(),
+        .D_RDATA(32'b0),
+        .D_RRESP(2'b0),
+        .D_RLAST(1'b0),
+        .D_AWVALID(),
+        .D_AWREADY(1'b0),
+        .D_AWADDR(),
+        .D_AWLEN(),
+        .D_AWSIZE(),
+        .D_AWBURST(),
+        .D_WVALID(),
+        .D_WREADY(1'b0),
+        .D_WDATA(),
+        .D_WSTRB(),
+        .D_WLAST(),
+        .D_BVALID(1'b0),
+        .D_BREADY(),
+        .D_BRESP(2'b0)
+    );
+
+    memwb_register memwb_reg (
+        .CLK(CLK),
+        .RST(RST),
+        .Flush_W(1'b0),
+        .Stall_W(1'b0),
+        .REG_W_En_M(REG_W_En_M),
+        .Result_Src_Sel_M(Result_Src_Sel_M),
+        .RD_M(RD_M),
+        .Data_Out_Ext_M(Data_Out_Ext_M),
+        .ALU_Out_M(ALU_Out_M),
+        .PC_Plus_4_M(PC_Plus_4_M),
+        // ------------------------------
+        .REG_W_En_W(REG_W_En_W),
+        .Result_Src_Sel_W(Result_Src_Sel_W),
+        .RD_W(REG_W_Addr_W),
+        .Data_Out_Ext_W(Data_Out_Ext_W),
+        .ALU_Out_W(ALU_Out_W),
+        .PC_Plus_4_W(PC_Plus_4_W)
+    );
+
+    writeback writeback (
+        .Result_Src_Sel_W(Result_Src_Sel_W),
+        .REG_W_En_W(REG_W_En_W),
+        .RD_W(REG_W_Addr_W),
+        .Data_Out_Ext_W(Data_Out_Ext_W),
+        .ALU_Out_W(ALU_Out_W),
+        .PC_Plus_4_W(PC_Plus_4_W),
+        .MUL_Out_W(MUL_Out_W),
+        .FPU_W(FPU_W),
+        .FPU_Out_W(FPU_Out_W),
+        .DIV_Done(1'b0), // No divider, divides decode as illegal
+        .DIV_RD(5'b0),
+        .DIV_Out(32'b0),
+        .FDIV_Done(1'b0), // No FP divider either, FP divides and square roots decode as illegal
+        .FDIV_RD(5'b0),
+        .FDIV_Out(32'b0),
+        .Fill_Done(1'b0), // Loads never miss
+        .Fill_RD(5'b0),
+        .Fill_Out(32'b0),
+        // ------------------------------
+        .Result_W(REG_W_Data_W),
+        .REG_W_En(),
+        .REG_W_Addr(),
+        .DIV_W_En(),
+        .FDIV_W_En(),
+        .Fill_W_En()
+    );
+endmodule
@@ -3,52 +3,103 @@
 // Module: Core                                           
 // Description: Instantiates all modules and connects them together               
 // Author: Luke Shepherd                                                     
-// Date Modified: December 2024                                                                                                                                                                                                                                                           
+// Date Modified: October 2026                                                                                                                                                                                                                                                           
 //////////////////////////////////////////////////////////////////////////////////
 
+import definitions::*;
+
 module core (
     input wire CLK,
-    input wire RST
+    input wire RST,
+
+    // AXI4 instruction master, read only, used when AXI_MEMORY is set
+    output wire I_ARVALID,
+    input wire I_ARREADY,
+    output wire [31:0] I_ARADDR,
+    output wire [7:0] I_ARLEN,
+    output wire [2:0] I_ARSIZE,
+    output wire [1:0] I_ARBURST,
+    input wire I_RVALID,
+    output wire I_RREADY,
+    input wire [31:0] I_RDATA,
+    input wire [1:0] I_RRESP,
+    input wire I_RLAST,
+
+    // AXI4 data master
+    output wire D_ARVALID,
+    input wire D_ARREADY,
+    output wire [31:0] D_ARADDR,
+    output wire [7:0] D_ARLEN,
+    output wire [2:0] D_ARSIZE,
+    output wire [1:0] D_ARBURST,
+    input wire D_RVALID,
+    output wire D_RREADY,
+    input wire [31:0] D_RDATA,
+    input wire [1:0] D_RRESP,
+    input wire D_RLAST,
+    output wire D_AWVALID,
+    input wire D_AWREADY,
+    output wire [31:0] D_AWADDR,
+    output wire [7:0] D_AWLEN,
+    output wire [2:0] D_AWSIZE,
+    output wire [1:0] D_AWBURST,
+    output wire D_WVALID,
+    input wire D_WREADY,
+    output wire [31:0] D_WDATA,
+    output wire [3:0] D_WSTRB,
+    output wire D_WLAST,
+    input wire D_BVALID,
+    output wire D_BREADY,
+    input wire [1:0] D_BRESP
     );
 
     // Fetch Signals
     wire PC_En;
     wire [31:0] PC_F, PC_Plus_4_F;
     wire Predict_Taken_F, Valid_F;
+    wire Redirect_En;
+    wire Instr_Ready_F; // Low while the instruction cache refills
+    wire [31:0] ICache_Hits, ICache_Misses;
 
     // Decode Signals
     wire Flush_D, Stall_En;
     wire [31:0] Instr_D, PC_D, PC_Plus_4_D;
     wire REG_W_En_D, MEM_W_En_D, Jump_En_D, Branch_En_D;
     wire [2:0] MEM_Control_D;
-    wire [3:0] ALU_Control_D;
+    wire [ALU_CONTROL_WIDTH-1:0] ALU_Control_D;
     wire Branch_Src_Sel_D;
     wire ALU_SrcA_Sel_D, ALU_SrcB_Sel_D;
     wire [1:0] Result_Src_Sel_D;
     wire [4:0] RD_D, RS1_D, RS2_D;
     wire [31:0] REG_R_Data1_D, REG_R_Data2_D;
+    wire [1:0] FWD_SrcA_D, FWD_SrcB_D;
     wire [31:0] Imm_Ext_D;
     wire Predict_Taken_D, Valid_D;
+    wire Instr_Fault_D; // Fetched from outside the memory, decodes as the illegal instruction
 
     // Execute Signals
-    wire Flush_E;
+    wire Flush_E, Stall_E;
     wire [31:0] PC_E, PC_Plus_4_E;
     wire REG_W_En_E, MEM_W_En_E, Jump_En_E, Branch_En_E;
     wire [2:0] MEM_Control_E;
-    wire [3:0] ALU_Control_E;
+    wire [ALU_CONTROL_WIDTH-1:0] ALU_Control_E;
     wire Branch_Src_Sel_E;
     wire ALU_SrcA_Sel_E, ALU_SrcB_Sel_E;
     wire [1:0] FWD_SrcA, FWD_SrcB;
+    wire [1:0] FWD_SrcA_E, FWD_SrcB_E;
     wire [1:0] Result_Src_Sel_E;
     wire [4:0] RD_E, RS1_E, RS2_E;
     wire [31:0] REG_R_Data1_E, REG_R_Data2_E;
-    wire [31:0] SrcB_Reg_E;
+    wire [31:0] SrcA_Reg_E, SrcB_Reg_E;
     wire [31:0] Imm_Ext_E;
     wire Branch_Taken_E;
     wire [31:0] ALU_Out_E, PC_Target_E;
     wire Predict_Taken_E, Valid_E;
 
     // Memory Signals
+    wire Flush_M, Stall_M;
+    wire Data_Ready_M;
+    wire Data_Fault_M; // Load/store outside the memory, it is dropped or reads zero
     wire REG_W_En_M, MEM_W_En_M;
     wire [2:0] MEM_Control_M;
     wire [1:0] Result_Src_Sel_M;
@@ -57,31 +108,67 @@ module core (
     wire [31:0] ALU_Out_M;
     wire [31:0] PC_Plus_4_M;
     wire [31:0] Data_Out_Ext_M;
+    wire Load_Miss_M; // The load missed the data cache and writes back later
 
     // Writeback Signals
-    wire REG_W_En_W;
+    wire Flush_W, Stall_W;
+    wire Data_Valid_W;
+    wire REG_W_En_W, REG_W_En;
+    wire [4:0] RD_W;
     wire [1:0] Result_Src_Sel_W;
     wire [31:0] Data_Out_Ext_W;
     wire [31:0] ALU_Out_W;
     wire [31:0] PC_Plus_4_W;
     wire [4:0] REG_W_Addr_W;
     wire [31:0] REG_W_Data_W;
+    wire [31:0] MUL_Out_W;
+
+    // Divider Signals
+    wire DIV_Busy, DIV_Done, DIV_W_En;
+    wire [4:0] DIV_RD;
+    wire [31:0] DIV_Out;
+
+    // Floating Point Signals
+    wire FPU_W;
+    wire [31:0] FPU_Out_W;
+    wire FDIV_Busy, FDIV_Done, FDIV_W_En;
+    wire [4:0] FDIV_RD;
+    wire [31:0] FDIV_Out;
+
+    // Missed Load Signals
+    wire Fill_Done, Fill_W_En;
+    wire [4:0] Fill_RD;
+    wire [31:0] Fill_Out;
+
+    // Custom Function Unit Signals
+    wire CFU_Wait_E;
+    wire [31:0] CFU_Out_E;
+    wire CFU_Req_Valid, CFU_Req_Ready, CFU_Rsp_Valid, CFU_Rsp_Ready;
+    wire [CFU_FUNC_WIDTH-1:0] CFU_Req_Func;
+    wire [31:0] CFU_Req_SrcA, CFU_Req_SrcB, CFU_Rsp_Data;
 
     fetch fetch (
         .CLK(CLK),
         .RST(RST),
         .PC_En(PC_En),
+        .Stall_E(Stall_E),
         .Predict_Taken_E(Predict_Taken_E),
         .Branch_Taken_E(Branch_Taken_E),
         .Valid_E(Valid_E),
         .PC_Plus_4_E(PC_Plus_4_E),
         .PC_Target_E(PC_Target_E),
         .PC_E(PC_E),
+        .ALU_Control_E(ALU_Control_E),
+        .RD_E(RD_E),
+        .RS1_E(RS1_E),
+        .SrcA_Reg_E(SrcA_Reg_E),
+        .Imm_Ext_E(Imm_Ext_E),
         // ------------------------------ 
         .PC_F(PC_F),
         .PC_Plus_4_F(PC_Plus_4_F),
         .Predict_Taken_F(Predict_Taken_F),
-        .Valid_F(Valid_F)
+        .Valid_F(Valid_F),
+        .Redirect_En(Redirect_En)
     );
 
     ifid_register ifid_reg (
@@ -102,8 +189,11 @@ module core (
 
     decode decode (
         .CLK(CLK),
+        .RST(RST),
+        .Stall_En(Stall_En),
+        .Flush_D(Flush_D),
         .Instr_D(Instr_D),
-        .REG_W_En_W(REG_W_En_W),
+        .REG_W_En_W(REG_W_En), // Arbitrated write port
         .Result_W(REG_W_Data_W),
         .RD_W(REG_W_Addr_W),
         // ------------------------------
@@ -129,6 +219,8 @@ module core (
         .CLK(CLK),
         .RST(RST),
         .Flush_E(Flush_E),
+        .Stall_E(Stall_E),
+        .Stall_W(Stall_W),
         .REG_W_En_D(REG_W_En_D),
         .MEM_W_En_D(MEM_W_En_D),
         .Jump_En_D(Jump_En_D),
@@ -144,6 +236,10 @@ module core (
         .RS2_D(RS2_D),
         .REG_R_Data1_D(REG_R_Data1_D),
         .REG_R_Data2_D(REG_R_Data2_D),
+        .FWD_SrcA_D(FWD_SrcA_D),
+        .FWD_SrcB_D(FWD_SrcB_D),
+        .SrcA_Reg_E(SrcA_Reg_E),
+        .SrcB_Reg_E(SrcB_Reg_E),
         .Imm_Ext_D(Imm_Ext_D),
         .PC_D(PC_D),
         .PC_Plus_4_D(PC_Plus_4_D),
@@ -165,6 +261,8 @@ module core (
         .RS2_E(RS2_E),
         .REG_R_Data1_E(REG_R_Data1_E),
         .REG_R_Data2_E(REG_R_Data2_E),
+        .FWD_SrcA_E(FWD_SrcA_E),
+        .FWD_SrcB_E(FWD_SrcB_E),
         .Imm_Ext_E(Imm_Ext_E),
         .PC_E(PC_E),
         .PC_Plus_4_E(PC_Plus_4_E),
@@ -185,18 +283,117 @@ module core (
         .REG_R_Data2_E(REG_R_Data2_E),
         .ALU_Out_M(ALU_Out_M),
         .Result_W(REG_W_Data_W),
+        .CFU_Out_E(CFU_Out_E),
         .Imm_Ext_E(Imm_Ext_E),
         .PC_E(PC_E),
         // ------------------------------
         .Branch_Taken_E(Branch_Taken_E),
         .ALU_Out_E(ALU_Out_E),
         .PC_Target_E(PC_Target_E),
+        .SrcA_Reg_E(SrcA_Reg_E),
         .SrcB_Reg_E(SrcB_Reg_E)
     );
 
+    multiplier multiplier (
+        .CLK(CLK),
+        .Stall_M(Stall_M),
+        .Stall_W(Stall_W),
+        .ALU_Control_E(ALU_Control_E),
+        .SrcA_E(SrcA_Reg_E),
+        .SrcB_E(SrcB_Reg_E),
+        // ------------------------------
+        .MUL_Out_W(MUL_Out_W)
+    );
+
+    divider divider (
+        .CLK(CLK),
+        .RST(RST),
+        .Stall_E(Stall_E),
+        .Flush_M(Flush_M),
+        .ALU_Control_E(ALU_Control_E),
+        .RD_E(RD_E),
+        .SrcA_E(SrcA_Reg_E),
+        .SrcB_E(SrcB_Reg_E),
+        .DIV_W_En(DIV_W_En),
+        // ------------------------------
+        .DIV_Busy(DIV_Busy),
+        .DIV_Done(DIV_Done),
+        .DIV_RD(DIV_RD),
+        .DIV_Out(DIV_Out)
+    );
+
+    floating_point_unit fpu (
+        .CLK(CLK),
+        .Stall_M(Stall_M),
+        .Stall_W(Stall_W),
+        .ALU_Control_E(ALU_Control_E),
+        .RM_E(Imm_Ext_E[2:0]), // Rounding mode carried in the immediate
+        .SrcA_E(SrcA_Reg_E),
+        .SrcB_E(SrcB_Reg_E),
+        // ------------------------------
+        .FPU_W(FPU_W),
+        .FPU_Out_W(FPU_Out_W)
+    );
+
+    fp_divider fp_divider (
+        .CLK(CLK),
+        .RST(RST),
+        .Stall_E(Stall_E),
+        .Flush_M(Flush_M),
+        .ALU_Control_E(ALU_Control_E),
+        .RM_E(Imm_Ext_E[2:0]),
+        .RD_E(RD_E),
+        .SrcA_E(SrcA_Reg_E),
+        .SrcB_E(SrcB_Reg_E),
+        .FDIV_W_En(FDIV_W_En),
+        // ------------------------------
+        .FDIV_Busy(FDIV_Busy),
+        .FDIV_Done(FDIV_Done),
+        .FDIV_RD(FDIV_RD),
+        .FDIV_Out(FDIV_Out)
+    );
+
+    cfu_port cfu_port (
+        .CLK(CLK),
+        .RST(RST),
+        .Stall_M(Stall_M),
+        .Redirect_En(Redirect_En),
+        .ALU_Control_E(ALU_Control_E),
+        .SrcA_E(SrcA_Reg_E),
+        .SrcB_E(SrcB_Reg_E),
+        .Imm_Ext_E(Imm_Ext_E),
+        .CFU_Req_Ready(CFU_Req_Ready),
+        .CFU_Rsp_Valid(CFU_Rsp_Valid),
+        .CFU_Rsp_Data(CFU_Rsp_Data),
+        // ------------------------------
+        .CFU_Wait_E(CFU_Wait_E),
+        .CFU_Out_E(CFU_Out_E),
+        .CFU_Req_Valid(CFU_Req_Valid),
+        .CFU_Req_Func(CFU_Req_Func),
+        .CFU_Req_SrcA(CFU_Req_SrcA),
+        .CFU_Req_SrcB(CFU_Req_SrcB),
+        .CFU_Rsp_Ready(CFU_Rsp_Ready)
+    );
+
+    cfu cfu ( // Swap for an application specific unit, see src/cfu/cfu.sv for the interface
+        .CLK(CLK),
+        .RST(RST),
+        .Req_Valid(CFU_Req_Valid),
+        .Req_Func(CFU_Req_Func),
+        .Req_SrcA(CFU_Req_SrcA),
+        .Req_SrcB(CFU_Req_SrcB),
+        .Rsp_Ready(CFU_Rsp_Ready),
+        // ------------------------------
+        .Req_Ready(CFU_Req_Ready),
+        .Rsp_Valid(CFU_Rsp_Valid),
+        .Rsp_Data(CFU_Rsp_Data)
+    );
+
     exmem_register exmem_reg (
         .CLK(CLK),
         .RST(RST),
+        .Flush_M(Flush_M),
+        .Stall_M(Stall_M),
         .REG_W_En_E(REG_W_En_E),
         .MEM_W_En_E(MEM_W_En_E),
         .MEM_Control_E(MEM_Control_E),
@@ -220,21 +417,73 @@ module core (
         .CLK(CLK),
         .RST(RST),
         .MEM_W_En_M(MEM_W_En_M),
+        .MEM_R_En_M(REG_W_En_M && Result_Src_Sel_M == RESULT_MEM), // Bubbles keep a stale select so qualify it like the hazard unit
         .MEM_Control_M(MEM_Control_M),
         .SrcB_Reg_M(SrcB_Reg_M),
-        .ALU_Out_M(ALU_Out_M[11:0]),
-        .PC_F(PC_F[11:2]), // PC address to fetch instructions
+        .RD_M(RD_M),
+        .ALU_Out_M(ALU_Out_M),
+        .PC_F(PC_F[31:2]), // PC address to fetch instructions
         .Flush_D(Flush_D), // Hazard control
         .Stall_En(Stall_En),
+        .Fill_W_En(Fill_W_En),
         // ------------------------------
         .Data_Out_Ext_M(Data_Out_Ext_M),
-        .Instr_D(Instr_D) // Output instruction read straight into decode stage
+        .Instr_D(Instr_D), // Output instruction read straight into decode stage
+        .Instr_Ready_F(Instr_Ready_F),
+        .Data_Ready_M(Data_Ready_M),
+        .Data_Valid_W(Data_Valid_W),
+        .Data_Fault_M(Data_Fault_M),
+        .Instr_Fault_D(Instr_Fault_D),
+        .Load_Miss_M(Load_Miss_M),
+        .Fill_Done(Fill_Done),
+        .Fill_RD(Fill_RD),
+        .Fill_Out(Fill_Out),
+        .ICache_Hits(ICache_Hits),
+        .ICache_Misses(ICache_Misses),
+        .I_ARVALID(I_ARVALID),
+        .I_ARREADY(I_ARREADY),
+        .I_ARADDR(I_ARADDR),
+        .I_ARLEN(I_ARLEN),
+        .I_ARSIZE(I_ARSIZE),
+        .I_ARBURST(I_ARBURST),
+        .I_RVALID(I_RVALID),
+        .I_RREADY(I_RREADY),
+        .I_RDATA(I_RDATA),
+        .I_RRESP(I_RRESP),
+        .I_RLAST(I_RLAST),
+        .D_ARVALID(D_ARVALID),
+        .D_ARREADY(D_ARREADY),
+        .D_ARADDR(D_ARADDR),
+        .D_ARLEN(D_ARLEN),
+        .D_ARSIZE(D_ARSIZE),
+        .D_ARBURST(D_ARBURST),
+        .D_RVALID(D_RVALID),
+        .D_RREADY(D_RREADY),
+        .D_RDATA(D_RDATA),
+        .D_RRESP(D_RRESP),
+        .D_RLAST(D_RLAST),
+        .D_AWVALID(D_AWVALID),
+        .D_AWREADY(D_AWREADY),
+        .D_AWADDR(D_AWADDR),
+        .D_AWLEN(D_AWLEN),
+        .D_AWSIZE(D_AWSIZE),
+        .D_AWBURST(D_AWBURST),
+        .D_WVALID(D_WVALID),
+        .D_WREADY(D_WREADY),
+        .D_WDATA(D_WDATA),
+        .D_WSTRB(D_WSTRB),
+        .D_WLAST(D_WLAST),
+        .D_BVALID(D_BVALID),
+        .D_BREADY(D_BREADY),
+        .D_BRESP(D_BRESP)
     );
 
     memwb_register memwb_reg (
         .CLK(CLK),
         .RST(RST),
-        .REG_W_En_M(REG_W_En_M),
+        .Flush_W(Flush_W),
+        .Stall_W(Stall_W),
+        .REG_W_En_M(REG_W_En_M && !Load_Miss_M), // A missed load's result is written by the arbiter later
         .Result_Src_Sel_M(Result_Src_Sel_M),
         .RD_M(RD_M),
         .Data_Out_Ext_M(Data_Out_Ext_M),
@@ -243,7 +492,7 @@ module core (
         // ------------------------------
         .REG_W_En_W(REG_W_En_W),
         .Result_Src_Sel_W(Result_Src_Sel_W),
-        .RD_W(REG_W_Addr_W),
+        .RD_W(RD_W),
         .Data_Out_Ext_W(Data_Out_Ext_W),
         .ALU_Out_W(ALU_Out_W),
         .PC_Plus_4_W(PC_Plus_4_W)
@@ -251,32 +500,85 @@ module core (
 
     writeback writeback (
         .Result_Src_Sel_W(Result_Src_Sel_W),
+        .REG_W_En_W(REG_W_En_W && !Stall_W), // A load still waiting for its data (Data_Valid_W) writes once it arrives, a divide or fill can use the port meanwhile
+        .RD_W(RD_W),
         .Data_Out_Ext_W(Data_Out_Ext_W),
         .ALU_Out_W(ALU_Out_W),
         .PC_Plus_4_W(PC_Plus_4_W),
+        .MUL_Out_W(MUL_Out_W),
+        .FPU_W(FPU_W),
+        .FPU_Out_W(FPU_Out_W),
+        .DIV_Done(DIV_Done),
+        .DIV_RD(DIV_RD),
+        .DIV_Out(DIV_Out),
+        .FDIV_Done(FDIV_Done),
+        .FDIV_RD(FDIV_RD),
+        .FDIV_Out(FDIV_Out),
+        .Fill_Done(Fill_Done),
+        .Fill_RD(Fill_RD),
+        .Fill_Out(Fill_Out),
         // ------------------------------
-        .Result_W(REG_W_Data_W)
+        .Result_W(REG_W_Data_W),
+        .REG_W_En(REG_W_En),
+        .REG_W_Addr(REG_W_Addr_W),
+        .DIV_W_En(DIV_W_En),
+        .FDIV_W_En(FDIV_W_En),
+        .Fill_W_En(Fill_W_En)
     );
 
     hazard_control_unit hazard_control_unit (
+        .CLK(CLK),
+        .RST(RST),
         .RS1_D(RS1_D),
         .RS2_D(RS2_D),
         .RD_E(RD_E),
         .Result_Src_Sel_E(Result_Src_Sel_E),
+        .REG_W_En_E(REG_W_En_E),
         .RS1_E(RS1_E),
         .RS2_E(RS2_E),
         .RD_M(RD_M),
         .REG_W_En_M(REG_W_En_M),
-        .RD_W(REG_W_Addr_W),
+        .RD_W(RD_W),
         .REG_W_En_W(REG_W_En_W),
+        .FWD_SrcA_E(FWD_SrcA_E),
+        .FWD_SrcB_E(FWD_SrcB_E),
+        .RD_D(RD_D),
+        .REG_W_En_D(REG_W_En_D),
+        .ALU_Control_D(ALU_Control_D),
+        .ALU_Control_E(ALU_Control_E),
+        .DIV_Busy(DIV_Busy),
+        .DIV_Done(DIV_Done),
+        .DIV_RD(DIV_RD),
+        .FDIV_Busy(FDIV_Busy),
+        .FDIV_Done(FDIV_Done),
+        .FDIV_RD(FDIV_RD),
+        .Load_Miss_M(Load_Miss_M),
+        .Fill_Done(Fill_Done),
+        .Fill_W_En(Fill_W_En),
+        .Fill_RD(Fill_RD),
+        .CFU_Wait_E(CFU_Wait_E),
         .Branch_Taken_E(Branch_Taken_E),
         .Predict_Taken_E(Predict_Taken_E),
+        .Redirect_En(Redirect_En),
+        .Instr_Ready_F(Instr_Ready_F),
+        .MEM_W_En_M(MEM_W_En_M),
+        .Result_Src_Sel_M(Result_Src_Sel_M),
+        .Result_Src_Sel_W(Result_Src_Sel_W),
+        .Data_Ready_M(Data_Ready_M),
+        .Data_Valid_W(Data_Valid_W),
         // ------------------------------
         .FWD_SrcA(FWD_SrcA),
         .FWD_SrcB(FWD_SrcB),
+        .FWD_SrcA_D(FWD_SrcA_D),
+        .FWD_SrcB_D(FWD_SrcB_D),
         .Stall_En(Stall_En),
         .Flush_D(Flush_D),
         .Flush_E(Flush_E),
-        .PC_En(PC_En)
+        .Flush_M(Flush_M),
+        .PC_En(PC_En),
+        .Stall_E(Stall_E),
+        .Stall_M(Stall_M),
+        .Stall_W(Stall_W),
+        .Flush_W(Flush_W)
     );
 endmodule
\ No newline at end of file
@@ -0,0 +1,167 @@
+//////////////////////////////////////////////////////////////////////////////////
+// Third Year Project: RISC-V RV32i Pipelined Processor
+// File: AXI4 Master
+// Description: Bridges a cache's one word per request port onto an AXI4 master so refills and write backs can go
+//              to an external memory system. Caches always move whole lines starting from the first word, so a
+//              request for the first word of a line starts an INCR burst of BURST_WORDS beats and the rest of the
+//              line's requests are its beats.
+//              Channels:
+//                  Each address and write data beat is taken into a register that holds VALID and the payload
+//                  steady until the handshake, so the cache can change what it presents without breaking AXI rules.
+//                  Reads and writes run independently, responses are always accepted and passed straight back.
+//              Ordering:
+//                  AXI doesn't order reads against writes, so a line's read waits while a write back of it is still
+//                  waiting on its response (up to AXI_MAX_WRITES tracked).
+//              Only one ID is used and the optional sideband signals are left to the interconnect, error
+//              responses aren't reported.
+// Author: Luke Shepherd
+// Date Created: October 2026
+//////////////////////////////////////////////////////////////////////////////////
+
+import definitions::*;
+
+module axi_master #(
+    parameter int BURST_WORDS = 4 // Words in the cache line, a power of two of at least 2
+    ) (
+    input wire CLK, RST,
+
+    // Cache side
+    input wire Req, Write,
+    input wire [31:2] Addr,
+    input wire [31:0] W_Data,
+    output wire Ready, // Request taken this cycle
+    output wire Valid, // Read response present this cycle
+    output wire [31:0] R_Data,
+
+    // Read address channel
+    output logic ARVALID,
+    input wire ARREADY,
+    output logic [31:0] ARADDR,
+    output wire [7:0] ARLEN,
+    output wire [2:0] ARSIZE,
+    output wire [1:0] ARBURST,
+
+    // Read data channel
+    input wire RVALID,
+    output wire RREADY,
+    input wire [31:0] RDATA,
+    input wire [1:0] RRESP,
+    input wire RLAST,
+
+    // Write address channel
+    output logic AWVALID,
+    input wire AWREADY,
+    output logic [31:0] AWADDR,
+    output wire [7:0] AWLEN,
+    output wire [2:0] AWSIZE,
+    output wire [1:0] AWBURST,
+
+    // Write data channel
+    output logic WVALID,
+    input wire WREADY,
+    output logic [31:0] WDATA,
+    output wire [3:0] WSTRB,
+    output logic WLAST,
+
+    // Write response channel
+    input wire BVALID,
+    output wire BREADY,
+    input wire [1:0] BRESP
+    );
+
+    localparam int BEAT_BITS = $clog2(BURST_WORDS);
+    localparam int LINE_BITS = 30 - BEAT_BITS;
+    localparam int WRITE_BITS = (AXI_MAX_WRITES > 1) ? $clog2(AXI_MAX_WRITES) : 1;
+
+    wire [BEAT_BITS-1:0] Beat;
+    wire First_Beat, Last_Beat;
+    wire AR_Free, AW_Free, W_Free;
+    wire Read_Ready, Write_Ready;
+
+    // Lines written back and waiting on their response, oldest first like the responses
+    logic [LINE_BITS-1:0] Write_Lines [AXI_MAX_WRITES];
+    logic [AXI_MAX_WRITES-1:0] Write_Used;
+    logic [WRITE_BITS-1:0] Write_Head, Write_Tail;
+    logic Write_Match;
+    wire Writes_Full;
+
+    assign Beat = Addr[2 +: BEAT_BITS];
+    assign First_Beat = Beat == '0;
+    assign Last_Beat = Beat == BEAT_BITS'(BURST_WORDS - 1);
+
+    // A register is free if empty or handing over this cycle
+    assign AR_Free = !ARVALID || ARREADY;
+    assign AW_Free = !AWVALID || AWREADY;
+    assign W_Free = !WVALID || WREADY;
+
+    always_comb begin
+        Write_Match = 1'b0;
+        for (int i = 0; i < AXI_MAX_WRITES; i++)
+            if (Write_Used[i] && Write_Lines[i] == Addr[31 -: LINE_BITS]) Write_Match = 1'b1;
+    end
+
+    assign Writes_Full = Write_Used[Write_Tail];
+
+    // The burst is already under way for the rest of a line
+    assign Read_Ready = !First_Beat || (AR_Free && !Write_Match);
+    assign Write_Ready = W_Free && (!First_Beat || (AW_Free && !Writes_Full));
+    assign Ready = (Write) ? Write_Ready : Read_Ready;
+
+    // Fixed burst shape, whole words in whole lines
+    assign ARLEN = 8'(BURST_WORDS - 1);
+    assign ARSIZE = 3'b010;
+    assign ARBURST = 2'b01;
+    assign AWLEN = 8'(BURST_WORDS - 1);
+    assign AWSIZE = 3'b010;
+    assign AWBURST = 2'b01;
+    assign WSTRB = 4'b1111;
+
+    // Responses are never refused
+    assign RREADY = 1'b1;
+    assign BREADY = 1'b1;
+    assign Valid = RVALID;
+    assign R_Data = RDATA;
+
+    always_ff @ (posedge CLK) begin // Synchronous reset
+        if (RST) begin
+            ARVALID <= 1'b0;
+            AWVALID <= 1'b0;
+            WVALID <= 1'b0;
+            Write_Used <= '0;
+            Write_Head <= '0;
+            Write_Tail <= '0;
+        end
+        else begin
+            // Read address
+            if (Req && !Write && First_Beat && Read_Ready) begin
+                ARVALID <= 1'b1;
+                ARADDR <= {Addr, 2'b00};
+            end
+            else if (ARREADY) ARVALID <= 1'b0;
+
+            // Write address, the line is tracked from now until its response
+            if (Req && Write && First_Beat && Write_Ready) begin
+                AWVALID <= 1'b1;
+                AWADDR <= {Addr, 2'b00};
+                Write_Lines[Write_Tail] <= Addr[31 -: LINE_BITS];
+                Write_Used[Write_Tail] <= 1'b1;
+                Write_Tail <= (Write_Tail == WRITE_BITS'(AXI_MAX_WRITES - 1)) ? '0 : Write_Tail + 1'b1;
+            end
+            else if (AWREADY) AWVALID <= 1'b0;
+
+            // Write data
+            if (Req && Write && Write_Ready) begin
+                WVALID <= 1'b1;
+                WDATA <= W_Data;
+                WLAST <= Last_Beat;
+            end
+            else if (WREADY) WVALID <= 1'b0;
+
+            // Write response, frees the oldest line
+            if (BVALID) begin
+                Write_Used[Write_Head] <= 1'b0;
+                Write_Head <= (Write_Head == WRITE_BITS'(AXI_MAX_WRITES - 1)) ? '0 : Write_Head + 1'b1;
+            end
+        end
+    end
+endmodule
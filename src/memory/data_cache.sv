@@ -0,0 +1,276 @@
+//////////////////////////////////////////////////////////////////////////////////
+// Third Year Project: RISC-V RV32i Pipelined Processor
+// File: Data Cache
+// Description: Write-back, write-allocate set associative data cache between the memory stage and the backing
+//              memory, sized by the DCACHE parameters. Tags, valid and dirty bits are read as the address arrives
+//              so a hit is accepted in the same cycle, the data ways are synchronous like the BRAM they replace
+//              so load data is out next cycle. Stores take the byte lanes already worked out for the BRAM and
+//              merge them into the cached word, marking the line dirty.
+//              Miss:
+//                  Each line miss takes a miss status holding register (DCACHE_MSHRS) and its line is refilled a
+//                  word at a time from the start of the line, requests go out back to back and responses are taken
+//                  in order, so the MSHRs are a FIFO in miss order. The victim is an invalid way or the set's
+//                  round-robin choice, never a way already being refilled. A store miss waits (Ready low) for its
+//                  line then merges like a hit, as does any access to a line still on its way.
+//              Non-blocking loads (NONBLOCKING):
+//                  A load miss is accepted straight away with the MSHR it took, its word is kept as it arrives and
+//                  offered on the fill port oldest first until taken, so hits and other misses carry on meanwhile.
+//                  Without it a load miss waits like a store.
+//              Victim write buffer:
+//                  A dirty victim is copied into a small FIFO as the refill starts rather than written back first,
+//                  so the refill only waits on the memory. Buffered lines drain whenever the refill isn't using
+//                  the memory. A miss to a line still in the buffer, or with a dirty victim and the buffer full,
+//                  waits for it to drain so memory is never read stale.
+// Author: Luke Shepherd
+// Date Created: October 2026
+//////////////////////////////////////////////////////////////////////////////////
+
+import definitions::*;
+
+module data_cache #(
+    parameter bit NONBLOCKING = 1'b0
+    ) (
+    input wire CLK, RST,
+
+    // Memory stage side
+    input wire [31:2] Addr,
+    input wire R_En,
+    input wire [3:0] W_En, // Byte lanes to store, none for a load
+    input wire [31:0] W_Data, // Already moved into its lanes
+    output wire Ready, // The access is accepted this cycle
+    output wire [31:0] R_Data, // Word for the previous cycle's accepted load if it hit
+
+    // Missed loads, answered out of order with the pipeline through the fill port
+    output wire Miss, // The accepted load missed
+    output wire [DCACHE_MSHR_BITS-1:0] Miss_ID, // MSHR it took
+    output wire Fill_Valid, // A missed load's word is ready
+    output wire [DCACHE_MSHR_BITS-1:0] Fill_ID,
+    output wire [31:0] Fill_Data,
+    input wire Fill_Taken, // The fill is written back this cycle
+
+    // Backing memory, one word per request, whole words written and read responses in order
+    output wire Mem_Req,
+    output wire Mem_Write,
+    output wire [31:2] Mem_Addr,
+    output wire [31:0] Mem_W_Data,
+    input wire Mem_Ready, // Request taken this cycle
+    input wire Mem_Valid, // Read response present this cycle
+    input wire [31:0] Mem_R_Data
+    );
+
+    localparam int LINE_BITS = DCACHE_TAG_BITS + DCACHE_SET_BITS;
+
+    // Storage, each data way maps to a BRAM
+    logic [DCACHE_TAG_BITS-1:0] Tags [DCACHE_WAYS][DCACHE_SETS];
+    logic [DCACHE_WAYS-1:0] Valid [DCACHE_SETS];
+    logic [DCACHE_WAYS-1:0] Dirty [DCACHE_SETS];
+    logic [DCACHE_WAY_BITS-1:0] Victim [DCACHE_SETS]; // Round-robin replacement
+    logic [31:0] Data [DCACHE_WAYS][DCACHE_SETS * DCACHE_WORDS];
+    logic [31:0] Data_Out [DCACHE_WAYS];
+    wire [DCACHE_SET_BITS+DCACHE_WORD_BITS-1:0] Read_Index;
+
+    // Lookup
+    wire [DCACHE_TAG_BITS-1:0] Tag_M;
+    wire [DCACHE_SET_BITS-1:0] Set_M;
+    wire [DCACHE_WORD_BITS-1:0] Word_M;
+    wire Access, Store, Hit;
+    logic [DCACHE_WAYS-1:0] Way_Hit;
+    logic [DCACHE_WAY_BITS-1:0] Hit_Way, Hit_Way_Reg, Fill_Way;
+
+    // Miss status holding registers, oldest at the head, refill requests and responses each work through them in order
+    logic [LINE_BITS-1:0] MSHR_Line [DCACHE_MSHRS];
+    logic [DCACHE_WAY_BITS-1:0] MSHR_Way [DCACHE_MSHRS];
+    logic [DCACHE_WORD_BITS-1:0] MSHR_Word [DCACHE_MSHRS]; // Word the missed load wants
+    logic [31:0] MSHR_Data [DCACHE_MSHRS];
+    logic [DCACHE_MSHRS-1:0] MSHR_Used, MSHR_Sent, MSHR_Filling, MSHR_Load, MSHR_Got; // Taken, requested, line not in yet, load to answer, its word kept
+    logic [DCACHE_MSHR_BITS-1:0] MSHR_Head, MSHR_Tail, Req_Ptr, Rsp_Ptr;
+    logic [DCACHE_WORD_BITS-1:0] Req_Count, Rsp_Count;
+    logic [DCACHE_WAYS-1:0] Way_Busy; // Ways of the set being refilled
+    logic Pending_Match; // The line is already being refilled
+    wire [DCACHE_SET_BITS-1:0] Rsp_Set;
+    wire MSHR_Full, Start, Refill_Req, Last_Rsp, Victim_Dirty;
+
+    // Eviction, the victim is read out over the first cycles of its refill ahead of the responses
+    logic Evicting, Capturing;
+    logic [DCACHE_SET_BITS-1:0] Evict_Set;
+    logic [DCACHE_WAY_BITS-1:0] Evict_Way;
+    logic [DCACHE_WORD_BITS-1:0] Evict_Count, Capture_Count;
+    logic [DCACHE_WB_BITS-1:0] Evict_Slot;
+
+    // Victim write buffer
+    logic [LINE_BITS-1:0] WB_Line [DCACHE_WB_DEPTH];
+    logic [31:0] WB_Data [DCACHE_WB_DEPTH][DCACHE_WORDS];
+    logic [DCACHE_WB_DEPTH-1:0] WB_Used, WB_Done; // Slot taken, then holding the whole line
+    logic [DCACHE_WB_BITS-1:0] WB_Head, WB_Tail;
+    logic [DCACHE_WORD_BITS-1:0] Drain_Count;
+    logic WB_Match;
+    wire WB_Full, Drain_Req;
+
+    assign Tag_M = Addr[31 -: DCACHE_TAG_BITS];
+    assign Set_M = Addr[DCACHE_WORD_BITS+2 +: DCACHE_SET_BITS];
+    assign Word_M = Addr[2 +: DCACHE_WORD_BITS];
+    assign Store = |W_En;
+    assign Access = R_En || Store;
+
+    always_comb begin
+        Way_Busy = '0;
+        Pending_Match = 1'b0;
+        for (int i = 0; i < DCACHE_MSHRS; i++)
+            if (MSHR_Used[i] && MSHR_Filling[i]) begin
+                if (MSHR_Line[i][DCACHE_SET_BITS-1:0] == Set_M) Way_Busy[MSHR_Way[i]] = 1'b1;
+                if (MSHR_Line[i] == {Tag_M, Set_M}) Pending_Match = 1'b1;
+            end
+        Hit_Way = '0;
+        Fill_Way = (DCACHE_WAYS > 1) ? Victim[Set_M] : '0;
+        for (int w = DCACHE_WAYS - 1; w >= 0; w--) begin // Lowest matching or free invalid way wins
+            Way_Hit[w] = Valid[Set_M][w] && Tags[w][Set_M] == Tag_M;
+            if (Way_Hit[w]) Hit_Way = DCACHE_WAY_BITS'(w);
+            if (!Valid[Set_M][w] && !Way_Busy[w]) Fill_Way = DCACHE_WAY_BITS'(w);
+        end
+        WB_Match = 1'b0;
+        for (int i = 0; i < DCACHE_WB_DEPTH; i++)
+            if (WB_Used[i] && WB_Line[i] == {Tag_M, Set_M}) WB_Match = 1'b1;
+    end
+
+    assign Hit = |Way_Hit;
+    assign Victim_Dirty = Valid[Set_M][Fill_Way] && Dirty[Set_M][Fill_Way];
+    assign WB_Full = WB_Used[WB_Tail];
+    assign MSHR_Full = MSHR_Used[MSHR_Tail];
+
+    // The eviction owns the read port of the data ways and refill responses their write port
+    assign Start = Access && !Hit && !Evicting && !Capturing && !Pending_Match && !WB_Match && !(Victim_Dirty && WB_Full) && !MSHR_Full && !Way_Busy[Fill_Way];
+    assign Miss = NONBLOCKING && R_En && Start;
+    assign Miss_ID = MSHR_Tail;
+    assign Ready = !Access || (Hit && !Evicting && !Capturing && !(Store && Mem_Valid)) || Miss;
+
+    assign Read_Index = (Evicting) ? {Evict_Set, Evict_Count} : {Set_M, Word_M};
+    assign R_Data = Data_Out[Hit_Way_Reg];
+
+    // Refill reads go first, the buffer drains in the gaps
+    assign Refill_Req = MSHR_Used[Req_Ptr] && !MSHR_Sent[Req_Ptr];
+    assign Drain_Req = !Refill_Req && WB_Used[WB_Head] && WB_Done[WB_Head];
+    assign Mem_Req = Refill_Req || Drain_Req;
+    assign Mem_Write = !Refill_Req;
+    assign Mem_Addr = (Refill_Req) ? {MSHR_Line[Req_Ptr], Req_Count} : {WB_Line[WB_Head], Drain_Count};
+    assign Mem_W_Data = WB_Data[WB_Head][Drain_Count];
+    assign Rsp_Set = MSHR_Line[Rsp_Ptr][DCACHE_SET_BITS-1:0];
+    assign Last_Rsp = Mem_Valid && Rsp_Count == DCACHE_WORD_BITS'(DCACHE_WORDS - 1);
+
+    // Missed loads are answered in miss order
+    assign Fill_Valid = MSHR_Used[MSHR_Head] && MSHR_Load[MSHR_Head] && MSHR_Got[MSHR_Head];
+    assign Fill_ID = MSHR_Head;
+    assign Fill_Data = MSHR_Data[MSHR_Head];
+
+    // Data ways, read every cycle and written by stores that hit or refill responses
+    always_ff @ (posedge CLK) begin
+        for (int w = 0; w < DCACHE_WAYS; w++) begin
+            if (Mem_Valid && MSHR_Way[Rsp_Ptr] == w)
+                Data[w][{Rsp_Set, Rsp_Count}] <= Mem_R_Data;
+            else if (Ready && Hit_Way == w) // Byte-enable merge into the cached word
+                for (int b = 0; b < 4; b++)
+                    if (W_En[b]) Data[w][{Set_M, Word_M}][b*8 +: 8] <= W_Data[b*8 +: 8];
+            Data_Out[w] <= Data[w][Read_Index];
+        end
+        Hit_Way_Reg <= Hit_Way;
+        if (Capturing) WB_Data[Evict_Slot][Capture_Count] <= Data_Out[Evict_Way];
+        if (Mem_Valid && MSHR_Word[Rsp_Ptr] == Rsp_Count) MSHR_Data[Rsp_Ptr] <= Mem_R_Data;
+    end
+
+    always_ff @ (posedge CLK) begin // Synchronous reset
+        if (RST) begin
+            for (int s = 0; s < DCACHE_SETS; s++) begin
+                Valid[s] <= '0;
+                Dirty[s] <= '0;
+                Victim[s] <= '0;
+            end
+            MSHR_Used <= '0;
+            MSHR_Head <= '0;
+            MSHR_Tail <= '0;
+            Req_Ptr <= '0;
+            Rsp_Ptr <= '0;
+            Req_Count <= '0;
+            Rsp_Count <= '0;
+            Evicting <= 1'b0;
+            Capturing <= 1'b0;
+            WB_Used <= '0;
+            WB_Done <= '0;
+            WB_Head <= '0;
+            WB_Tail <= '0;
+            Drain_Count <= '0;
+        end
+        else begin
+            if (Start) begin // The chosen way is overwritten so it stops hitting now
+                MSHR_Used[MSHR_Tail] <= 1'b1;
+                MSHR_Sent[MSHR_Tail] <= 1'b0;
+                MSHR_Filling[MSHR_Tail] <= 1'b1;
+                MSHR_Load[MSHR_Tail] <= Miss;
+                MSHR_Got[MSHR_Tail] <= 1'b0;
+                MSHR_Line[MSHR_Tail] <= {Tag_M, Set_M};
+                MSHR_Way[MSHR_Tail] <= Fill_Way;
+                MSHR_Word[MSHR_Tail] <= Word_M;
+                MSHR_Tail <= (MSHR_Tail == DCACHE_MSHR_BITS'(DCACHE_MSHRS - 1)) ? '0 : MSHR_Tail + 1'b1;
+                Tags[Fill_Way][Set_M] <= Tag_M;
+                Valid[Set_M][Fill_Way] <= 1'b0;
+                Dirty[Set_M][Fill_Way] <= 1'b0;
+                Victim[Set_M] <= (DCACHE_WAYS > 1) ? Fill_Way + 1'b1 : '0;
+                if (Victim_Dirty) begin // Take a buffer slot for the old line
+                    Evicting <= 1'b1;
+                    Evict_Count <= '0;
+                    Evict_Set <= Set_M;
+                    Evict_Way <= Fill_Way;
+                    Evict_Slot <= WB_Tail;
+                    WB_Line[WB_Tail] <= {Tags[Fill_Way][Set_M], Set_M};
+                    WB_Used[WB_Tail] <= 1'b1;
+                    WB_Tail <= (WB_Tail == DCACHE_WB_BITS'(DCACHE_WB_DEPTH - 1)) ? '0 : WB_Tail + 1'b1;
+                end
+            end
+
+            // Store hit, the line now differs from memory
+            if (Ready && Hit && Store) Dirty[Set_M][Hit_Way] <= 1'b1;
+
+            // Refill requests and responses, a whole line at a time
+            if (Refill_Req && Mem_Ready) begin
+                Req_Count <= Req_Count + 1'b1;
+                if (Req_Count == DCACHE_WORD_BITS'(DCACHE_WORDS - 1)) begin
+                    MSHR_Sent[Req_Ptr] <= 1'b1;
+                    Req_Ptr <= (Req_Ptr == DCACHE_MSHR_BITS'(DCACHE_MSHRS - 1)) ? '0 : Req_Ptr + 1'b1;
+                end
+            end
+            if (Mem_Valid) begin
+                Rsp_Count <= Rsp_Count + 1'b1;
+                if (MSHR_Load[Rsp_Ptr] && MSHR_Word[Rsp_Ptr] == Rsp_Count) MSHR_Got[Rsp_Ptr] <= 1'b1;
+            end
+            if (Last_Rsp) begin
+                MSHR_Filling[Rsp_Ptr] <= 1'b0;
+                Valid[Rsp_Set][MSHR_Way[Rsp_Ptr]] <= 1'b1;
+                Rsp_Ptr <= (Rsp_Ptr == DCACHE_MSHR_BITS'(DCACHE_MSHRS - 1)) ? '0 : Rsp_Ptr + 1'b1;
+            end
+
+            // The oldest MSHR frees once its line is in and any load it holds is written back
+            if (Fill_Taken) MSHR_Load[MSHR_Head] <= 1'b0;
+            if (MSHR_Used[MSHR_Head] && !MSHR_Filling[MSHR_Head] && !MSHR_Load[MSHR_Head]) begin
+                MSHR_Used[MSHR_Head] <= 1'b0;
+                MSHR_Head <= (MSHR_Head == DCACHE_MSHR_BITS'(DCACHE_MSHRS - 1)) ? '0 : MSHR_Head + 1'b1;
+            end
+
+            // Victim read out, data arrives the cycle after each read
+            if (Evicting) begin
+                Evict_Count <= Evict_Count + 1'b1;
+                if (Evict_Count == DCACHE_WORD_BITS'(DCACHE_WORDS - 1)) Evicting <= 1'b0;
+            end
+            Capturing <= Evicting;
+            Capture_Count <= Evict_Count;
+            if (Capturing && Capture_Count == DCACHE_WORD_BITS'(DCACHE_WORDS - 1)) WB_Done[Evict_Slot] <= 1'b1;
+
+            // Drain the oldest buffered line
+            if (Drain_Req && Mem_Ready) begin
+                Drain_Count <= Drain_Count + 1'b1;
+                if (Drain_Count == DCACHE_WORD_BITS'(DCACHE_WORDS - 1)) begin
+                    WB_Used[WB_Head] <= 1'b0;
+                    WB_Done[WB_Head] <= 1'b0;
+                    WB_Head <= (WB_Head == DCACHE_WB_BITS'(DCACHE_WB_DEPTH - 1)) ? '0 : WB_Head + 1'b1;
+                end
+            end
+        end
+    end
+endmodule
@@ -0,0 +1,150 @@
+//////////////////////////////////////////////////////////////////////////////////
+// Third Year Project: RISC-V RV32i Pipelined Processor
+// File: Instruction Cache
+// Description: Set associative instruction cache between fetch and the backing memory, sized by the ICACHE
+//              parameters. Tags and valid bits are read as PC_F arrives so a hit is known in the same cycle,
+//              the data ways are synchronous like the BRAM they replace so the instruction is out next cycle.
+//              Miss:
+//                  Fetch waits (Hit_F low) while the line is refilled a word at a time from the start of the line,
+//                  requests go out back to back and responses are taken in order. The victim is an invalid way
+//                  or the set's round-robin choice. Hits to other lines carry on during a refill.
+//              Snooping:
+//                  Writes to the backing memory invalidate a matching line, one that hits the line being refilled
+//                  stops it being marked valid, so once a write lands fetch never sees the old instruction. A store
+//                  only lands after the store buffer drains it and the data cache writes its line back, until then
+//                  fetch still sees the old instruction. Self-modifying code has to force the line out of the data
+//                  cache first (FENCE.I is a NOP), e.g. by loading enough lines of the same set.
+//              Counters:
+//                  Hits counts fetches accepted without waiting on a refill, Misses counts refills.
+// Author: Luke Shepherd
+// Date Created: October 2026
+//////////////////////////////////////////////////////////////////////////////////
+
+import definitions::*;
+
+module instruction_cache (
+    input wire CLK, RST,
+
+    // Fetch side
+    input wire [31:2] PC_F,
+    input wire Stall_En, // PC_F is presented again next cycle so this access isn't counted
+    output wire Hit_F, // PC_F is cached, its instruction is out next cycle
+    output wire [31:0] Instr_Out, // Instruction for the previous cycle's PC_F
+
+    // Stores to check against cached lines
+    input wire Snoop_En,
+    input wire [31:2] Snoop_Addr,
+
+    // Backing memory, one word per request and responses in order
+    output wire Fetch_Req,
+    output wire [31:2] Fetch_Addr,
+    input wire Fetch_Ready, // Request taken this cycle
+    input wire Fetch_Valid, // Response present this cycle
+    input wire [31:0] Fetch_Data,
+
+    // Performance counters
+    output logic [31:0] Hits, Misses
+    );
+
+    // Storage, each data way maps to a BRAM
+    logic [ICACHE_TAG_BITS-1:0] Tags [ICACHE_WAYS][ICACHE_SETS];
+    logic [ICACHE_WAYS-1:0] Valid [ICACHE_SETS];
+    logic [ICACHE_WAY_BITS-1:0] Victim [ICACHE_SETS]; // Round-robin replacement
+    logic [31:0] Data [ICACHE_WAYS][ICACHE_SETS * ICACHE_WORDS];
+    logic [31:0] Data_Out [ICACHE_WAYS];
+
+    // Lookup
+    wire [ICACHE_TAG_BITS-1:0] Tag_F, Snoop_Tag;
+    wire [ICACHE_SET_BITS-1:0] Set_F, Snoop_Set;
+    wire [ICACHE_WORD_BITS-1:0] Word_F;
+    logic [ICACHE_WAYS-1:0] Way_Hit, Snoop_Hit;
+    logic [ICACHE_WAY_BITS-1:0] Hit_Way, Hit_Way_Reg, Fill_Way;
+
+    // Refill
+    logic Refilling, Req_Done, Poisoned;
+    logic Waited; // Fetch has been held for a refill, its eventual hit isn't counted
+    logic [ICACHE_TAG_BITS-1:0] Refill_Tag;
+    logic [ICACHE_SET_BITS-1:0] Refill_Set;
+    logic [ICACHE_WAY_BITS-1:0] Refill_Way;
+    logic [ICACHE_WORD_BITS-1:0] Req_Count, Rsp_Count;
+    wire Start, Snoop_Refill, Last_Rsp;
+
+    assign Tag_F = PC_F[31 -: ICACHE_TAG_BITS];
+    assign Set_F = PC_F[ICACHE_WORD_BITS+2 +: ICACHE_SET_BITS];
+    assign Word_F = PC_F[2 +: ICACHE_WORD_BITS];
+    assign Snoop_Tag = Snoop_Addr[31 -: ICACHE_TAG_BITS];
+    assign Snoop_Set = Snoop_Addr[ICACHE_WORD_BITS+2 +: ICACHE_SET_BITS];
+
+    always_comb begin
+        Hit_Way = '0;
+        Fill_Way = (ICACHE_WAYS > 1) ? Victim[Set_F] : '0;
+        for (int w = ICACHE_WAYS - 1; w >= 0; w--) begin // Lowest matching or invalid way wins
+            Way_Hit[w] = Valid[Set_F][w] && Tags[w][Set_F] == Tag_F;
+            Snoop_Hit[w] = Snoop_En && Valid[Snoop_Set][w] && Tags[w][Snoop_Set] == Snoop_Tag;
+            if (Way_Hit[w]) Hit_Way = ICACHE_WAY_BITS'(w);
+            if (!Valid[Set_F][w]) Fill_Way = ICACHE_WAY_BITS'(w);
+        end
+    end
+
+    assign Hit_F = |Way_Hit;
+    assign Instr_Out = Data_Out[Hit_Way_Reg];
+
+    assign Start = !Hit_F && !Refilling;
+    assign Fetch_Req = Refilling && !Req_Done;
+    assign Fetch_Addr = {Refill_Tag, Refill_Set, Req_Count};
+    assign Last_Rsp = Refilling && Fetch_Valid && Rsp_Count == ICACHE_WORD_BITS'(ICACHE_WORDS - 1);
+    assign Snoop_Refill = Snoop_En && Snoop_Tag == Refill_Tag && Snoop_Set == Refill_Set;
+
+    // Data ways, read every cycle and written as refill responses arrive
+    always_ff @ (posedge CLK) begin
+        for (int w = 0; w < ICACHE_WAYS; w++) begin
+            if (Refilling && Fetch_Valid && Refill_Way == w) Data[w][{Refill_Set, Rsp_Count}] <= Fetch_Data;
+            Data_Out[w] <= Data[w][{Set_F, Word_F}];
+        end
+        Hit_Way_Reg <= Hit_Way;
+    end
+
+    always_ff @ (posedge CLK) begin // Synchronous reset
+        if (RST) begin
+            for (int s = 0; s < ICACHE_SETS; s++) begin
+                Valid[s] <= '0;
+                Victim[s] <= '0;
+            end
+            Refilling <= 1'b0;
+            Waited <= 1'b0;
+            Hits <= 32'b0;
+            Misses <= 32'b0;
+        end
+        else begin
+            if (Start) begin // The chosen way is overwritten so it stops hitting now
+                Refilling <= 1'b1;
+                Req_Done <= 1'b0;
+                Poisoned <= 1'b0;
+                Req_Count <= '0;
+                Rsp_Count <= '0;
+                Refill_Tag <= Tag_F;
+                Refill_Set <= Set_F;
+                Refill_Way <= Fill_Way;
+                Tags[Fill_Way][Set_F] <= Tag_F;
+                Valid[Set_F][Fill_Way] <= 1'b0;
+                Victim[Set_F] <= (ICACHE_WAYS > 1) ? Fill_Way + 1'b1 : '0;
+                Misses <= Misses + 1;
+            end
+            if (Fetch_Req && Fetch_Ready) begin
+                Req_Count <= Req_Count + 1'b1;
+                if (Req_Count == ICACHE_WORD_BITS'(ICACHE_WORDS - 1)) Req_Done <= 1'b1;
+            end
+            if (Refilling && Fetch_Valid) Rsp_Count <= Rsp_Count + 1'b1;
+            if (Refilling && Snoop_Refill) Poisoned <= 1'b1;
+            if (Last_Rsp) begin // A store to the line during the refill may have been missed so leave it invalid
+                Refilling <= 1'b0;
+                Valid[Refill_Set][Refill_Way] <= !Poisoned && !Snoop_Refill;
+            end
+            for (int w = 0; w < ICACHE_WAYS; w++)
+                if (Snoop_Hit[w]) Valid[Snoop_Set][w] <= 1'b0;
+            if (!Hit_F) Waited <= 1'b1;
+            else if (!Stall_En) Waited <= 1'b0;
+            if (Hit_F && !Stall_En && !Waited) Hits <= Hits + 1;
+        end
+    end
+endmodule
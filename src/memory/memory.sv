@@ -2,18 +2,43 @@
 // Third Year Project: RISC-V RV32i Pipelined Processor
 // File: Memory                                                   
 // Description: Holds all Memory stage modules.
+//              Memory:
+//                  Acts as a wrapper to the below modules in order to have a simple external interface.
+//                  Handshakes let the pipeline wait on slower memories, the BRAM is always ready.
+//                  Fetch goes through the instruction cache (ICACHE_EN), which waits while it refills,
+//                  or straight to port B. The instruction is held here through stalls and flushes.
+//                  With AXI_MEMORY the caches refill and write back over the AXI4 masters instead of the BRAM.
+//                  Addresses are decoded in full so nothing aliases above the memory size (MEM_ADDR_WIDTH),
+//                  an out of range store is dropped, a load reads zero and a fetch gives the defined
+//                  illegal instruction so none of them can touch state, and each raises a fault flag.
 //              Unified Memory:
-//                  Acts as a wrapper to the below module in order to have a simple external interface.
+//                  Load/store on port A, through the store buffer (STORE_BUFFER_EN) so stores don't wait, then the
+//                  data cache (DCACHE_EN) which waits while it refills and writes back, or straight to the BRAM.
+//                  Non-blocking (NONBLOCKING):
+//                      A load that misses the cache is accepted and leaves the pipeline, its destination, format and
+//                      any store buffer bytes are kept by the MSHR it took. Once its word arrives the finished result
+//                      is offered to the writeback arbiter with its destination until it is written.
+//                  Port B is the backing memory read port for fetch.
+//                  Split (SPLIT_MEMORY):
+//                      Fetch reads a separate instruction memory with its own size and image, leaving the data
+//                      memory's second port free. Loads and stores in the window at IMEM_WINDOW_BASE go uncached
+//                      to the instruction memory's first port so a program can be loaded or read as data.
 //              bytewrite_tdp_ram_rf: 
 //                  A true-dual-port BRAM template from AMD to represent the memory for the processor, 
 //                  load/store uses port A and instruction fetch uses port B.
 // Author: Luke Shepherd
-// Date Modified: March 2025                                                                                                                                                                                                                                                       
+// Date Modified: October 2026                                                                                                                                                                                                                                                       
 //////////////////////////////////////////////////////////////////////////////////
 
 import definitions::*;
 
-module memory (
+module memory #(
+    parameter bit ICACHE_EN = 1'b1, // The barrel core can't wait on fetch so reads port B directly
+    parameter bit DCACHE_EN = 1'b1, // or on loads and stores so uses port A directly
+    parameter bit STORE_BUFFER_EN = 1'b1,
+    parameter bit NONBLOCKING = DCACHE_NONBLOCKING, // Only with the data cache, the pipeline has to track the missed loads
+    parameter bit AXI_EN = AXI_MEMORY // Only with both caches, they move the whole lines the bursts need
+    ) (
     /*========================*/
     //     Input Signals      //
 
@@ -21,21 +46,25 @@ module memory (
     input wire CLK, RST,
 
     //  Control unit signals  //
-    input wire MEM_W_En_M,
+    input wire MEM_W_En_M, MEM_R_En_M,
     input wire [2:0] MEM_Control_M,
 
     //     Register data      //
     input wire [31:0] SrcB_Reg_M,
+    input wire [4:0] RD_M, // Destination kept for a load that misses
 
     //       ALU output       //
-    input wire [11:0] ALU_Out_M,
+    input wire [31:0] ALU_Out_M,
 
     //   PC from fetch stage  //
-    input wire [11:2] PC_F,
+    input wire [31:2] PC_F,
 
     // Hazard control signals //
     input wire Flush_D, Stall_En,
 
+    //   Writeback arbiter    //
+    input wire Fill_W_En, // The missed load's result is being written
+
     /*========================*/
     /*||||||||||||||||||||||||*/
     /*========================*/
@@ -45,97 +74,634 @@ module memory (
     output wire [31:0] Data_Out_Ext_M,
 
     //   Instruction fetches  //
-    output logic [31:0] Instr_D
+    output wire [31:0] Instr_D,
+
+    //      Handshaking       //
+    output wire Instr_Ready_F, // PC_F is accepted and its instruction will be in decode next cycle
+    output wire Data_Ready_M, // The load/store in memory is accepted this cycle
+    output wire Data_Valid_W, // Load data for writeback is present
+
+    //    Range checking      //
+    output wire Data_Fault_M, // The load/store in memory is outside the memory
+    output wire Instr_Fault_D, // The instruction in decode was fetched from outside the memory
+
+    //  Non-blocking loads    //
+    output wire Load_Miss_M, // The load in memory missed and is accepted, it writes back later
+    output wire Fill_Done, // A missed load's result is waiting for the write port
+    output wire [4:0] Fill_RD,
+    output wire [31:0] Fill_Out,
+
+    //  Performance counters  //
+    output wire [31:0] ICache_Hits, ICache_Misses,
+
+    /*========================*/
+    /*||||||||||||||||||||||||*/
+    /*========================*/
+    //      AXI4 Masters      //
+
+    // AXI4 instruction master, read only
+    output wire I_ARVALID,
+    input wire I_ARREADY,
+    output wire [31:0] I_ARADDR,
+    output wire [7:0] I_ARLEN,
+    output wire [2:0] I_ARSIZE,
+    output wire [1:0] I_ARBURST,
+    input wire I_RVALID,
+    output wire I_RREADY,
+    input wire [31:0] I_RDATA,
+    input wire [1:0] I_RRESP,
+    input wire I_RLAST,
+
+    // AXI4 data master
+    output wire D_ARVALID,
+    input wire D_ARREADY,
+    output wire [31:0] D_ARADDR,
+    output wire [7:0] D_ARLEN,
+    output wire [2:0] D_ARSIZE,
+    output wire [1:0] D_ARBURST,
+    input wire D_RVALID,
+    output wire D_RREADY,
+    input wire [31:0] D_RDATA,
+    input wire [1:0] D_RRESP,
+    input wire D_RLAST,
+    output wire D_AWVALID,
+    input wire D_AWREADY,
+    output wire [31:0] D_AWADDR,
+    output wire [7:0] D_AWLEN,
+    output wire [2:0] D_AWSIZE,
+    output wire [1:0] D_AWBURST,
+    output wire D_WVALID,
+    input wire D_WREADY,
+    output wire [31:0] D_WDATA,
+    output wire [3:0] D_WSTRB,
+    output wire D_WLAST,
+    input wire D_BVALID,
+    output wire D_BREADY,
+    input wire [1:0] D_BRESP
 
     /*========================*/
     );
 
-    unified_memory unified_memory (
+    wire Fetch_Req, Fetch_Ready, Fetch_Valid;
+    wire [31:2] Fetch_Addr;
+    wire [31:0] Fetch_Data;
+    wire BRAM_Fetch_Req, BRAM_Fetch_Ready, BRAM_Fetch_Valid; // Port B unless fetch is on the bus
+    wire [31:0] BRAM_Fetch_Data;
+    wire [31:0] Instr_Raw, Instr_Checked; // Instruction for last cycle's PC_F, then with the range check applied
+    wire PC_Out_Of_Range; // Any address bit set above the memory size
+    wire Instr_Store; // Write landing in the memory fetch reads, may change an instruction
+    wire [31:2] Instr_Store_Addr;
+    logic PC_Fault_Reg, Instr_Fault_Reg;
+
+    localparam int FETCH_WORD_ADDR_WIDTH = ((SPLIT_MEMORY) ? IMEM_ADDR_WIDTH : MEM_ADDR_WIDTH) - 2;
+
+    logic [31:0] Instr_Reg; // Hold the instruction in case of stall
+    logic Flush_Reg, Stall_Reg, RST_Reg; // Delay signals 
+
+    generate
+        if (ICACHE_EN) begin : icache_gen
+            instruction_cache icache (
+                .CLK(CLK),
+                .RST(RST),
+                .PC_F(PC_F),
+                .Stall_En(Stall_En),
+                .Hit_F(Instr_Ready_F),
+                .Instr_Out(Instr_Raw),
+                .Snoop_En(Instr_Store),
+                .Snoop_Addr(Instr_Store_Addr),
+                .Fetch_Req(Fetch_Req),
+                .Fetch_Addr(Fetch_Addr),
+                .Fetch_Ready(Fetch_Ready),
+                .Fetch_Valid(Fetch_Valid),
+                .Fetch_Data(Fetch_Data),
+                .Hits(ICache_Hits),
+                .Misses(ICache_Misses)
+            );
+        end
+        else begin : no_icache_gen // Every cycle reads PC_F from port B, the BRAM is always ready
+            assign Fetch_Req = 1'b1;
+            assign Fetch_Addr = PC_F;
+            assign Instr_Raw = Fetch_Data;
+            assign Instr_Ready_F = 1'b1;
+            assign ICache_Hits = 32'b0;
+            assign ICache_Misses = 32'b0;
+        end
+    endgenerate
+
+    generate
+        if (AXI_EN) begin : i_axi_gen
+            axi_master #(
+                .BURST_WORDS(ICACHE_WORDS)
+            ) i_axi (
+                .CLK(CLK),
+                .RST(RST),
+                .Req(Fetch_Req),
+                .Write(1'b0),
+                .Addr(Fetch_Addr),
+                .W_Data(32'b0),
+                .Ready(Fetch_Ready),
+                .Valid(Fetch_Valid),
+                .R_Data(Fetch_Data),
+                .ARVALID(I_ARVALID),
+                .ARREADY(I_ARREADY),
+                .ARADDR(I_ARADDR),
+                .ARLEN(I_ARLEN),
+                .ARSIZE(I_ARSIZE),
+                .ARBURST(I_ARBURST),
+                .RVALID(I_RVALID),
+                .RREADY(I_RREADY),
+                .RDATA(I_RDATA),
+                .RRESP(I_RRESP),
+                .RLAST(I_RLAST),
+                .AWVALID(),
+                .AWREADY(1'b0),
+                .AWADDR(),
+                .AWLEN(),
+                .AWSIZE(),
+                .AWBURST(),
+                .WVALID(),
+                .WREADY(1'b0),
+                .WDATA(),
+                .WSTRB(),
+                .WLAST(),
+                .BVALID(1'b0),
+                .BREADY(),
+                .BRESP(2'b00)
+            );
+            assign BRAM_Fetch_Req = 1'b0;
+        end
+        else begin : no_i_axi_gen
+            assign BRAM_Fetch_Req = Fetch_Req;
+            assign Fetch_Ready = BRAM_Fetch_Ready;
+            assign Fetch_Valid = BRAM_Fetch_Valid;
+            assign Fetch_Data = BRAM_Fetch_Data;
+            assign I_ARVALID = 1'b0;
+            assign I_ARADDR = 32'b0;
+            assign I_ARLEN = 8'b0;
+            assign I_ARSIZE = 3'b0;
+            assign I_ARBURST = 2'b0;
+            assign I_RREADY = 1'b0;
+        end
+    endgenerate
+
+    unified_memory #(
+        .DCACHE_EN(DCACHE_EN),
+        .STORE_BUFFER_EN(STORE_BUFFER_EN),
+        .NONBLOCKING(NONBLOCKING),
+        .AXI_EN(AXI_EN)
+    ) unified_memory (
         .CLK(CLK),
         .RST(RST),
         .MEM_W_En(MEM_W_En_M),
+        .MEM_R_En(MEM_R_En_M),
         .MEM_Control(MEM_Control_M),
         .RW_Addr(ALU_Out_M),
-        .PC_Addr(PC_F),
         .SrcB_Reg_M(SrcB_Reg_M),
-        .Instr(Instr_D),
+        .RD(RD_M),
         .R_Data(Data_Out_Ext_M),
-        .Flush_D(Flush_D),
-        .Stall_En(Stall_En)
+        .Data_Ready(Data_Ready_M),
+        .Data_Fault(Data_Fault_M),
+        .Load_Miss(Load_Miss_M),
+        .Fill_Done(Fill_Done),
+        .Fill_RD(Fill_RD),
+        .Fill_Out(Fill_Out),
+        .Fill_W_En(Fill_W_En),
+        .Instr_Store(Instr_Store),
+        .Instr_Store_Addr(Instr_Store_Addr),
+        .Fetch_Req(BRAM_Fetch_Req),
+        .Fetch_Addr(Fetch_Addr),
+        .Fetch_Ready(BRAM_Fetch_Ready),
+        .Fetch_Valid(BRAM_Fetch_Valid),
+        .Fetch_Data(BRAM_Fetch_Data),
+        .D_ARVALID(D_ARVALID),
+        .D_ARREADY(D_ARREADY),
+        .D_ARADDR(D_ARADDR),
+        .D_ARLEN(D_ARLEN),
+        .D_ARSIZE(D_ARSIZE),
+        .D_ARBURST(D_ARBURST),
+        .D_RVALID(D_RVALID),
+        .D_RREADY(D_RREADY),
+        .D_RDATA(D_RDATA),
+        .D_RRESP(D_RRESP),
+        .D_RLAST(D_RLAST),
+        .D_AWVALID(D_AWVALID),
+        .D_AWREADY(D_AWREADY),
+        .D_AWADDR(D_AWADDR),
+        .D_AWLEN(D_AWLEN),
+        .D_AWSIZE(D_AWSIZE),
+        .D_AWBURST(D_AWBURST),
+        .D_WVALID(D_WVALID),
+        .D_WREADY(D_WREADY),
+        .D_WDATA(D_WDATA),
+        .D_WSTRB(D_WSTRB),
+        .D_WLAST(D_WLAST),
+        .D_BVALID(D_BVALID),
+        .D_BREADY(D_BREADY),
+        .D_BRESP(D_BRESP)
     );
+
+    assign PC_Out_Of_Range = ((PC_F >> FETCH_WORD_ADDR_WIDTH) != 30'b0);
+
+    // Keep whatever decode was given so a stall of any length holds it, a flush gives a NOP
+    always_ff @(posedge CLK) begin
+        if (RST) begin
+            Instr_Reg <= 32'b0;
+            Instr_Fault_Reg <= 1'b0;
+        end else if (Flush_D) begin
+            Instr_Reg <= 32'h0000_0013;
+            Instr_Fault_Reg <= 1'b0;
+        end else begin
+            Instr_Reg <= Instr_D;
+            Instr_Fault_Reg <= Instr_Fault_D;
+        end
+        Stall_Reg <= Stall_En;
+        Flush_Reg <= Flush_D;
+        RST_Reg <= RST;
+        PC_Fault_Reg <= PC_Out_Of_Range;
+    end
+
+    assign Instr_Checked = (PC_Fault_Reg) ? 32'h0000_0000 : Instr_Raw; // Defined illegal instruction, decode leaves state alone
+    assign Instr_D = (Stall_Reg || Flush_Reg || RST_Reg) ? Instr_Reg : Instr_Checked;
+    assign Instr_Fault_D = (Stall_Reg || Flush_Reg || RST_Reg) ? Instr_Fault_Reg : PC_Fault_Reg;
+
+    // Loads are only accepted once their data is a cycle away
+    assign Data_Valid_W = 1'b1;
 endmodule
 
-module unified_memory (
-    input wire CLK, RST, Flush_D, Stall_En, MEM_W_En,
+module unified_memory #(
+    parameter bit DCACHE_EN = 1'b1,
+    parameter bit STORE_BUFFER_EN = 1'b1,
+    parameter bit NONBLOCKING = 1'b0,
+    parameter bit AXI_EN = 1'b0
+    ) (
+    input wire CLK, RST, MEM_W_En, MEM_R_En,
     input wire [2:0] MEM_Control,
-    input wire [11:0] RW_Addr, 
+    input wire [31:0] RW_Addr, 
     input wire [31:0] SrcB_Reg_M,
-    input wire [11:2] PC_Addr,
-    output wire [31:0] Instr,
-    output logic [31:0] R_Data
+    input wire [4:0] RD, // Destination of the load
+    output logic [31:0] R_Data,
+    output wire Data_Ready, // The load/store is accepted this cycle
+    output wire Data_Fault,
+
+    // Missed loads, written back when their word arrives
+    output wire Load_Miss, // The accepted load missed, R_Data won't hold its result
+    output wire Fill_Done,
+    output wire [4:0] Fill_RD,
+    output wire [31:0] Fill_Out,
+    input wire Fill_W_En,
+
+    // Writes reaching the memory fetch reads, for the instruction cache to snoop
+    output wire Instr_Store,
+    output wire [31:2] Instr_Store_Addr,
+
+    // Fetch read port, one word per request
+    input wire Fetch_Req,
+    input wire [31:2] Fetch_Addr,
+    output wire Fetch_Ready, // Request taken this cycle
+    output logic Fetch_Valid, // Response present this cycle
+    output wire [31:0] Fetch_Data,
+
+    // AXI4 data master
+    output wire D_ARVALID,
+    input wire D_ARREADY,
+    output wire [31:0] D_ARADDR,
+    output wire [7:0] D_ARLEN,
+    output wire [2:0] D_ARSIZE,
+    output wire [1:0] D_ARBURST,
+    input wire D_RVALID,
+    output wire D_RREADY,
+    input wire [31:0] D_RDATA,
+    input wire [1:0] D_RRESP,
+    input wire D_RLAST,
+    output wire D_AWVALID,
+    input wire D_AWREADY,
+    output wire [31:0] D_AWADDR,
+    output wire [7:0] D_AWLEN,
+    output wire [2:0] D_AWSIZE,
+    output wire [1:0] D_AWBURST,
+    output wire D_WVALID,
+    input wire D_WREADY,
+    output wire [31:0] D_WDATA,
+    output wire [3:0] D_WSTRB,
+    output wire D_WLAST,
+    input wire D_BVALID,
+    output wire D_BREADY,
+    input wire [1:0] D_BRESP
     );
 
+    localparam int DATA_WORD_ADDR_WIDTH = ((SPLIT_MEMORY) ? DMEM_ADDR_WIDTH : MEM_ADDR_WIDTH) - 2;
+
     wire MEM_W_En0, MEM_W_En1, MEM_W_En2, MEM_W_En3;   // Write enables for each memory
     wire [3:0] W_En;                               // Combined write enables to pass to memory module
-    wire [31:0] Data_Out;
-    wire [31:0] Instr_Temp; 
-    wire [9:0] RW_Word_Addr; 
+    logic [31:0] Data_Out;
+    wire RW_Out_Of_Range; // Any address bit set above the memory size
     logic [1:0] RW_Reg; // Hold the RW address for data selection which must be delayed by one to be after the read (Only need bottom 2 bits)
     logic [2:0] MEM_Control_Reg; // Hold the MEM_Control signal for data selection which must occur after the read (1cycle)
-    logic [31:0] Instr_Reg; // Hold the instruction in case of stall
-    logic Flush_Reg, Stall_Reg, RST_Reg; // Delay signals 
+    logic RW_Fault_Reg; // Range check kept beside the read it belongs to
     logic [31:0] W_Data; // Data to write to memory
+    wire [31:2] Access_Addr; // Load/store after the store buffer
+    wire Access_R_En, Access_Ready;
+    wire [3:0] Access_W_En;
+    wire [31:0] Access_W_Data, Access_R_Data;
+    wire [3:0] Fwd_Lanes; // Bytes of last cycle's load still in the store buffer
+    wire [31:0] Fwd_Data;
+    wire [3:0] Port_W_En; // Port A as driven by the cache or the load/store directly
+    wire [DATA_WORD_ADDR_WIDTH-1:0] Port_Addr;
+    wire [31:0] Port_W_Data, Port_R_Data;
+    wire [31:0] Unified_Fetch_Data;
+    wire IMEM_Window; // Load/store goes to the instruction memory instead
+    wire [3:0] Data_W_En;
+    wire [31:0] IMEM_R_Data;
+    logic IMEM_Window_Reg;
+    wire Fill_Valid; // The cache's oldest missed load has its word
+    wire [DCACHE_MSHR_BITS-1:0] Miss_ID, Fill_ID;
+    wire [31:0] Fill_Data;
+    logic [31:0] Fill_Word;
+    logic Miss_Reg;
+    logic [DCACHE_MSHR_BITS-1:0] Miss_ID_Reg;
+    logic [4:0] RD_Reg;
+    wire Backing_Write; // Word leaving the store buffer and cache for the backing memory
+    wire [31:2] Backing_Write_Addr;
+
+    // What each missed load needs to finish, filled in the cycle after the miss once the store buffer has answered
+    logic [4:0] Miss_RD [DCACHE_MSHRS];
+    logic [2:0] Miss_Control [DCACHE_MSHRS];
+    logic [1:0] Miss_Offset [DCACHE_MSHRS];
+    logic [3:0] Miss_Lanes [DCACHE_MSHRS];
+    logic [31:0] Miss_Fwd_Data [DCACHE_MSHRS];
 
-    assign MEM_W_En0 = MEM_W_En && ((MEM_Control == MEM_BYTE && RW_Addr[1:0] == 2'b00) || 
+    assign IMEM_Window = SPLIT_MEMORY && ((RW_Addr - IMEM_WINDOW_BASE) >> IMEM_ADDR_WIDTH) == 32'b0;
+    assign RW_Out_Of_Range = ((RW_Addr >> (DATA_WORD_ADDR_WIDTH + 2)) != 32'b0) && !IMEM_Window;
+    assign Data_Fault = (MEM_W_En || MEM_R_En) && RW_Out_Of_Range;
+
+    assign MEM_W_En0 = MEM_W_En && !RW_Out_Of_Range && ((MEM_Control == MEM_BYTE && RW_Addr[1:0] == 2'b00) || 
                                     (MEM_Control == MEM_HALFWORD && RW_Addr[1] == 1'b0) || 
                                     (MEM_Control == MEM_WORD));
-    assign MEM_W_En1 = MEM_W_En && ((MEM_Control == MEM_BYTE && RW_Addr[1:0] == 2'b01) || 
+    assign MEM_W_En1 = MEM_W_En && !RW_Out_Of_Range && ((MEM_Control == MEM_BYTE && RW_Addr[1:0] == 2'b01) || 
                                     (MEM_Control == MEM_HALFWORD && RW_Addr[1] == 1'b0) || 
                                     (MEM_Control == MEM_WORD));
-    assign MEM_W_En2 = MEM_W_En && ((MEM_Control == MEM_BYTE && RW_Addr[1:0] == 2'b10) || 
+    assign MEM_W_En2 = MEM_W_En && !RW_Out_Of_Range && ((MEM_Control == MEM_BYTE && RW_Addr[1:0] == 2'b10) || 
                                     (MEM_Control == MEM_HALFWORD && RW_Addr[1] == 1'b1) || 
                                     (MEM_Control == MEM_WORD));
-    assign MEM_W_En3 = MEM_W_En && ((MEM_Control == MEM_BYTE && RW_Addr[1:0] == 2'b11) || 
+    assign MEM_W_En3 = MEM_W_En && !RW_Out_Of_Range && ((MEM_Control == MEM_BYTE && RW_Addr[1:0] == 2'b11) || 
                                     (MEM_Control == MEM_HALFWORD && RW_Addr[1] == 1'b1) || 
                                     (MEM_Control == MEM_WORD));
 
     assign W_En = {MEM_W_En3, MEM_W_En2, MEM_W_En1, MEM_W_En0};
+    assign Data_W_En = (IMEM_Window) ? 4'b0000 : W_En; // Window accesses skip the store buffer and cache
 
     always_ff @(posedge CLK) begin
         if (RST) begin
-            Instr_Reg <= 32'b0;
-        end else if (Flush_D) begin
-            Instr_Reg <= 32'h0000_0013;
-        end else begin
-            Instr_Reg <= Instr_Temp;
+            Fetch_Valid <= 1'b0;
+            Miss_Reg <= 1'b0;
         end
-        Stall_Reg <= Stall_En;
-        Flush_Reg <= Flush_D;
-        RST_Reg <= RST;
+        else begin
+            Fetch_Valid <= Fetch_Req; // Port B answers the next cycle
+            Miss_Reg <= Load_Miss;
+        end
+        Miss_ID_Reg <= Miss_ID;
+        RD_Reg <= RD;
         RW_Reg <= RW_Addr[1:0];
         MEM_Control_Reg <= MEM_Control;
+        RW_Fault_Reg <= RW_Out_Of_Range;
+        IMEM_Window_Reg <= IMEM_Window;
+    end
+
+    assign Fetch_Ready = 1'b1;
+
+    // Split memories only change instructions through the window, which is written straight away. Unified ones change
+    // when a store finally lands, after the store buffer and once the data cache writes its line back
+    assign Instr_Store = (SPLIT_MEMORY) ? IMEM_Window && W_En != 4'b0000 : Backing_Write;
+    assign Instr_Store_Addr = (SPLIT_MEMORY) ? RW_Addr[31:2] - IMEM_WINDOW_BASE[31:2] : Backing_Write_Addr;
+
+    generate
+        if (STORE_BUFFER_EN) begin : sb_gen
+            // Out of range accesses never reach the buffer, W_En already leaves them out
+            store_buffer sb (
+                .CLK(CLK),
+                .RST(RST),
+                .Addr(RW_Addr[31:2]),
+                .R_En(MEM_R_En && !RW_Out_Of_Range && !IMEM_Window),
+                .W_En(Data_W_En),
+                .W_Data(W_Data),
+                .Ready(Data_Ready),
+                .Fwd_Lanes(Fwd_Lanes),
+                .Fwd_Data(Fwd_Data),
+                .Out_Addr(Access_Addr),
+                .Out_R_En(Access_R_En),
+                .Out_W_En(Access_W_En),
+                .Out_W_Data(Access_W_Data),
+                .Out_Ready(Access_Ready)
+            );
+        end
+        else begin : no_sb_gen
+            assign Access_Addr = RW_Addr[31:2];
+            assign Access_R_En = MEM_R_En && !RW_Out_Of_Range && !IMEM_Window;
+            assign Access_W_En = Data_W_En;
+            assign Access_W_Data = W_Data;
+            assign Data_Ready = Access_Ready;
+            assign Fwd_Lanes = 4'b0000;
+            assign Fwd_Data = 32'b0;
+        end
+
+        if (DCACHE_EN) begin : dcache_gen
+            wire Cache_Req, Cache_Write, Cache_Ready, Cache_Valid;
+            wire [31:2] Cache_Addr;
+            wire [31:0] Cache_W_Data, Cache_R_Data;
+
+            data_cache #(
+                .NONBLOCKING(NONBLOCKING)
+            ) dcache (
+                .CLK(CLK),
+                .RST(RST),
+                .Addr(Access_Addr),
+                .R_En(Access_R_En),
+                .W_En(Access_W_En),
+                .W_Data(Access_W_Data),
+                .Ready(Access_Ready),
+                .R_Data(Access_R_Data),
+                .Miss(Load_Miss),
+                .Miss_ID(Miss_ID),
+                .Fill_Valid(Fill_Valid),
+                .Fill_ID(Fill_ID),
+                .Fill_Data(Fill_Data),
+                .Fill_Taken(Fill_W_En),
+                .Mem_Req(Cache_Req),
+                .Mem_Write(Cache_Write),
+                .Mem_Addr(Cache_Addr),
+                .Mem_W_Data(Cache_W_Data),
+                .Mem_Ready(Cache_Ready),
+                .Mem_Valid(Cache_Valid),
+                .Mem_R_Data(Cache_R_Data)
+            );
+
+            if (AXI_EN) begin : d_axi_gen
+                axi_master #(
+                    .BURST_WORDS(DCACHE_WORDS)
+                ) d_axi (
+                    .CLK(CLK),
+                    .RST(RST),
+                    .Req(Cache_Req),
+                    .Write(Cache_Write),
+                    .Addr(Cache_Addr),
+                    .W_Data(Cache_W_Data),
+                    .Ready(Cache_Ready),
+                    .Valid(Cache_Valid),
+                    .R_Data(Cache_R_Data),
+                    .ARVALID(D_ARVALID),
+                    .ARREADY(D_ARREADY),
+                    .ARADDR(D_ARADDR),
+                    .ARLEN(D_ARLEN),
+                    .ARSIZE(D_ARSIZE),
+                    .ARBURST(D_ARBURST),
+                    .RVALID(D_RVALID),
+                    .RREADY(D_RREADY),
+                    .RDATA(D_RDATA),
+                    .RRESP(D_RRESP),
+                    .RLAST(D_RLAST),
+                    .AWVALID(D_AWVALID),
+                    .AWREADY(D_AWREADY),
+                    .AWADDR(D_AWADDR),
+                    .AWLEN(D_AWLEN),
+                    .AWSIZE(D_AWSIZE),
+                    .AWBURST(D_AWBURST),
+                    .WVALID(D_WVALID),
+                    .WREADY(D_WREADY),
+                    .WDATA(D_WDATA),
+                    .WSTRB(D_WSTRB),
+                    .WLAST(D_WLAST),
+                    .BVALID(D_BVALID),
+                    .BREADY(D_BREADY),
+                    .BRESP(D_BRESP)
+                );
+
+                assign Port_W_En = 4'b0000; // Port A is left idle
+                assign Port_Addr = '0;
+                assign Port_W_Data = 32'b0;
+                assign Backing_Write = Cache_Req && Cache_Write && Cache_Ready;
+            end
+            else begin : d_bram_gen
+                logic Port_Valid;
+
+                always_ff @(posedge CLK) begin
+                    if (RST) Port_Valid <= 1'b0;
+                    else Port_Valid <= Cache_Req && !Cache_Write; // Port A answers reads the next cycle
+                end
+
+                assign Port_W_En = (Cache_Req && Cache_Write) ? 4'b1111 : 4'b0000; // Whole lines are written back
+                assign Port_Addr = Cache_Addr[DATA_WORD_ADDR_WIDTH+1:2];
+                assign Port_W_Data = Cache_W_Data;
+                assign Cache_Ready = 1'b1;
+                assign Cache_Valid = Port_Valid;
+                assign Cache_R_Data = Port_R_Data;
+                assign Backing_Write = Cache_Req && Cache_Write;
+            end
+
+            assign Backing_Write_Addr = Cache_Addr;
+        end
+        else begin : no_dcache_gen // Single cycle BRAM never has to wait
+            assign Port_W_En = Access_W_En;
+            assign Port_Addr = Access_Addr[DATA_WORD_ADDR_WIDTH+1:2];
+            assign Port_W_Data = Access_W_Data;
+            assign Access_R_Data = Port_R_Data;
+            assign Access_Ready = 1'b1;
+            assign Load_Miss = 1'b0; // Nothing to miss
+            assign Miss_ID = '0;
+            assign Fill_Valid = 1'b0;
+            assign Fill_ID = '0;
+            assign Fill_Data = 32'b0;
+            assign Backing_Write = Access_W_En != 4'b0000;
+            assign Backing_Write_Addr = Access_Addr;
+        end
+
+        if (!(AXI_EN && DCACHE_EN)) begin : no_d_axi_gen
+            assign D_ARVALID = 1'b0;
+            assign D_ARADDR = 32'b0;
+            assign D_ARLEN = 8'b0;
+            assign D_ARSIZE = 3'b0;
+            assign D_ARBURST = 2'b0;
+            assign D_RREADY = 1'b0;
+            assign D_AWVALID = 1'b0;
+            assign D_AWADDR = 32'b0;
+            assign D_AWLEN = 8'b0;
+            assign D_AWSIZE = 3'b0;
+            assign D_AWBURST = 2'b0;
+            assign D_WVALID = 1'b0;
+            assign D_WDATA = 32'b0;
+            assign D_WSTRB = 4'b0;
+            assign D_WLAST = 1'b0;
+            assign D_BREADY = 1'b0;
+        end
+    endgenerate
+
+    always_comb begin // Buffered stores are newer than memory so their bytes win
+        for (int b = 0; b < 4; b++) begin
+            Data_Out[b*8 +: 8] = (Fwd_Lanes[b]) ? Fwd_Data[b*8 +: 8] : Access_R_Data[b*8 +: 8];
+            Fill_Word[b*8 +: 8] = (Miss_Lanes[Fill_ID][b]) ? Miss_Fwd_Data[Fill_ID][b*8 +: 8] : Fill_Data[b*8 +: 8];
+        end
+        if (IMEM_Window_Reg) Data_Out = IMEM_R_Data;
     end
 
-    assign Instr = (Stall_Reg || Flush_Reg || RST_Reg) ? Instr_Reg : Instr_Temp;
+    always_ff @(posedge CLK) begin
+        if (Miss_Reg) begin
+            Miss_RD[Miss_ID_Reg] <= RD_Reg;
+            Miss_Control[Miss_ID_Reg] <= MEM_Control_Reg;
+            Miss_Offset[Miss_ID_Reg] <= RW_Reg;
+            Miss_Lanes[Miss_ID_Reg] <= Fwd_Lanes;
+            Miss_Fwd_Data[Miss_ID_Reg] <= Fwd_Data;
+        end
+    end
 
-    assign RW_Word_Addr[9:0] = RW_Addr >> 2;
+    assign Fill_Done = Fill_Valid;
+    assign Fill_RD = Miss_RD[Fill_ID];
+    assign Fill_Out = extend_load(Miss_Control[Fill_ID], Miss_Offset[Fill_ID], Fill_Word);
 
-    bytewrite_tdp_ram_rf memory (
+    bytewrite_tdp_ram_rf #(
+        .ADDR_WIDTH(DATA_WORD_ADDR_WIDTH),
+        .INIT_FILE((SPLIT_MEMORY) ? DMEM_INIT_FILE : MEM_INIT_FILE)
+    ) memory (
         .clkA(CLK),                     // Use the same clock for both ports but keep the template untouched.
         .enaA(1'b1),                    // Always enabled since the design has no mechanism for seperate port enables
-        .weA(W_En),
-        .addrA(RW_Word_Addr),
-        .dinA(W_Data),
-        .doutA(Data_Out),               // Data operation output
+        .weA(Port_W_En),
+        .addrA(Port_Addr),
+        .dinA(Port_W_Data),
+        .doutA(Port_R_Data),            // Data operation output
 
         .clkB(CLK),
-        .enaB(1'b1),
+        .enaB(!SPLIT_MEMORY),           // Free for other uses once fetch has its own memory
         .weB(4'b0000),                  // Don't write with this port since only dual read is needed, theres probably a better way to do it.
-        .addrB(PC_Addr),                // PC for fetch address 
+        .addrB(Fetch_Addr[DATA_WORD_ADDR_WIDTH+1:2]), // Fetch or cache refill address 
         .dinB(W_Data),                  // Not really used but kept for the template structure, won't be enabled anyway
-        .doutB(Instr_Temp)              // Instruction fetch
+        .doutB(Unified_Fetch_Data)      // Instruction fetch
     );
 
+    generate
+        if (SPLIT_MEMORY) begin : split_gen
+            bytewrite_tdp_ram_rf #(
+                .ADDR_WIDTH(IMEM_ADDR_WIDTH - 2),
+                .INIT_FILE(IMEM_INIT_FILE)
+            ) instruction_memory (
+                .clkA(CLK),
+                .enaA(1'b1),
+                .weA((IMEM_Window) ? W_En : 4'b0000), // Program loading
+                .addrA(RW_Addr[IMEM_ADDR_WIDTH-1:2]),
+                .dinA(W_Data),
+                .doutA(IMEM_R_Data),
+
+                .clkB(CLK),
+                .enaB(1'b1),
+                .weB(4'b0000),
+                .addrB(Fetch_Addr[IMEM_ADDR_WIDTH-1:2]), // Fetch or cache refill address
+                .dinB(32'b0),
+                .doutB(Fetch_Data)
+            );
+        end
+        else begin : unified_gen
+            assign Fetch_Data = Unified_Fetch_Data;
+            assign IMEM_R_Data = 32'b0;
+        end
+    endgenerate
+
     always_comb begin // Move data to correct position for write
         case (MEM_Control) // Use current cycle version of this signal unlike below 
             MEM_BYTE: 
@@ -156,35 +722,41 @@ module unified_memory (
     end
 
     always_comb begin
-        case (MEM_Control_Reg)
+        if (RW_Fault_Reg) R_Data = 32'b0; // Nothing there to read
+        else R_Data = extend_load(MEM_Control_Reg, RW_Reg, Data_Out);
+    end
+
+    // Pick out the loaded byte or halfword and extend it, for loads that hit now and missed loads later
+    function automatic logic [31:0] extend_load(input logic [2:0] control, input logic [1:0] offset, input logic [31:0] word);
+        case (control)
             MEM_BYTE: 
-                case (RW_Reg[1:0])
-                    2'b00: R_Data = {{24{Data_Out[7]}}, Data_Out[7:0]};
-                    2'b01: R_Data = {{24{Data_Out[15]}}, Data_Out[15:8]};
-                    2'b10: R_Data = {{24{Data_Out[23]}}, Data_Out[23:16]};
-                    default: R_Data = {{24{Data_Out[31]}}, Data_Out[31:24]};
+                case (offset)
+                    2'b00: return {{24{word[7]}}, word[7:0]};
+                    2'b01: return {{24{word[15]}}, word[15:8]};
+                    2'b10: return {{24{word[23]}}, word[23:16]};
+                    default: return {{24{word[31]}}, word[31:24]};
                 endcase
             MEM_BYTE_UNSIGNED: 
-                case (RW_Reg[1:0])
-                    2'b00: R_Data = {24'b0, Data_Out[7:0]};
-                    2'b01: R_Data = {24'b0, Data_Out[15:8]};
-                    2'b10: R_Data = {24'b0, Data_Out[23:16]};
-                    default: R_Data = {24'b0, Data_Out[31:24]};
+                case (offset)
+                    2'b00: return {24'b0, word[7:0]};
+                    2'b01: return {24'b0, word[15:8]};
+                    2'b10: return {24'b0, word[23:16]};
+                    default: return {24'b0, word[31:24]};
                 endcase
             MEM_HALFWORD:
-                case (RW_Reg[1])
-                    1'b0: R_Data = {{16{Data_Out[15]}}, Data_Out[15:8], Data_Out[7:0]};
-                    default: R_Data = {{16{Data_Out[31]}}, Data_Out[31:24], Data_Out[23:16]};
+                case (offset[1])
+                    1'b0: return {{16{word[15]}}, word[15:8], word[7:0]};
+                    default: return {{16{word[31]}}, word[31:24], word[23:16]};
                 endcase
             MEM_HALFWORD_UNSIGNED: 
-                case (RW_Reg[1])
-                    1'b0: R_Data = {16'b0, Data_Out[15:8], Data_Out[7:0]};
-                    default: R_Data = {16'b0, Data_Out[31:24], Data_Out[23:16]};
+                case (offset[1])
+                    1'b0: return {16'b0, word[15:8], word[7:0]};
+                    default: return {16'b0, word[31:24], word[23:16]};
                 endcase
-            MEM_WORD: R_Data = Data_Out; // Kept for clarity
-            default: R_Data = 32'b0;
+            MEM_WORD: return word; // Kept for clarity
+            default: return 32'b0;
         endcase
-    end
+    endfunction
 endmodule
 
 module bytewrite_tdp_ram_rf // True-Dual-Port BRAM with Byte-wide Write Enable (AMD Template)
@@ -194,7 +766,8 @@ module bytewrite_tdp_ram_rf // True-Dual-Port BRAM with Byte-wide Write Enable (
     parameter COL_WIDTH = 8,
     parameter ADDR_WIDTH = 10,
     // Addr Width in bits : 2^ADDR_WIDTH = RAM Depth
-    parameter DATA_WIDTH = NUM_COL*COL_WIDTH // Data Width in bits
+    parameter DATA_WIDTH = NUM_COL*COL_WIDTH, // Data Width in bits
+    parameter INIT_FILE = "/home/s53512ls/git/RV32i-Processor/src/test.hex"
     //----------------------------------------------------------------------
     ) (
     input clkA,
@@ -216,7 +789,7 @@ module bytewrite_tdp_ram_rf // True-Dual-Port BRAM with Byte-wide Write Enable (
     reg [DATA_WIDTH-1:0] ram_block [(2**ADDR_WIDTH)-1:0];
 
     initial begin // Note from AMD: The external file initializing the RAM needs to be in bit vector form. External files in integer or hex format do not work.
-        $readmemh("/home/s53512ls/git/RV32i-Processor/src/test.hex",ram_block);
+        $readmemh(INIT_FILE,ram_block);
     end
 
     integer i;
@@ -0,0 +1,114 @@
+//////////////////////////////////////////////////////////////////////////////////
+// Third Year Project: RISC-V RV32i Pipelined Processor
+// File: Store Buffer
+// Description: Small FIFO between the memory stage and the data memory (or data cache) so a store completes in
+//              memory as soon as it is buffered and is written in the background, sized by STORE_BUFFER_DEPTH.
+//              Entries hold a word address with the byte lanes and lane aligned data worked out for the BRAM.
+//              Draining:
+//                  The oldest entry is written whenever the memory stage isn't loading, loads go first since the
+//                  pipeline waits on them. A store only waits when the buffer is full.
+//              Coalescing:
+//                  A store to a word already buffered merges its lanes into that entry instead of taking a new
+//                  one, unless that entry is being written this cycle, so runs of byte stores become one write
+//                  and a word is never in more than one entry.
+//              Forwarding:
+//                  Every load checks the buffer and the matching entry's lanes and data are handed on with the
+//                  load's read, to be merged over the word read from memory the next cycle.
+// Author: Luke Shepherd
+// Date Created: October 2026
+//////////////////////////////////////////////////////////////////////////////////
+
+import definitions::*;
+
+module store_buffer (
+    input wire CLK, RST,
+
+    // Memory stage side
+    input wire [31:2] Addr,
+    input wire R_En,
+    input wire [3:0] W_En, // Byte lanes to store, none for a load
+    input wire [31:0] W_Data, // Already moved into its lanes
+    output wire Ready, // The access is accepted this cycle
+    output logic [3:0] Fwd_Lanes, // Bytes of the previous cycle's load that come from the buffer
+    output logic [31:0] Fwd_Data,
+
+    // Data memory side, loads pass straight through and drained stores take the gaps
+    output wire [31:2] Out_Addr,
+    output wire Out_R_En,
+    output wire [3:0] Out_W_En,
+    output wire [31:0] Out_W_Data,
+    input wire Out_Ready
+    );
+
+    logic [31:2] SB_Addr [STORE_BUFFER_DEPTH];
+    logic [3:0] SB_Lanes [STORE_BUFFER_DEPTH];
+    logic [31:0] SB_Data [STORE_BUFFER_DEPTH];
+    logic [STORE_BUFFER_DEPTH-1:0] SB_Valid;
+    logic [STORE_BUFFER_BITS-1:0] Head, Tail;
+
+    wire Store, Drain, Drain_Taken, Full;
+    logic Coalesce;
+    logic [STORE_BUFFER_BITS-1:0] Coalesce_Slot;
+    logic [3:0] Fwd_Lanes_Next;
+    logic [31:0] Fwd_Data_Next;
+
+    assign Store = |W_En;
+    assign Full = SB_Valid[Tail];
+    assign Drain = !R_En && SB_Valid[Head];
+    assign Drain_Taken = Drain && Out_Ready;
+
+    assign Out_Addr = (Drain) ? SB_Addr[Head] : Addr;
+    assign Out_R_En = R_En;
+    assign Out_W_En = (Drain) ? SB_Lanes[Head] : 4'b0000;
+    assign Out_W_Data = SB_Data[Head];
+
+    assign Ready = (Store) ? (Coalesce || !Full) : (!R_En || Out_Ready);
+
+    always_comb begin
+        // A merge into the head would be lost if it is written now, it leaves so the store takes a new entry
+        Coalesce = 1'b0;
+        Coalesce_Slot = '0;
+        for (int i = 0; i < STORE_BUFFER_DEPTH; i++)
+            if (SB_Valid[i] && SB_Addr[i] == Addr && (STORE_BUFFER_BITS'(i) != Head || !Drain_Taken)) begin
+                Coalesce = 1'b1;
+                Coalesce_Slot = STORE_BUFFER_BITS'(i);
+            end
+
+        Fwd_Lanes_Next = 4'b0000;
+        Fwd_Data_Next = 32'b0;
+        for (int i = 0; i < STORE_BUFFER_DEPTH; i++)
+            if (R_En && SB_Valid[i] && SB_Addr[i] == Addr) begin
+                Fwd_Lanes_Next = SB_Lanes[i];
+                Fwd_Data_Next = SB_Data[i];
+            end
+    end
+
+    always_ff @ (posedge CLK) begin // Synchronous reset
+        if (RST) begin
+            SB_Valid <= '0;
+            Head <= '0;
+            Tail <= '0;
+            Fwd_Lanes <= 4'b0000;
+        end
+        else begin
+            if (Drain_Taken) begin
+                SB_Valid[Head] <= 1'b0;
+                Head <= Head + 1'b1;
+            end
+            if (Store && Coalesce) begin
+                SB_Lanes[Coalesce_Slot] <= SB_Lanes[Coalesce_Slot] | W_En;
+                for (int b = 0; b < 4; b++)
+                    if (W_En[b]) SB_Data[Coalesce_Slot][b*8 +: 8] <= W_Data[b*8 +: 8];
+            end
+            else if (Store && !Full) begin
+                SB_Valid[Tail] <= 1'b1;
+                SB_Addr[Tail] <= Addr;
+                SB_Lanes[Tail] <= W_En;
+                SB_Data[Tail] <= W_Data;
+                Tail <= Tail + 1'b1;
+            end
+            Fwd_Lanes <= Fwd_Lanes_Next;
+        end
+        Fwd_Data <= Fwd_Data_Next;
+    end
+endmodule
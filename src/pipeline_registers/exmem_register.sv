@@ -4,7 +4,7 @@
 // Description: Holds the control signals, ALU output and other signals to be passed to the memory stage.
 //              Uses synchronous reset to ensure a safe state.     
 // Author: Luke Shepherd                                                     
-// Date Modified: March 2025                                                                                                                                                                                                                                                           
+// Date Modified: October 2026                                                                                                                                                                                                                                                           
 //////////////////////////////////////////////////////////////////////////////////
 
 import definitions::*;
@@ -16,6 +16,9 @@ module exmem_register (
     // Global control signals //
     input wire CLK, RST,
 
+    // Hazard control signals //
+    input wire Flush_M, Stall_M,
+
     //  Control unit signals  //
     input wire REG_W_En_E, MEM_W_En_E, 
     input wire [2:0] MEM_Control_E,
@@ -54,14 +57,20 @@ module exmem_register (
     /*========================*/
     );
 
-    always_ff @ (posedge CLK) begin // Synchronous reset 
-        REG_W_En_M <= (RST) ? 1'b0 : REG_W_En_E; // If reset ensure no state changing
-        MEM_W_En_M <= (RST) ? 1'b0 : MEM_W_En_E;
-        MEM_Control_M <= MEM_Control_E;
-        Result_Src_Sel_M <= Result_Src_Sel_E;
-        RD_M <= RD_E;
-        SrcB_Reg_M <= SrcB_Reg_E;
-        ALU_Out_M <= ALU_Out_E;
-        PC_Plus_4_M <= PC_Plus_4_E;
+    always_ff @ (posedge CLK) begin // Synchronous reset and flush
+        if (RST || Flush_M) begin // If reset or flushed ensure no state changing
+            REG_W_En_M <= 1'b0; 
+            MEM_W_En_M <= 1'b0;
+        end
+        else if (!Stall_M) begin
+            REG_W_En_M <= REG_W_En_E;
+            MEM_W_En_M <= MEM_W_En_E;
+            MEM_Control_M <= MEM_Control_E;
+            Result_Src_Sel_M <= Result_Src_Sel_E;
+            RD_M <= RD_E;
+            SrcB_Reg_M <= SrcB_Reg_E;
+            ALU_Out_M <= ALU_Out_E;
+            PC_Plus_4_M <= PC_Plus_4_E;
+        end
     end
 endmodule
\ No newline at end of file
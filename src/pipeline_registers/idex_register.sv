@@ -3,8 +3,10 @@
 // File: Decode to Execute Pipeline Register                                          
 // Description: Holds the instruction, control signals and program counters to be passed to the execute stage.
 //              Uses synchronous reset and flush.     
+//              While stalled the instruction is held but picks up its forwarded operands so 
+//              nothing is lost when the producer leaves writeback.
 // Author: Luke Shepherd                                                     
-// Date Modified: March 2025                                                                                                                                                                                                                                                           
+// Date Modified: October 2026                                                                                                                                                                                                                                                           
 //////////////////////////////////////////////////////////////////////////////////
 
 import definitions::*;
@@ -16,10 +18,13 @@ module idex_register (
     // Global control signals //
     input wire CLK, RST, Flush_E,
 
+    // Hazard control signals //
+    input wire Stall_E, Stall_W,
+
     //  Control unit signals  //
     input wire REG_W_En_D, MEM_W_En_D, Jump_En_D, Branch_En_D,
     input wire [2:0] MEM_Control_D,
-    input wire [3:0] ALU_Control_D,
+    input wire [ALU_CONTROL_WIDTH-1:0] ALU_Control_D,
     input wire Branch_Src_Sel_D,
     input wire ALU_SrcA_Sel_D, ALU_SrcB_Sel_D,
     input wire [1:0] Result_Src_Sel_D,
@@ -27,6 +32,8 @@ module idex_register (
     //      Register data     //
     input wire [4:0] RD_D, RS1_D, RS2_D,
     input wire [31:0] REG_R_Data1_D, REG_R_Data2_D,
+    input wire [1:0] FWD_SrcA_D, FWD_SrcB_D,
+    input wire [31:0] SrcA_Reg_E, SrcB_Reg_E, // Forwarded operands of the held instruction
 
     //   Extended Immediate   //
     input wire [31:0] Imm_Ext_D,
@@ -43,7 +50,7 @@ module idex_register (
     //  Control unit signals  //
     output logic REG_W_En_E, MEM_W_En_E, Jump_En_E, Branch_En_E,
     output logic [2:0] MEM_Control_E,
-    output logic [3:0] ALU_Control_E,
+    output logic [ALU_CONTROL_WIDTH-1:0] ALU_Control_E,
     output logic Branch_Src_Sel_E,
     output logic ALU_SrcA_Sel_E, ALU_SrcB_Sel_E,
     output logic [1:0] Result_Src_Sel_E,
@@ -51,6 +58,7 @@ module idex_register (
     //      Register data     //
     output logic [4:0] RD_E, RS1_E, RS2_E,
     output logic [31:0] REG_R_Data1_E, REG_R_Data2_E,
+    output logic [1:0] FWD_SrcA_E, FWD_SrcB_E,
 
     //   Extended Immediate   //
     output logic [31:0] Imm_Ext_E,
@@ -70,6 +78,11 @@ module idex_register (
             Branch_En_E <= 1'b0;
             Predict_Taken_E <= 1'b0; // Prevent headaches from uninitialized values used in fetch
             Valid_E <= 1'b0; 
+            FWD_SrcA_E <= FWD_NONE;
+            FWD_SrcB_E <= FWD_NONE;
+            ALU_Control_E <= ALU_ADD;
+            Result_Src_Sel_E <= RESULT_ALU;
+            RD_E <= 5'b0;
         end
         else if (Flush_E) begin // Insert NOP (ADDI x0, x0, 0) and set PC for clarity
             REG_W_En_E <= 1'b0; // Disable state changing signals
@@ -78,9 +91,20 @@ module idex_register (
             Branch_En_E <= 1'b0;
             Predict_Taken_E <= 1'b0; // Prevents hazard control logic constantly evaluating to flush
             Valid_E <= 1'b0;
+            FWD_SrcA_E <= FWD_NONE; // The bubble reads nothing
+            FWD_SrcB_E <= FWD_NONE;
+            ALU_Control_E <= ALU_ADD; // A bubble must not look like the load or divide it replaced to the hazard unit
+            Result_Src_Sel_E <= RESULT_ALU;
+            RD_E <= 5'b0;
             PC_E <= 32'h2A2A_2A2A; // Debug pattern for clarity
             PC_Plus_4_E <= 32'h2A2A_2A2A;
         end
+        else if (Stall_E) begin // Hold, the forwarded values are final unless a load in writeback is still waiting
+            REG_R_Data1_E <= SrcA_Reg_E;
+            REG_R_Data2_E <= SrcB_Reg_E;
+            FWD_SrcA_E <= (FWD_SrcA_E == FWD_WB && Stall_W) ? FWD_WB : FWD_NONE;
+            FWD_SrcB_E <= (FWD_SrcB_E == FWD_WB && Stall_W) ? FWD_WB : FWD_NONE;
+        end
         else begin
             REG_W_En_E <= REG_W_En_D; 
             MEM_W_En_E <= MEM_W_En_D;
@@ -97,6 +121,8 @@ module idex_register (
             RS2_E <= RS2_D;
             REG_R_Data1_E <= REG_R_Data1_D;
             REG_R_Data2_E <= REG_R_Data2_D;
+            FWD_SrcA_E <= FWD_SrcA_D;
+            FWD_SrcB_E <= FWD_SrcB_D;
             Imm_Ext_E <= Imm_Ext_D;
             PC_E <= PC_D; 
             PC_Plus_4_E <= PC_Plus_4_D;
@@ -4,7 +4,7 @@
 // Description: Holds the control signals, Data output, ALU output and other signals to be passed to the writeback stage.  
 //              Uses synchronous reset to ensure a safe state.  
 // Author: Luke Shepherd                                                     
-// Date Modified: March 2025                                                                                                                                                                                                                                                           
+// Date Modified: October 2026                                                                                                                                                                                                                                                           
 //////////////////////////////////////////////////////////////////////////////////
 
 import definitions::*;
@@ -16,6 +16,9 @@ module memwb_register (
     // Global control signals //
     input wire CLK, RST,
 
+    // Hazard control signals //
+    input wire Flush_W, Stall_W,
+
     //  Control unit signals  //
     input wire REG_W_En_M,
     input wire [1:0] Result_Src_Sel_M,
@@ -56,12 +59,16 @@ module memwb_register (
     /*========================*/
     );
 
-    always_ff @ (posedge CLK) begin // Synchronous reset 
-        REG_W_En_W <= (RST) ? 1'b0 : REG_W_En_M; // If reset ensure no state changing
-        Result_Src_Sel_W <= Result_Src_Sel_M;
-        RD_W <= RD_M;
-        ALU_Out_W <= ALU_Out_M;
-        PC_Plus_4_W <= PC_Plus_4_M;
+    always_ff @ (posedge CLK) begin // Synchronous reset and flush
+        if (RST || Flush_W) // If reset or flushed ensure no state changing
+            REG_W_En_W <= 1'b0;
+        else if (!Stall_W) begin
+            REG_W_En_W <= REG_W_En_M;
+            Result_Src_Sel_W <= Result_Src_Sel_M;
+            RD_W <= RD_M;
+            ALU_Out_W <= ALU_Out_M;
+            PC_Plus_4_W <= PC_Plus_4_M;
+        end
     end
 
     assign Data_Out_Ext_W = Data_Out_Ext_M; // Bypass the synchronous requirement since it is already synchronously stored into a register
@@ -1,9 +1,12 @@
 //////////////////////////////////////////////////////////////////////////////////                                                           
 // Third Year Project: RISC-V RV32i Pipelined Processor
 // File: Writeback                                                   
-// Description: Holds the Writeback stage multiplexer.
+// Description: Holds the Writeback stage multiplexer and the register file write port arbiter.
+//              A finished divide takes the write port on any cycle the instruction in writeback doesn't need it.
+//              FP divides and square roots do the same, the scoreboard only lets one of the two be in flight.
+//              Loads that missed the data cache come last, their result waits in its MSHR until the port is free.
 // Author: Luke Shepherd
-// Date Modified: March 2025                                                                                                                                                                                                                                                       
+// Date Modified: October 2026                                                                                                                                                                                                                                                       
 //////////////////////////////////////////////////////////////////////////////////
 
 import definitions::*;
@@ -12,8 +15,10 @@ module writeback (
     /*========================*/
     //     Input Signals      //
 
-    //   Control unit signal  //
+    //  Control unit signals  //
     input wire [1:0] Result_Src_Sel_W,
+    input wire REG_W_En_W,
+    input wire [4:0] RD_W,
 
     //      Data memory       //
     input wire [31:0] Data_Out_Ext_W,
@@ -24,21 +29,61 @@ module writeback (
     //          PC            //
     input wire [31:0] PC_Plus_4_W,
 
+    //   Multiplier output    //
+    input wire [31:0] MUL_Out_W,
+
+    //  FPU pipeline output   //
+    input wire FPU_W,
+    input wire [31:0] FPU_Out_W,
+
+    //    Divider output      //
+    input wire DIV_Done,
+    input wire [4:0] DIV_RD,
+    input wire [31:0] DIV_Out,
+
+    //   FP divider output    //
+    input wire FDIV_Done,
+    input wire [4:0] FDIV_RD,
+    input wire [31:0] FDIV_Out,
+
+    //   Missed load result   //
+    input wire Fill_Done,
+    input wire [4:0] Fill_RD,
+    input wire [31:0] Fill_Out,
+
     /*========================*/
     /*||||||||||||||||||||||||*/
     /*========================*/
     //     Output Signals     //
 
-    output logic [31:0] Result_W
+    output logic [31:0] Result_W,
+    output logic REG_W_En, // Register file write port
+    output logic [4:0] REG_W_Addr,
+    output logic DIV_W_En, // Divider result is being written
+    output logic FDIV_W_En, // FP divider result is being written
+    output logic Fill_W_En // Missed load result is being written
 
     /*========================*/
     );
 
+    assign DIV_W_En = DIV_Done && !REG_W_En_W;
+    assign FDIV_W_En = FDIV_Done && !REG_W_En_W && !DIV_Done;
+    assign Fill_W_En = Fill_Done && !REG_W_En_W && !DIV_Done && !FDIV_Done;
+    assign REG_W_En = REG_W_En_W || DIV_W_En || FDIV_W_En || Fill_W_En;
+    assign REG_W_Addr = (DIV_W_En) ? DIV_RD : (FDIV_W_En) ? FDIV_RD : (Fill_W_En) ? Fill_RD : RD_W;
+
     always_comb begin
-        case (Result_Src_Sel_W)
+        if (DIV_W_En)
+            Result_W = DIV_Out;
+        else if (FDIV_W_En)
+            Result_W = FDIV_Out;
+        else if (Fill_W_En)
+            Result_W = Fill_Out;
+        else case (Result_Src_Sel_W)
             RESULT_ALU: Result_W = ALU_Out_W;
             RESULT_MEM: Result_W = Data_Out_Ext_W;
             RESULT_PC4: Result_W = PC_Plus_4_W;
+            RESULT_MUL: Result_W = (FPU_W) ? FPU_Out_W : MUL_Out_W;
             default: Result_W = 32'h0000_0000; 
         endcase
     end
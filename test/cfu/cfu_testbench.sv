@@ -0,0 +1,121 @@
+//////////////////////////////////////////////////////////////////////////////////
+// Third Year Project: RISC-V RV32i Pipelined Processor
+// File: Custom Function Unit Testbench
+// Description: Ensures that the example CFU computes each function and keeps to the valid/ready handshake,
+//              answering single cycle functions the cycle after the request and a word CRC a byte per cycle.
+// Author: Luke Shepherd
+// Date Created: October 2026
+//////////////////////////////////////////////////////////////////////////////////
+
+import definitions::*;
+
+module cfu_testbench;
+    logic CLK, RST; // Wrap module with a clock to control the sim more easily and better represent the external system
+
+    // Input signals
+    logic Req_Valid, Rsp_Ready;
+    logic [CFU_FUNC_WIDTH-1:0] Req_Func;
+    logic [31:0] Req_SrcA, Req_SrcB;
+
+    // Output signals
+    logic Req_Ready, Rsp_Valid;
+    logic [31:0] Rsp_Data;
+
+    cfu cfu (
+        .CLK(CLK),
+        .RST(RST),
+        .Req_Valid(Req_Valid),
+        .Req_Ready(Req_Ready),
+        .Req_Func(Req_Func),
+        .Req_SrcA(Req_SrcA),
+        .Req_SrcB(Req_SrcB),
+        .Rsp_Valid(Rsp_Valid),
+        .Rsp_Ready(Rsp_Ready),
+        .Rsp_Data(Rsp_Data)
+    );
+
+    initial CLK <= 1; // Initialize the clock
+    always #(CLOCK_PERIOD / 2) CLK <= ~CLK; // Generate the clock
+
+    initial begin
+        // Initialize signals with reset
+        RST <= 1;
+        Req_Valid <= 0;
+        Rsp_Ready <= 0;
+        Req_Func <= CFU_CRC32_W;
+        Req_SrcA <= 32'h0;
+        Req_SrcB <= 32'h0;
+        @(posedge CLK);
+        RST <= 0;
+        @(posedge CLK);
+        assert (Req_Ready && !Rsp_Valid) else $error("Error: CFU should be idle after reset");
+
+        // Test CRC-32 of "123456789" is the standard check value once inverted
+        request(CFU_CRC32_W, 32'hFFFF_FFFF, 32'h3433_3231, 32'h641C_1F5C, 4, "CRC32.W '1234'");
+        request(CFU_CRC32_W, 32'h641C_1F5C, 32'h3837_3635, 32'h651F_2550, 4, "CRC32.W '5678'");
+        request(CFU_CRC32_B, 32'h651F_2550, 32'hFFFF_FF39, 32'h340B_C6D9, 1, "CRC32.B '9' ignores upper bytes");
+        assert (~Rsp_Data == 32'hCBF4_3926) else $error("Error: CRC-32 check value wrong, got 0x%h", $sampled(~Rsp_Data));
+
+        // Test ones' complement sum wraps carries around
+        request(CFU_CSUM, 32'h0000_1234, 32'h0001_0002, 32'h0000_1237, 1, "CSUM");
+        request(CFU_CSUM, 32'h0000_FFFF, 32'hFFFF_FFFF, 32'h0000_FFFF, 1, "CSUM of all ones");
+        request(CFU_CSUM, 32'hFFFF_0000, 32'h8000_8000, 32'h0000_0001, 1, "CSUM wraps twice and ignores upper rs1");
+
+        // Test unknown functions still respond
+        request(11'h7FF, 32'h1234_5678, 32'h1234_5678, 32'h0, 1, "Unknown function");
+
+        // Test the response is held until taken and no request is accepted meanwhile
+        Req_Func <= CFU_CSUM;
+        Req_SrcA <= 32'h0000_0001;
+        Req_SrcB <= 32'h0000_0001;
+        Req_Valid <= 1;
+        @(posedge CLK);
+        Req_Valid <= 0;
+        repeat (3) @(posedge CLK);
+        assert (Rsp_Valid && !Req_Ready && Rsp_Data == 32'h0000_0002) else $error("Error: Response not held, got 0x%h", $sampled(Rsp_Data));
+        Rsp_Ready <= 1;
+        @(posedge CLK);
+        Rsp_Ready <= 0;
+        @(posedge CLK);
+        assert (!Rsp_Valid && Req_Ready) else $error("Error: CFU should be idle once the response is taken");
+
+        // Test a multi-cycle request doesn't accept another until it is answered
+        Req_Func <= CFU_CRC32_W;
+        Req_Valid <= 1;
+        @(posedge CLK);
+        Req_Valid <= 0;
+        @(posedge CLK);
+        assert (!Req_Ready) else $error("Error: CFU accepted a request while busy");
+
+        repeat (5) @ (posedge CLK); // Allow some extra time at the end for visual clarity
+        $stop;
+    end
+
+    // Send a request, check the response comes exactly when expected then take it
+    task request(
+        input logic [CFU_FUNC_WIDTH-1:0] func,
+        input logic [31:0] a,
+        input logic [31:0] b,
+        input int expected_Cycles, // After the request is accepted
+        input logic [31:0] expected_Rsp_Data,
+        input string name
+    );
+    begin
+        Req_Func <= func;
+        Req_SrcA <= a;
+        Req_SrcB <= b;
+        Req_Valid <= 1;
+        Rsp_Ready <= 1;
+        @(posedge CLK); // Request accepted
+        Req_Valid <= 0;
+        repeat (expected_Cycles - 1) begin
+            @(posedge CLK);
+            assert (!Rsp_Valid) else $error("Error: %s, responded before %0d cycles", name, expected_Cycles);
+        end
+        @(posedge CLK);
+        assert (Rsp_Valid) else $error("Error: %s, no response after %0d cycles", name, expected_Cycles);
+        assert (Rsp_Data == expected_Rsp_Data) else $error("Error: %s, expected 0x%h, got 0x%h", name, expected_Rsp_Data, $sampled(Rsp_Data));
+        Rsp_Ready <= 0;
+    end
+    endtask
+endmodule
@@ -0,0 +1,90 @@
+//////////////////////////////////////////////////////////////////////////////////
+// Third Year Project: RISC-V RV32i Pipelined Processor
+// File: Parallel Prefix Adder Testbench
+// Description: Checks both the Kogge-Stone and Brent-Kung trees against a behavioural add,
+//              including the carry out and overflow flags the ALU compares are built from.
+// Author: Luke Shepherd
+// Date Created: October 2026
+//////////////////////////////////////////////////////////////////////////////////
+
+import definitions::*;
+
+module prefix_adder_testbench;
+    logic CLK; // Wrap module with a clock to better represent the outside system
+
+    // Input signals
+    logic [31:0] A, B;
+    logic Carry_In;
+
+    // Output signals
+    logic [31:0] Sum_KS, Sum_BK;
+    logic Carry_Out_KS, Carry_Out_BK, Overflow_KS, Overflow_BK;
+
+    // Expected values
+    logic [32:0] Expected;
+    logic Expected_Overflow;
+
+    prefix_adder #(.BRENT_KUNG(1'b0)) kogge_stone (
+        .A(A),
+        .B(B),
+        .Carry_In(Carry_In),
+        .Sum(Sum_KS),
+        .Carry_Out(Carry_Out_KS),
+        .Overflow(Overflow_KS)
+    );
+
+    prefix_adder #(.BRENT_KUNG(1'b1)) brent_kung (
+        .A(A),
+        .B(B),
+        .Carry_In(Carry_In),
+        .Sum(Sum_BK),
+        .Carry_Out(Carry_Out_BK),
+        .Overflow(Overflow_BK)
+    );
+
+    initial CLK <= 1; // Initialize the clock
+    always #(CLOCK_PERIOD / 2) CLK <= ~CLK; // Generate the clock
+
+    initial begin
+        // Test the edges of every carry chain
+        check_add(32'h0000_0000, 32'h0000_0000, 1'b0, "Zero");
+        check_add(32'hFFFF_FFFF, 32'h0000_0001, 1'b0, "Carry through every bit");
+        check_add(32'hFFFF_FFFF, 32'h0000_0000, 1'b1, "Carry in through every bit");
+        check_add(32'h7FFF_FFFF, 32'h0000_0001, 1'b0, "Positive overflow");
+        check_add(32'h8000_0000, 32'hFFFF_FFFF, 1'b0, "Negative overflow");
+        check_add(32'h8000_0000, 32'h8000_0000, 1'b0, "Carry out and overflow");
+        check_add(32'h5555_5555, 32'hAAAA_AAAA, 1'b1, "Alternating propagate");
+        check_add(32'h1234_5678, ~32'h1234_5678, 1'b1, "Subtract equal operands");
+
+        // Test random operands, a quarter of them as subtracts of nearby values so the compares are exercised
+        for (int i = 0; i < 10000; i++) begin
+            logic [31:0] a, b;
+            a = $urandom;
+            b = ($urandom_range(3) == 0) ? ~(a + $urandom_range(4) - 2) : $urandom;
+            check_add(a, b, $urandom_range(1), "Random");
+        end
+
+        repeat (5) @ (posedge CLK); // Allow some extra time at the end for visual clarity
+        $stop;
+    end
+
+    task check_add(
+        input logic [31:0] a,
+        input logic [31:0] b,
+        input logic carry_in,
+        input string name
+    );
+    logic [31:0] sum;
+    begin
+        sum = a + b + carry_in;
+        A <= a;
+        B <= b;
+        Carry_In <= carry_in;
+        Expected <= {1'b0, a} + {1'b0, b} + carry_in;
+        Expected_Overflow <= (a[31] == b[31]) && (a[31] != sum[31]);
+        @(posedge CLK);
+        assert ({Carry_Out_KS, Sum_KS} == Expected && Overflow_KS == Expected_Overflow) else $error("Error: Kogge-Stone %s, 0x%h + 0x%h + %0d expected %h/%0d, got %h/%0d", name, $sampled(A), $sampled(B), $sampled(Carry_In), $sampled(Expected), $sampled(Expected_Overflow), $sampled({Carry_Out_KS, Sum_KS}), $sampled(Overflow_KS));
+        assert ({Carry_Out_BK, Sum_BK} == Expected && Overflow_BK == Expected_Overflow) else $error("Error: Brent-Kung %s, 0x%h + 0x%h + %0d expected %h/%0d, got %h/%0d", name, $sampled(A), $sampled(B), $sampled(Carry_In), $sampled(Expected), $sampled(Expected_Overflow), $sampled({Carry_Out_BK, Sum_BK}), $sampled(Overflow_BK));
+    end
+    endtask
+endmodule
@@ -3,7 +3,7 @@
 // File: Control Unit Testbench                                                   
 // Description: This is a testbench which aims to verify that the control unit properly decodes instructions to produce the correct control signals.
 // Author: Luke Shepherd                                                     
-// Date Modified: February 2025                                                                                                                                                                                                                                                    
+// Date Modified: October 2026                                                                                                                                                                                                                                                    
 //////////////////////////////////////////////////////////////////////////////////
 
 import definitions::*;
@@ -11,18 +11,23 @@ import definitions::*;
 module control_unit_testbench;
     logic CLK; // Wrap module with a clock to control the sim more easily and better represent the external system
     logic [31:0] Instr;
+    logic [1:0] Fuse_Sel;
     logic REG_W_En, MEM_W_En, Jump_En, Branch_En;
     logic [2:0] MEM_Control;
-    logic [3:0] ALU_Control;
+    logic [ALU_CONTROL_WIDTH-1:0] ALU_Control;
     logic [2:0] Imm_Type_Sel;
     logic Branch_Src_Sel;
     logic ALU_SrcA_Sel, ALU_SrcB_Sel;
     logic [1:0] Result_Src_Sel ;
+    logic Reduced_REG_W_En, Reduced_MEM_W_En, Reduced_Jump_En, Reduced_Branch_En; // Decoded without the optional units
+    logic [ALU_CONTROL_WIDTH-1:0] Reduced_ALU_Control;
 
     control_unit cu (
         .OP(Instr[6:0]),
         .Func3(Instr[14:12]),
         .Func7(Instr[31:25]),
+        .RS2(Instr[24:20]),
+        .Fuse_Sel(Fuse_Sel),
         .REG_W_En(REG_W_En),
         .MEM_W_En(MEM_W_En),
         .Jump_En(Jump_En),
@@ -36,11 +41,36 @@ module control_unit_testbench;
         .Result_Src_Sel(Result_Src_Sel)
     );
 
+    control_unit #(
+        .DIV_EN(1'b0),
+        .FDIV_EN(1'b0),
+        .CFU_EN(1'b0),
+        .HWLOOP_EN(1'b0)
+    ) cu_reduced (
+        .OP(Instr[6:0]),
+        .Func3(Instr[14:12]),
+        .Func7(Instr[31:25]),
+        .RS2(Instr[24:20]),
+        .Fuse_Sel(Fuse_Sel),
+        .REG_W_En(Reduced_REG_W_En),
+        .MEM_W_En(Reduced_MEM_W_En),
+        .Jump_En(Reduced_Jump_En),
+        .Branch_En(Reduced_Branch_En),
+        .MEM_Control(),
+        .ALU_Control(Reduced_ALU_Control),
+        .Imm_Type_Sel(),
+        .Branch_Src_Sel(),
+        .ALU_SrcA_Sel(),
+        .ALU_SrcB_Sel(),
+        .Result_Src_Sel()
+    );
+
     initial CLK <= 1; // Initialize the clock
     always #(CLOCK_PERIOD / 2) CLK <= ~CLK; // Generate the clock
 
     initial begin
         Instr <= 32'h0000_0000;
+        Fuse_Sel <= FUSE_NONE;
         @(posedge CLK); // Wait for first posedge before starting
         
         // Test R-type instruction
@@ -53,6 +83,193 @@ module control_unit_testbench;
         @(posedge CLK);
         check_signals(1, 0, 0, 0, MEM_BYTE, ALU_SRL, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
 
+        // Test Zba shifted adds share the R-type func3 values but not func7
+        Instr <= 32'h2087_21B3; // SH1ADD x3, x14, x8
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_SH1ADD, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+
+        Instr <= 32'h2087_41B3; // SH2ADD x3, x14, x8
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_SH2ADD, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+
+        Instr <= 32'h2087_61B3; // SH3ADD x3, x14, x8
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_SH3ADD, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+
+        // Test Zbb R-type operations pick the inverted forms by func7
+        Instr <= 32'h4087_71B3; // ANDN x3, x14, x8
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_ANDN, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+
+        Instr <= 32'h4087_41B3; // XNOR x3, x14, x8
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_XNOR, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+
+        Instr <= 32'h0A87_61B3; // MAX x3, x14, x8
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_MAX, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+
+        Instr <= 32'h6087_11B3; // ROL x3, x14, x8
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_ROL, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+
+        Instr <= 32'h0807_41B3; // ZEXT.H x3, x14
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_PACK, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU); // PACK with rs2 as x0
+
+        // Test Zbb unary operations are told apart by the rs2 field
+        Instr <= 32'h6007_1193; // CLZ x3, x14
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_CLZ, IMM_I, BRANCH_PC, SRCA_REG, SRCB_IMM, RESULT_ALU);
+
+        Instr <= 32'h6027_1193; // CPOP x3, x14
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_CPOP, IMM_I, BRANCH_PC, SRCA_REG, SRCB_IMM, RESULT_ALU);
+
+        Instr <= 32'h6057_1193; // SEXT.H x3, x14
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_SEXT_H, IMM_I, BRANCH_PC, SRCA_REG, SRCB_IMM, RESULT_ALU);
+
+        Instr <= 32'h6077_5193; // RORI x3, x14, 7
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_ROR, IMM_I, BRANCH_PC, SRCA_REG, SRCB_IMM, RESULT_ALU);
+
+        Instr <= 32'h6987_5193; // REV8 x3, x14
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_REV8, IMM_I, BRANCH_PC, SRCA_REG, SRCB_IMM, RESULT_ALU);
+
+        Instr <= 32'h2877_5193; // ORC.B x3, x14
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_ORC_B, IMM_I, BRANCH_PC, SRCA_REG, SRCB_IMM, RESULT_ALU);
+
+        // Test Zbkb packing and permutations share encodings with Zbb
+        Instr <= 32'h0887_41B3; // PACK x3, x14, x8
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_PACK, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+
+        Instr <= 32'h0887_71B3; // PACKH x3, x14, x8
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_PACKH, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+
+        Instr <= 32'h6877_5193; // BREV8 x3, x14
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_BREV8, IMM_I, BRANCH_PC, SRCA_REG, SRCB_IMM, RESULT_ALU);
+
+        Instr <= 32'h08F7_1193; // ZIP x3, x14
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_ZIP, IMM_I, BRANCH_PC, SRCA_REG, SRCB_IMM, RESULT_ALU);
+
+        Instr <= 32'h08F7_5193; // UNZIP x3, x14
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_UNZIP, IMM_I, BRANCH_PC, SRCA_REG, SRCB_IMM, RESULT_ALU);
+
+        // Test Zknh SHA-256 functions are told apart by the rs2 field
+        Instr <= 32'h1007_1193; // SHA256SUM0 x3, x14
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_SHA256SUM0, IMM_I, BRANCH_PC, SRCA_REG, SRCB_IMM, RESULT_ALU);
+
+        Instr <= 32'h1037_1193; // SHA256SIG1 x3, x14
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_SHA256SIG1, IMM_I, BRANCH_PC, SRCA_REG, SRCB_IMM, RESULT_ALU);
+
+        Instr <= 32'h1047_1193; // rs2 of 4 has no SHA-256 function
+        @(posedge CLK);
+        check_signals(0, 0, 0, 0, MEM_BYTE, ALU_SLL, IMM_I, BRANCH_PC, SRCA_REG, SRCB_IMM, RESULT_ALU);
+
+        // Test a reserved unary encoding leaves state alone
+        Instr <= 32'h6037_1193; // rs2 of 3 has no Zbb operation
+        @(posedge CLK);
+        check_signals(0, 0, 0, 0, MEM_BYTE, ALU_SLL, IMM_I, BRANCH_PC, SRCA_REG, SRCB_IMM, RESULT_ALU);
+
+        // Test Zbs register and immediate forms
+        Instr <= 32'h4887_11B3; // BCLR x3, x14, x8
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_BCLR, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+
+        Instr <= 32'h4887_51B3; // BEXT x3, x14, x8
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_BEXT, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+
+        Instr <= 32'h2887_11B3; // BSET x3, x14, x8
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_BSET, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+
+        Instr <= 32'h4857_5193; // BEXTI x3, x14, 5
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_BEXT, IMM_I, BRANCH_PC, SRCA_REG, SRCB_IMM, RESULT_ALU);
+
+        Instr <= 32'h6817_1193; // BINVI x3, x14, 1
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_BINV, IMM_I, BRANCH_PC, SRCA_REG, SRCB_IMM, RESULT_ALU);
+
+        Instr <= 32'h0057_1193; // SLLI x3, x14, 5 is unchanged
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_SLL, IMM_I, BRANCH_PC, SRCA_REG, SRCB_IMM, RESULT_ALU);
+
+        // Test Zicond conditional zero
+        Instr <= 32'h0E87_51B3; // CZERO.EQZ x3, x14, x8
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_CZERO_EQZ, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+
+        Instr <= 32'h0E87_71B3; // CZERO.NEZ x3, x14, x8
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_CZERO_NEZ, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+
+        // Test packed SIMD
+        Instr <= 32'h4852_01F7; // ADD8 x3, x4, x5
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_ADD8, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+
+        Instr <= 32'h3052_01F7; // UKADD16 x3, x4, x5
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_UKADD16, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+
+        Instr <= 32'h0E52_01F7; // SCMPLT8 x3, x4, x5
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_SCMPLT8, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+
+        Instr <= 32'h0E52_11F7; // PKBB16 x3, x4, x5, same func7 as SCMPLT8
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_PKBB16, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+
+        Instr <= 32'hAD82_01F7; // SWAP8 x3, x4
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_SWAP8, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+
+        Instr <= 32'hAC52_01F7; // Reserved SWAP8 encoding with rs2 x5
+        @(posedge CLK);
+        check_signals(0, 0, 0, 0, MEM_BYTE, ALU_ADD, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+
+        // Test custom instructions go to the CFU with the function select as the immediate
+        Instr <= 32'h0052_018B; // CRC32.W x3, x4, x5 on custom-0
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_CFU, IMM_CFU, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+        check_illegal_reduced("custom-0 without a CFU");
+
+        Instr <= 32'hFE20_FFAB; // custom-1
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_CFU, IMM_CFU, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+        check_illegal_reduced("custom-1 without a CFU");
+
+        // Test hardware loop instructions only write the loop registers
+        Instr <= 32'h0641_507B; // LP.SETUPI 0, 100, +8
+        @(posedge CLK);
+        check_signals(0, 0, 0, 0, MEM_BYTE, ALU_LP_SETUPI, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+        check_illegal_reduced("LP.SETUPI without loop registers");
+
+        Instr <= 32'h0142_C0FB; // LP.SETUP 1, x5, +20
+        @(posedge CLK);
+        check_signals(0, 0, 0, 0, MEM_BYTE, ALU_LP_SETUP, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+
+        Instr <= 32'h0003_A0FB; // LP.COUNT 1, x7
+        @(posedge CLK);
+        check_signals(0, 0, 0, 0, MEM_BYTE, ALU_LP_COUNT, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+        check_illegal_reduced("LP.COUNT without loop registers");
+
+        Instr <= 32'h0000_707B; // Reserved func3
+        @(posedge CLK);
+        check_signals(0, 0, 0, 0, MEM_BYTE, ALU_ADD, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+
         // Test I-type instruction
         Instr <= 32'h4087_3193; //  SLTIU
         @(posedge CLK);
@@ -98,10 +315,88 @@ module control_unit_testbench;
         @(posedge CLK);
         check_signals(0, 0, 0, 0, MEM_BYTE, ALU_ADD, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
 
+        // Test multiplies write the multiplier result
+        Instr <= 32'h0287_01B3; //  MUL x3, x14, x8
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_MUL, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_MUL);
+
+        Instr <= 32'h0287_31B3; //  MULHU x3, x14, x8
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_MULHU, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_MUL);
+        assert (Reduced_REG_W_En && Reduced_ALU_Control == ALU_MULHU) else $error("Error: Multiplies should still decode without a divider");
+
+        // Test divide leaves the register write to the divider
+        Instr <= 32'h0287_41B3; //  DIV x3, x14, x8
+        @(posedge CLK);
+        check_signals(0, 0, 0, 0, MEM_BYTE, ALU_DIV, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+        check_illegal_reduced("DIV without a divider");
+
+        Instr <= 32'h0287_71B3; //  REMU x3, x14, x8
+        @(posedge CLK);
+        check_signals(0, 0, 0, 0, MEM_BYTE, ALU_REMU, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+        check_illegal_reduced("REMU without a divider");
+
+        // Test Zfinx instructions use the integer registers and return through the multiplier slot
+        Instr <= 32'h0087_71D3; //  FADD.S x3, x14, x8, dyn
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_FADD, IMM_CFU, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_MUL);
+
+        Instr <= 32'hA087_21D3; //  FEQ.S x3, x14, x8
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_FEQ, IMM_CFU, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_MUL);
+
+        Instr <= 32'hC017_11D3; //  FCVT.WU.S x3, x14, rtz
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_FCVT_WU_S, IMM_CFU, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_MUL);
+
+        Instr <= 32'hE007_11D3; //  FCLASS.S x3, x14
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_FCLASS, IMM_CFU, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_MUL);
+        assert (Reduced_REG_W_En && Reduced_ALU_Control == ALU_FCLASS) else $error("Error: The FP pipeline should still decode without an FP divider");
+
+        // Test FP divide and square root leave the register write to the FP divider
+        Instr <= 32'h1887_01D3; //  FDIV.S x3, x14, x8, rne
+        @(posedge CLK);
+        check_signals(0, 0, 0, 0, MEM_BYTE, ALU_FDIV, IMM_CFU, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_MUL);
+        check_illegal_reduced("FDIV.S without an FP divider");
+
+        Instr <= 32'h5807_11D3; //  FSQRT.S x3, x14, rtz
+        @(posedge CLK);
+        check_signals(0, 0, 0, 0, MEM_BYTE, ALU_FSQRT, IMM_CFU, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_MUL);
+        check_illegal_reduced("FSQRT.S without an FP divider");
+
+        // Test reserved FP encodings leave state alone
+        Instr <= 32'h2087_31D3; //  FSGNJ with func3 011
+        @(posedge CLK);
+        check_signals(0, 0, 0, 0, MEM_BYTE, ALU_ADD, IMM_CFU, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_MUL);
+
+        Instr <= 32'h5817_01D3; //  FSQRT with rs2 not zero
+        @(posedge CLK);
+        check_signals(0, 0, 0, 0, MEM_BYTE, ALU_ADD, IMM_CFU, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_MUL);
+
         // Test unsupported illegal instruction ensures no effect on state
-        Instr <= 32'h0287_01B3; //  MUL
+        Instr <= 32'h0000_0000; //  Defined illegal instruction
         @(posedge CLK);
         check_signals(0, 0, 0, 0, MEM_BYTE, ALU_ADD, IMM_I, BRANCH_PC, SRCA_REG, SRCB_REG, RESULT_ALU);
+
+        // Test ADDI fused with a preceding LUI becomes a constant load
+        Instr <= 32'h2340_8093; // ADDI x1, x1, 0x234
+        Fuse_Sel <= FUSE_LUI_ADDI;
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_LUI, IMM_FUSED, BRANCH_PC, SRCA_REG, SRCB_IMM, RESULT_ALU);
+
+        // Test ADDI fused with a preceding AUIPC becomes PC relative
+        Instr <= 32'h2340_8093; // ADDI x1, x1, 0x234
+        Fuse_Sel <= FUSE_AUIPC_ADDI;
+        @(posedge CLK);
+        check_signals(1, 0, 0, 0, MEM_BYTE, ALU_ADD, IMM_FUSED_PC, BRANCH_PC, SRCA_PC, SRCB_IMM, RESULT_ALU);
+
+        // Test JALR fused with a preceding AUIPC uses a PC relative target
+        Instr <= 32'h0100_80E7; // JALR x1, 0x10(x1)
+        Fuse_Sel <= FUSE_AUIPC_JALR;
+        @(posedge CLK);
+        check_signals(1, 0, 1, 0, MEM_BYTE, ALU_ADD, IMM_FUSED_PC, BRANCH_PC, SRCA_REG, SRCB_IMM, RESULT_PC4);
+        Fuse_Sel <= FUSE_NONE;
         
         repeat (5) @ (posedge CLK); // Allow some extra time at the end for visual clarity
         $stop; 
@@ -113,7 +408,7 @@ module control_unit_testbench;
         input logic expected_Jump_En,
         input logic expected_Branch_En,
         input logic [2:0] expected_MEM_Control,
-        input logic [3:0] expected_ALU_Control,
+        input logic [ALU_CONTROL_WIDTH-1:0] expected_ALU_Control,
         input logic [2:0] expected_Imm_Type_Sel,
         input logic expected_Branch_Src_Sel,
         input logic expected_ALU_SrcA_Sel,
@@ -134,4 +429,14 @@ module control_unit_testbench;
         assert (Result_Src_Sel == expected_Result_Src_Sel) else $error("Error: Incorrect Result_Src_Sel produced, expected %h, got %h", expected_Result_Src_Sel, $sampled(Result_Src_Sel));
     end
     endtask
+
+    // The instruction needs a unit the reduced control unit was built without, so it must leave state alone
+    task check_illegal_reduced(
+        input string name
+    );
+    begin
+        assert (!Reduced_REG_W_En && !Reduced_MEM_W_En && !Reduced_Jump_En && !Reduced_Branch_En) else $error("Error: %s, should leave state alone", name);
+        assert (Reduced_ALU_Control == ALU_ADD) else $error("Error: %s, expected ALU_ADD, got %h", name, $sampled(Reduced_ALU_Control));
+    end
+    endtask
 endmodule
\ No newline at end of file
@@ -0,0 +1,117 @@
+//////////////////////////////////////////////////////////////////////////////////
+// Third Year Project: RISC-V RV32i Pipelined Processor
+// File: Fusion Detector Testbench
+// Description: Ensures that the fusion detector only recognises dependent LUI/AUIPC pairs that leave decode back to back.
+// Author: Luke Shepherd
+// Date Created: October 2026
+//////////////////////////////////////////////////////////////////////////////////
+
+import definitions::*;
+
+module fusion_detector_testbench;
+    logic CLK, RST; // Wrap module with a clock to control the sim more easily and better represent the external system
+
+    // Input signals
+    logic Stall_En, Flush_D;
+    logic [31:0] Instr;
+
+    // Output signals
+    logic [1:0] Fuse_Sel;
+    logic [31:0] Fuse_Instr;
+
+    fusion_detector fd (
+        .CLK(CLK),
+        .RST(RST),
+        .Stall_En(Stall_En),
+        .Flush_D(Flush_D),
+        .Instr(Instr),
+        .Fuse_Sel(Fuse_Sel),
+        .Fuse_Instr(Fuse_Instr)
+    );
+
+    initial CLK <= 1; // Initialize the clock
+    always #(CLOCK_PERIOD / 2) CLK <= ~CLK; // Generate the clock
+
+    initial begin
+        // Initialize signals with reset
+        RST <= 1;
+        Stall_En <= 0;
+        Flush_D <= 0;
+        Instr <= 32'h0000_0013; // NOP
+        @(posedge CLK);
+        RST <= 0;
+        @(posedge CLK);
+        check_fuse(FUSE_NONE);
+
+        // Test LUI followed by dependent ADDI (LI)
+        Instr <= 32'h1234_50B7; // LUI x1, 0x12345
+        @(posedge CLK);
+        Instr <= 32'h2340_8093; // ADDI x1, x1, 0x234
+        @(posedge CLK);
+        check_fuse(FUSE_LUI_ADDI);
+
+        // Test a third instruction does not fuse with the already fused ADDI
+        Instr <= 32'h0010_8093; // ADDI x1, x1, 1
+        @(posedge CLK);
+        check_fuse(FUSE_NONE);
+
+        // Test ADDI that does not read the LUI result is not fused
+        Instr <= 32'h1234_50B7; // LUI x1, 0x12345
+        @(posedge CLK);
+        Instr <= 32'h2341_0113; // ADDI x2, x2, 0x234
+        @(posedge CLK);
+        check_fuse(FUSE_NONE);
+
+        // Test LUI to x0 is not fused since x0 reads as zero
+        Instr <= 32'h1234_5037; // LUI x0, 0x12345
+        @(posedge CLK);
+        Instr <= 32'h2340_0093; // ADDI x1, x0, 0x234
+        @(posedge CLK);
+        check_fuse(FUSE_NONE);
+
+        // Test AUIPC followed by dependent ADDI (LA)
+        Instr <= 32'h0000_1317; // AUIPC x6, 0x1
+        @(posedge CLK);
+        Instr <= 32'h0103_0313; // ADDI x6, x6, 16
+        @(posedge CLK);
+        check_fuse(FUSE_AUIPC_ADDI);
+
+        // Test AUIPC followed by dependent JALR (CALL)
+        Instr <= 32'h0000_1097; // AUIPC x1, 0x1
+        @(posedge CLK);
+        Instr <= 32'h0100_80E7; // JALR x1, 16(x1)
+        @(posedge CLK);
+        check_fuse(FUSE_AUIPC_JALR);
+
+        // Test stalled decode keeps the pair together
+        Instr <= 32'h1234_50B7; // LUI x1, 0x12345
+        @(posedge CLK);
+        Instr <= 32'h2340_8093; // ADDI x1, x1, 0x234
+        Stall_En <= 1;
+        @(posedge CLK);
+        check_fuse(FUSE_LUI_ADDI);
+        Stall_En <= 0;
+        @(posedge CLK);
+        check_fuse(FUSE_LUI_ADDI);
+
+        // Test a flush breaks the pair since the next instruction comes from a redirect
+        Instr <= 32'h1234_50B7; // LUI x1, 0x12345
+        Flush_D <= 1;
+        @(posedge CLK);
+        Instr <= 32'h2340_8093; // ADDI x1, x1, 0x234
+        Flush_D <= 0;
+        @(posedge CLK);
+        check_fuse(FUSE_NONE);
+
+        repeat (5) @ (posedge CLK); // Allow some extra time at the end for visual clarity
+        $stop;
+    end
+
+    task check_fuse(
+        input logic [1:0] expected_Fuse_Sel
+    );
+    begin
+        assert (Fuse_Sel == expected_Fuse_Sel) else $error("Error: Incorrect Fuse_Sel produced, expected %h, got %h", expected_Fuse_Sel, $sampled(Fuse_Sel));
+    end
+    endtask
+endmodule
@@ -0,0 +1,83 @@
+//////////////////////////////////////////////////////////////////////////////////
+// Third Year Project: RISC-V RV32i Pipelined Processor
+// File: Hart Register File Testbench
+// Description: Ensures that each hart of the barrel core sees only its own registers.
+// Author: Luke Shepherd
+// Date Created: October 2026
+//////////////////////////////////////////////////////////////////////////////////
+
+import definitions::*;
+
+module hart_register_file_testbench;
+    logic CLK, REG_W_En;
+    logic [BARREL_HART_BITS-1:0] Hart_R, Hart_W;
+    logic [4:0] REG_R_Addr1, REG_R_Addr2, REG_W_Addr;
+    logic [31:0] REG_W_Data;
+    logic [31:0] REG_R_Data1, REG_R_Data2;
+
+    hart_register_file regfile (
+        .CLK(CLK),
+        .REG_W_En(REG_W_En),
+        .Hart_R(Hart_R),
+        .Hart_W(Hart_W),
+        .REG_R_Addr1(REG_R_Addr1),
+        .REG_R_Addr2(REG_R_Addr2),
+        .REG_W_Addr(REG_W_Addr),
+        .REG_W_Data(REG_W_Data),
+        .REG_R_Data1(REG_R_Data1),
+        .REG_R_Data2(REG_R_Data2)
+    );
+
+    initial CLK <= 1; // Initialize the clock
+    always #(CLOCK_PERIOD / 2) CLK <= ~CLK; // Generate the clock
+
+    initial begin
+        // Initialize signals
+        REG_W_En <= 0;
+        Hart_R <= 0;
+        Hart_W <= 0;
+        REG_R_Addr1 <= 0; 
+        REG_R_Addr2 <= 0;
+        REG_W_Addr <= 0;
+        REG_W_Data <= 0;
+        @(posedge CLK);
+
+        // Write x5 of every hart with a distinct value
+        REG_W_En <= 1;
+        REG_W_Addr <= 5'd5;
+        for (int i = 0; i < BARREL_HARTS; i++) begin
+            Hart_W <= i;
+            REG_W_Data <= 32'h1000_0000 + i;
+            @(posedge CLK);
+        end
+
+        // Test writing x0 of one hart is ignored
+        Hart_W <= 1;
+        REG_W_Addr <= 5'd0;
+        REG_W_Data <= 32'h2A2A_2A2A;
+        @(posedge CLK);
+        REG_W_En <= 0;
+
+        // Read x5 and x0 back from each hart
+        REG_R_Addr1 <= 5'd5;
+        REG_R_Addr2 <= 5'd0;
+        for (int i = 0; i < BARREL_HARTS; i++) begin
+            Hart_R <= i;
+            @(posedge CLK);
+            check_read(32'h1000_0000 + i, 32'h0000_0000);
+        end
+
+        repeat (5) @ (posedge CLK); // Allow some extra time at the end for visual clarity
+        $stop;
+    end
+
+    task check_read(
+        input logic [31:0] expected_REG_R_Data1,
+        input logic [31:0] expected_REG_R_Data2
+    );
+    begin
+        assert (REG_R_Data1 == expected_REG_R_Data1) else $error("Error: Incorrect REG_R_Data1 for hart %0d, expected %h, got %h", $sampled(Hart_R), expected_REG_R_Data1, $sampled(REG_R_Data1));
+        assert (REG_R_Data2 == expected_REG_R_Data2) else $error("Error: Incorrect REG_R_Data2 for hart %0d, expected %h, got %h", $sampled(Hart_R), expected_REG_R_Data2, $sampled(REG_R_Data2));
+    end
+    endtask
+endmodule
@@ -3,7 +3,7 @@
 // File: Immediate Extender Testbench                                                   
 // Description: This is a testbench to ensure that the immediate extender appropriately extends immediate values based on the instruction type.
 // Author: Luke Shepherd                                                     
-// Date Modified: February 2025                                                                                                                                                                                                                                                        
+// Date Modified: October 2026                                                                                                                                                                                                                                                        
 //////////////////////////////////////////////////////////////////////////////////
 
 import definitions::*;
@@ -11,11 +11,13 @@ import definitions::*;
 module immediate_extender_testbench;
     logic CLK; // Wrap module with a clock to control the sim more easily and better represent the external system
     logic [31:0] Instr;
+    logic [31:0] Fuse_Instr;
     logic [2:0] Imm_Type_Sel;
     logic [31:0] Imm_Ext;
 
     immediate_extender iext (
         .Instr(Instr),
+        .Fuse_Instr(Fuse_Instr),
         .Imm_Type_Sel(Imm_Type_Sel),
         .Imm_Ext(Imm_Ext)
     );
@@ -47,6 +49,30 @@ module immediate_extender_testbench;
         @(posedge CLK);
         assert (Imm_Ext == 32'h000A_22A2) else $error("Error: Incorrect extension produced, expected 0x000A22A2, got %h", $sampled(Imm_Ext));
 
+        Instr <= 32'h8000_8093; // ADDI x1, x1, -2048
+        Fuse_Instr <= 32'h1234_50B7; // LUI x1, 0x12345
+        Imm_Type_Sel <= IMM_FUSED;
+        @(posedge CLK);
+        assert (Imm_Ext == 32'h1234_4800) else $error("Error: Incorrect extension produced, expected 0x12344800, got %h", $sampled(Imm_Ext));
+
+        Fuse_Instr <= 32'h1234_5097; // AUIPC x1, 0x12345
+        Imm_Type_Sel <= IMM_FUSED_PC;
+        @(posedge CLK);
+        assert (Imm_Ext == 32'h1234_47FC) else $error("Error: Incorrect extension produced, expected 0x123447FC, got %h", $sampled(Imm_Ext));
+
+        Instr <= 32'h0050_80E7; // JALR x1, 5(x1), an odd target
+        @(posedge CLK);
+        assert (Imm_Ext == 32'h1234_5000) else $error("Error: Incorrect extension produced, expected 0x12345000, got %h", $sampled(Imm_Ext));
+
+        Instr <= 32'hFE20_FFAB; // custom-1 with func7 0x7F and func3 7
+        Imm_Type_Sel <= IMM_CFU;
+        @(posedge CLK);
+        assert (Imm_Ext == 32'h0000_07FF) else $error("Error: Incorrect function select produced, expected 0x000007FF, got %h", $sampled(Imm_Ext));
+
+        Instr <= 32'h0052_118B; // CRC32.B x3, x4, x5 on custom-0
+        @(posedge CLK);
+        assert (Imm_Ext == {21'b0, CFU_CRC32_B}) else $error("Error: Incorrect function select produced, expected %h, got %h", CFU_CRC32_B, $sampled(Imm_Ext));
+
         operate(10); // Simulate 10 random extensions for each of the 5 types of immediate
 
         repeat (5) @ (posedge CLK); // Allow some extra time at the end for visual clarity
@@ -3,7 +3,7 @@
 // File: Arithmetic Logic Unit Testbench                                                   
 // Description: This is a testbench to ensure that the ALU performs the correct operations. 
 // Author: Luke Shepherd                                                     
-// Date Created: February 2025                                                                                                                                                                                                                                                      
+// Date Modified: October 2026                                                                                                                                                                                                                                                      
 //////////////////////////////////////////////////////////////////////////////////
 
 import definitions::*;
@@ -12,7 +12,7 @@ module arithmetic_logic_unit_testbench;
     logic CLK; // Wrap module with a clock to better represent the outside system
 
     // Input signals
-    logic [3:0] ALU_Control;
+    logic [ALU_CONTROL_WIDTH-1:0] ALU_Control;
     logic [31:0] SrcA, SrcB;
 
     // Output signals
@@ -258,6 +258,31 @@ module arithmetic_logic_unit_testbench;
         @(posedge CLK);
         assert (Branch_Condition == 1'b0) else $error("Error: Incorrect result produced for failing BGEU test, expected 0, got 0x%h", $sampled(Branch_Condition));
 
+        // Test compares where SrcA - SrcB overflows, the sign of the difference alone would be wrong
+        SrcA <= 32'h8000_0000;
+        SrcB <= 32'h7FFF_FFFF;
+        check_result(ALU_BLT, 32'h0000_0001, "SLT with overflow");
+        check_result(ALU_BLTU, 32'h0000_0000, "SLTU with overflow");
+        check_result(ALU_MIN, 32'h8000_0000, "MIN with overflow");
+        check_result(ALU_MAXU, 32'h8000_0000, "MAXU with overflow");
+        ALU_Control <= ALU_BGE;
+        SrcA <= 32'h7FFF_FFFF;
+        SrcB <= 32'h8000_0000;
+        @(posedge CLK);
+        assert (Branch_Condition == 1'b1) else $error("Error: Incorrect result produced for BGE with overflow test, expected 1, got 0x%h", $sampled(Branch_Condition));
+
+        // Test equal operands for every compare
+        ALU_Control <= ALU_BEQ;
+        SrcA <= 32'h8000_0001;
+        SrcB <= 32'h8000_0001;
+        @(posedge CLK);
+        assert (Branch_Condition == 1'b1) else $error("Error: Incorrect result produced for equal BEQ test, expected 1, got 0x%h", $sampled(Branch_Condition));
+        check_result(ALU_BLT, 32'h0000_0000, "SLT of equal operands");
+        check_result(ALU_BLTU, 32'h0000_0000, "SLTU of equal operands");
+        ALU_Control <= ALU_BGEU;
+        @(posedge CLK);
+        assert (Branch_Condition == 1'b1) else $error("Error: Incorrect result produced for equal BGEU test, expected 1, got 0x%h", $sampled(Branch_Condition));
+
         // Test LUI takes SrcB value
         ALU_Control <= ALU_LUI;
         SrcA <= 32'h0000_0000;
@@ -271,6 +296,180 @@ module arithmetic_logic_unit_testbench;
         SrcB <= 32'hF0F0_F0F0;
         @(posedge CLK);
         assert (Result == 32'hF0F0_F0F0) else $error("Error: Incorrect result produced for LUI test, expected 0xF0F0F0F0, got 0x%h", $sampled(Branch_Condition));
+
+        // Test SH1ADD indexes a halfword array
+        ALU_Control <= ALU_SH1ADD;
+        SrcA <= 32'h0000_0005; // Index
+        SrcB <= 32'h0000_1000; // Base
+        @(posedge CLK);
+        assert (Result == 32'h0000_100A) else $error("Error: Incorrect result produced for SH1ADD test, expected 0x0000100A, got 0x%h", $sampled(Result));
+
+        // Test SH2ADD indexes a word array
+        ALU_Control <= ALU_SH2ADD;
+        @(posedge CLK);
+        assert (Result == 32'h0000_1014) else $error("Error: Incorrect result produced for SH2ADD test, expected 0x00001014, got 0x%h", $sampled(Result));
+
+        // Test SH3ADD indexes a doubleword array
+        ALU_Control <= ALU_SH3ADD;
+        @(posedge CLK);
+        assert (Result == 32'h0000_1028) else $error("Error: Incorrect result produced for SH3ADD test, expected 0x00001028, got 0x%h", $sampled(Result));
+
+        // Test shifted out bits are discarded and a negative index wraps like the two instruction sequence
+        ALU_Control <= ALU_SH3ADD;
+        SrcA <= 32'hFFFF_FFFF; // Index -1
+        SrcB <= 32'h0000_1000;
+        @(posedge CLK);
+        assert (Result == 32'h0000_0FF8) else $error("Error: Incorrect result produced for negative SH3ADD test, expected 0x00000FF8, got 0x%h", $sampled(Result));
+
+        // Test Zbb logic with an inverted operand
+        SrcA <= 32'hFF00_FF00;
+        SrcB <= 32'hF0F0_F0F0;
+        check_result(ALU_ANDN, 32'h0F00_0F00, "ANDN");
+        check_result(ALU_ORN, 32'hFF0F_FF0F, "ORN");
+        check_result(ALU_XNOR, 32'hF00F_F00F, "XNOR");
+
+        // Test minimum and maximum treat the sign bit according to the variant
+        SrcA <= 32'hFFFF_FFFF; // -1 or the largest unsigned value
+        SrcB <= 32'h0000_0001;
+        check_result(ALU_MIN, 32'hFFFF_FFFF, "MIN");
+        check_result(ALU_MINU, 32'h0000_0001, "MINU");
+        check_result(ALU_MAX, 32'h0000_0001, "MAX");
+        check_result(ALU_MAXU, 32'hFFFF_FFFF, "MAXU");
+
+        // Test rotates only use the low five bits of the amount and wrap bits around
+        SrcA <= 32'h8000_0001;
+        SrcB <= 32'h0000_0024; // 36 so rotates by 4
+        check_result(ALU_ROL, 32'h0000_0018, "ROL");
+        check_result(ALU_ROR, 32'h1800_0000, "ROR");
+        SrcB <= 32'h0000_0000;
+        check_result(ALU_ROL, 32'h8000_0001, "ROL by zero");
+        check_result(ALU_ROR, 32'h8000_0001, "ROR by zero");
+
+        // Test leading and trailing zero counts
+        SrcA <= 32'h0001_0000;
+        check_result(ALU_CLZ, 32'd15, "CLZ");
+        check_result(ALU_CTZ, 32'd16, "CTZ");
+        SrcA <= 32'h8000_0001;
+        check_result(ALU_CLZ, 32'd0, "CLZ of MSB");
+        check_result(ALU_CTZ, 32'd0, "CTZ of LSB");
+        SrcA <= 32'h0000_0000;
+        check_result(ALU_CLZ, 32'd32, "CLZ of zero");
+        check_result(ALU_CTZ, 32'd32, "CTZ of zero");
+
+        // Test population count
+        check_result(ALU_CPOP, 32'd0, "CPOP of zero");
+        SrcA <= 32'hFFFF_FFFF;
+        check_result(ALU_CPOP, 32'd32, "CPOP of all ones");
+        SrcA <= 32'h1234_5678;
+        check_result(ALU_CPOP, 32'd13, "CPOP");
+
+        // Test sign and zero extension
+        SrcA <= 32'h1234_8080;
+        check_result(ALU_SEXT_B, 32'hFFFF_FF80, "SEXT.B");
+        check_result(ALU_SEXT_H, 32'hFFFF_8080, "SEXT.H");
+        SrcB <= 32'h0000_0000; // ZEXT.H is PACK with rs2 as x0
+        check_result(ALU_PACK, 32'h0000_8080, "ZEXT.H");
+
+        // Test byte reverse and OR-combine
+        SrcA <= 32'h1200_5600;
+        check_result(ALU_REV8, 32'h0056_0012, "REV8");
+        check_result(ALU_ORC_B, 32'hFF00_FF00, "ORC.B");
+
+        // Test Zbkb packing and bit permutations
+        SrcA <= 32'h1234_80F1;
+        SrcB <= 32'hABCD_5678;
+        check_result(ALU_PACK, 32'h5678_80F1, "PACK");
+        check_result(ALU_PACKH, 32'h0000_78F1, "PACKH");
+        check_result(ALU_BREV8, 32'h482C_018F, "BREV8");
+        check_result(ALU_ZIP, 32'h4208_5F21, "ZIP");
+        SrcA <= 32'h4208_5F21;
+        check_result(ALU_UNZIP, 32'h1234_80F1, "UNZIP undoes ZIP");
+
+        // Test Zknh SHA-256 functions on the first initial hash word
+        SrcA <= 32'h6A09_E667;
+        check_result(ALU_SHA256SIG0, 32'hBA0C_F582, "SHA256SIG0");
+        check_result(ALU_SHA256SIG1, 32'hCFE5_DA3C, "SHA256SIG1");
+        check_result(ALU_SHA256SUM0, 32'hCE20_B47E, "SHA256SUM0");
+        check_result(ALU_SHA256SUM1, 32'h55B6_5510, "SHA256SUM1");
+
+        // Test single bit operations only use the low five bits of the index
+        SrcA <= 32'h8000_00F0;
+        SrcB <= 32'h0000_0024; // 36 so bit 4
+        check_result(ALU_BCLR, 32'h8000_00E0, "BCLR");
+        check_result(ALU_BEXT, 32'h0000_0001, "BEXT set bit");
+        check_result(ALU_BINV, 32'h8000_00E0, "BINV");
+        check_result(ALU_BSET, 32'h8000_00F0, "BSET already set");
+        SrcB <= 32'h0000_0000;
+        check_result(ALU_BEXT, 32'h0000_0000, "BEXT clear bit");
+        check_result(ALU_BINV, 32'h8000_00F1, "BINV clear bit");
+        check_result(ALU_BSET, 32'h8000_00F1, "BSET");
+        SrcB <= 32'h0000_001F;
+        check_result(ALU_BCLR, 32'h0000_00F0, "BCLR of MSB");
+        check_result(ALU_BEXT, 32'h0000_0001, "BEXT of MSB");
+
+        // Test conditional zero passes SrcA through or clears it depending on SrcB
+        SrcA <= 32'h1234_5678;
+        SrcB <= 32'h0000_0000;
+        check_result(ALU_CZERO_EQZ, 32'h0000_0000, "CZERO.EQZ with zero condition");
+        check_result(ALU_CZERO_NEZ, 32'h1234_5678, "CZERO.NEZ with zero condition");
+        SrcB <= 32'h8000_0000; // Any set bit counts as non-zero
+        check_result(ALU_CZERO_EQZ, 32'h1234_5678, "CZERO.EQZ with non-zero condition");
+        check_result(ALU_CZERO_NEZ, 32'h0000_0000, "CZERO.NEZ with non-zero condition");
+
+        // Test byte lanes, each lane picked to overflow a different way
+        SrcA <= 32'h7F80_05FE;
+        SrcB <= 32'h0181_0501;
+        check_result(ALU_ADD8, 32'h8001_0AFF, "ADD8 carries stay in lane");
+        check_result(ALU_SUB8, 32'h7EFF_00FD, "SUB8");
+        check_result(ALU_KADD8, 32'h7F80_0AFF, "KADD8 saturates both ways");
+        check_result(ALU_UKADD8, 32'h80FF_0AFF, "UKADD8 saturates");
+        check_result(ALU_CMPEQ8, 32'h0000_FF00, "CMPEQ8");
+        check_result(ALU_SCMPLT8, 32'h00FF_00FF, "SCMPLT8");
+        check_result(ALU_UCMPLT8, 32'h00FF_0000, "UCMPLT8");
+        check_result(ALU_SMIN8, 32'h0180_05FE, "SMIN8");
+        check_result(ALU_SMAX8, 32'h7F81_0501, "SMAX8");
+        check_result(ALU_UMIN8, 32'h0180_0501, "UMIN8");
+        check_result(ALU_UMAX8, 32'h7F81_05FE, "UMAX8");
+        check_result(ALU_ADD16, 32'h8101_0AFF, "ADD16 carries cross bytes");
+        check_result(ALU_SUB16, 32'h7DFF_00FD, "SUB16");
+
+        // Test halfword lanes
+        SrcA <= 32'h8000_7FFF;
+        SrcB <= 32'h8000_FFFF;
+        check_result(ALU_KADD16, 32'h8000_7FFE, "KADD16 saturates negative");
+        check_result(ALU_UKADD16, 32'hFFFF_FFFF, "UKADD16 saturates");
+        check_result(ALU_CMPEQ16, 32'hFFFF_0000, "CMPEQ16");
+        check_result(ALU_SCMPLT16, 32'h0000_0000, "SCMPLT16");
+        check_result(ALU_UCMPLT16, 32'h0000_FFFF, "UCMPLT16");
+        check_result(ALU_SMIN16, 32'h8000_FFFF, "SMIN16");
+        check_result(ALU_SMAX16, 32'h8000_7FFF, "SMAX16");
+        check_result(ALU_UMIN16, 32'h8000_7FFF, "UMIN16");
+        check_result(ALU_UMAX16, 32'h8000_FFFF, "UMAX16");
+
+        // Test halfword packing and byte swap
+        SrcA <= 32'h1122_3344;
+        SrcB <= 32'h5566_7788;
+        check_result(ALU_PKBB16, 32'h3344_7788, "PKBB16");
+        check_result(ALU_PKBT16, 32'h3344_5566, "PKBT16");
+        check_result(ALU_PKTB16, 32'h1122_7788, "PKTB16");
+        check_result(ALU_PKTT16, 32'h1122_5566, "PKTT16");
+        check_result(ALU_SWAP8, 32'h2211_4433, "SWAP8");
+
+        // Test FP operations leave the ALU result clear, the FPU produces them
+        check_result(ALU_FADD, 32'h0000_0000, "FADD goes to the FPU");
+        check_result(ALU_FCLASS, 32'h0000_0000, "FCLASS goes to the FPU");
         $stop; 
     end
+
+    task check_result(
+        input logic [ALU_CONTROL_WIDTH-1:0] op,
+        input logic [31:0] expected_Result,
+        input string name
+    );
+    begin
+        ALU_Control <= op;
+        @(posedge CLK);
+        assert (Result == expected_Result) else $error("Error: Incorrect result produced for %s test, expected 0x%h, got 0x%h", name, expected_Result, $sampled(Result));
+    end
+    endtask
 endmodule
\ No newline at end of file
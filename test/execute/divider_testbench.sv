@@ -0,0 +1,155 @@
+//////////////////////////////////////////////////////////////////////////////////
+// Third Year Project: RISC-V RV32i Pipelined Processor
+// File: Divider Testbench
+// Description: Ensures that the divider follows the M-Extension rules for every variant, divide by zero and overflow,
+//              and that the result is ready after one cycle per quotient bit once the leading ones are lined up,
+//              or the cycle after issue for divide by zero and a divisor larger than the dividend.
+// Author: Luke Shepherd
+// Date Created: October 2026
+//////////////////////////////////////////////////////////////////////////////////
+
+import definitions::*;
+
+module divider_testbench;
+    logic CLK, RST; // Wrap module with a clock to control the sim more easily and better represent the external system
+
+    // Input signals
+    logic Stall_E, Flush_M, DIV_W_En;
+    logic [ALU_CONTROL_WIDTH-1:0] ALU_Control_E;
+    logic [4:0] RD_E;
+    logic [31:0] SrcA_E, SrcB_E;
+
+    // Output signals
+    logic DIV_Busy, DIV_Done;
+    logic [4:0] DIV_RD;
+    logic [31:0] DIV_Out;
+
+    divider div (
+        .CLK(CLK),
+        .RST(RST),
+        .Stall_E(Stall_E),
+        .Flush_M(Flush_M),
+        .ALU_Control_E(ALU_Control_E),
+        .RD_E(RD_E),
+        .SrcA_E(SrcA_E),
+        .SrcB_E(SrcB_E),
+        .DIV_W_En(DIV_W_En),
+        .DIV_Busy(DIV_Busy),
+        .DIV_Done(DIV_Done),
+        .DIV_RD(DIV_RD),
+        .DIV_Out(DIV_Out)
+    );
+
+    initial CLK <= 1; // Initialize the clock
+    always #(CLOCK_PERIOD / 2) CLK <= ~CLK; // Generate the clock
+
+    initial begin
+        // Initialize signals with reset
+        RST <= 1;
+        Stall_E <= 0;
+        Flush_M <= 0;
+        DIV_W_En <= 0;
+        ALU_Control_E <= ALU_ADD;
+        RD_E <= 5'd0;
+        SrcA_E <= 32'h0;
+        SrcB_E <= 32'h0;
+        @(posedge CLK);
+        RST <= 0;
+        @(posedge CLK);
+        assert (!DIV_Busy && !DIV_Done) else $error("Error: Divider should be idle after reset");
+
+        // Test small quotients finish early
+        divide(ALU_DIVU, 32'd100, 32'd7, 32'd14, 6, "Small quotient DIVU 100 / 7");
+        divide(ALU_REMU, 32'd100, 32'd7, 32'd2, 6, "Small quotient REMU 100 % 7");
+        divide(ALU_DIVU, 32'd8, 32'd15, 32'd0, 2, "Same width DIVU 8 / 15");
+        divide(ALU_REMU, 32'd8, 32'd15, 32'd8, 2, "Same width REMU 8 % 15");
+
+        // Test signs, quotient rounds towards zero and the remainder takes the dividend's sign
+        divide(ALU_DIV, -32'sd100, 32'd7, -32'sd14, 6, "Signed DIV -100 / 7");
+        divide(ALU_REM, -32'sd100, 32'd7, -32'sd2, 6, "Signed REM -100 % 7");
+        divide(ALU_DIV, 32'd100, -32'sd7, -32'sd14, 6, "Signed DIV 100 / -7");
+        divide(ALU_REM, 32'd100, -32'sd7, 32'd2, 6, "Signed REM 100 % -7");
+
+        // Test a divisor larger than the dividend needs no iterations
+        divide(ALU_DIVU, 32'd3, 32'd10, 32'd0, 1, "Zero quotient DIVU 3 / 10");
+        divide(ALU_REM, -32'sd3, 32'd10, -32'sd3, 1, "Zero quotient REM -3 % 10");
+
+        // Test divide by zero gives all ones and the dividend as the remainder
+        divide(ALU_DIV, 32'd5, 32'd0, 32'hFFFF_FFFF, 1, "Divide by zero DIV 5 / 0");
+        divide(ALU_DIVU, 32'd5, 32'd0, 32'hFFFF_FFFF, 1, "Divide by zero DIVU 5 / 0");
+        divide(ALU_REM, -32'sd5, 32'd0, -32'sd5, 1, "Divide by zero REM -5 % 0");
+        divide(ALU_REMU, -32'sd5, 32'd0, -32'sd5, 1, "Divide by zero REMU -5 % 0");
+
+        // Test signed overflow returns the dividend and a zero remainder
+        divide(ALU_DIV, 32'h8000_0000, 32'hFFFF_FFFF, 32'h8000_0000, 33, "Overflow DIV -2^31 / -1");
+        divide(ALU_REM, 32'h8000_0000, 32'hFFFF_FFFF, 32'h0, 33, "Overflow REM -2^31 % -1");
+
+        // Test full width quotients take the longest
+        divide(ALU_DIVU, 32'hFFFF_FFFF, 32'd1, 32'hFFFF_FFFF, 33, "Full quotient DIVU 0xFFFFFFFF / 1");
+        divide(ALU_DIVU, 32'h1234_5679, 32'd3, 32'h0611_7228, 29, "Large quotient DIVU 0x12345679 / 3");
+        divide(ALU_REMU, 32'h1234_5679, 32'd3, 32'd1, 29, "Large quotient REMU 0x12345679 % 3");
+
+        // Test a held or removed divide never starts
+        ALU_Control_E <= ALU_DIV;
+        SrcA_E <= 32'd10;
+        SrcB_E <= 32'd2;
+        Stall_E <= 1;
+        @(posedge CLK);
+        Stall_E <= 0;
+        Flush_M <= 1;
+        @(posedge CLK);
+        ALU_Control_E <= ALU_ADD;
+        Flush_M <= 0;
+        @(posedge CLK);
+        assert (!DIV_Busy && !DIV_Done) else $error("Error: Divider started while held or removed");
+
+        // Test the result is held until writeback takes it
+        ALU_Control_E <= ALU_DIVU;
+        SrcA_E <= 32'd42;
+        SrcB_E <= 32'd6;
+        RD_E <= 5'd9;
+        @(posedge CLK);
+        ALU_Control_E <= ALU_ADD;
+        repeat (10) @(posedge CLK);
+        assert (DIV_Done && DIV_Busy && DIV_Out == 32'd7 && DIV_RD == 5'd9) else $error("Error: Result not held, got %0d for x%0d", $sampled(DIV_Out), $sampled(DIV_RD));
+        DIV_W_En <= 1;
+        @(posedge CLK);
+        assert (!DIV_Busy) else $error("Error: Divider should free its destination as it is written");
+        DIV_W_En <= 0;
+        @(posedge CLK);
+        assert (!DIV_Done) else $error("Error: Divider should be idle once written");
+
+        repeat (5) @ (posedge CLK); // Allow some extra time at the end for visual clarity
+        $stop;
+    end
+
+    // Issue a divide, check it finishes exactly when expected then hand it to writeback
+    task divide(
+        input logic [ALU_CONTROL_WIDTH-1:0] op,
+        input logic [31:0] a,
+        input logic [31:0] b,
+        input int expected_Cycles, // After leaving execute, two more than the difference in leading zeros when it iterates
+        input logic [31:0] expected_DIV_Out,
+        input string name
+    );
+    begin
+        ALU_Control_E <= op;
+        SrcA_E <= a;
+        SrcB_E <= b;
+        RD_E <= 5'd3;
+        @(posedge CLK); // Divide leaves execute
+        ALU_Control_E <= ALU_ADD;
+        repeat (expected_Cycles - 1) begin
+            @(posedge CLK);
+            assert (!DIV_Done) else $error("Error: %s, finished before %0d cycles", name, expected_Cycles);
+        end
+        @(posedge CLK);
+        assert (DIV_Done) else $error("Error: %s, not finished after %0d cycles", name, expected_Cycles);
+        assert (DIV_Out == expected_DIV_Out) else $error("Error: %s, expected 0x%h, got 0x%h", name, expected_DIV_Out, $sampled(DIV_Out));
+        assert (DIV_RD == 5'd3) else $error("Error: %s, expected rd x3, got x%0d", name, $sampled(DIV_RD));
+        DIV_W_En <= 1; // Writeback takes the result
+        @(posedge CLK);
+        DIV_W_En <= 0;
+    end
+    endtask
+endmodule
@@ -0,0 +1,306 @@
+//////////////////////////////////////////////////////////////////////////////////
+// Third Year Project: RISC-V RV32i Pipelined Processor
+// File: Floating Point Unit Testbench
+// Description: Ensures that the FP pipeline and FP divider give correctly rounded single precision results in
+//              every rounding mode, including subnormals, overflow and the special values, that the pipeline
+//              accepts one operation per cycle and that the divider finishes the cycle after issue for special values
+//              or after its FP_DIV_CYCLES bits and a rounding cycle otherwise.
+//              Expected values were produced with exact rational arithmetic then rounded for each mode.
+// Author: Luke Shepherd
+// Date Created: October 2026
+//////////////////////////////////////////////////////////////////////////////////
+
+import definitions::*;
+
+module floating_point_unit_testbench;
+    logic CLK, RST; // Wrap module with a clock to control the sim more easily and better represent the external system
+
+    // Input signals
+    logic Stall_M, Stall_W, Stall_E, Flush_M, FDIV_W_En;
+    logic [ALU_CONTROL_WIDTH-1:0] ALU_Control_E;
+    logic [2:0] RM_E;
+    logic [4:0] RD_E;
+    logic [31:0] SrcA_E, SrcB_E;
+
+    // Output signals
+    logic FPU_W;
+    logic [31:0] FPU_Out_W;
+    logic FDIV_Busy, FDIV_Done;
+    logic [4:0] FDIV_RD;
+    logic [31:0] FDIV_Out;
+
+    floating_point_unit fpu (
+        .CLK(CLK),
+        .Stall_M(Stall_M),
+        .Stall_W(Stall_W),
+        .ALU_Control_E(ALU_Control_E),
+        .RM_E(RM_E),
+        .SrcA_E(SrcA_E),
+        .SrcB_E(SrcB_E),
+        .FPU_W(FPU_W),
+        .FPU_Out_W(FPU_Out_W)
+    );
+
+    fp_divider fp_divider (
+        .CLK(CLK),
+        .RST(RST),
+        .Stall_E(Stall_E),
+        .Flush_M(Flush_M),
+        .ALU_Control_E(ALU_Control_E),
+        .RM_E(RM_E),
+        .RD_E(RD_E),
+        .SrcA_E(SrcA_E),
+        .SrcB_E(SrcB_E),
+        .FDIV_W_En(FDIV_W_En),
+        .FDIV_Busy(FDIV_Busy),
+        .FDIV_Done(FDIV_Done),
+        .FDIV_RD(FDIV_RD),
+        .FDIV_Out(FDIV_Out)
+    );
+
+    initial CLK <= 1; // Initialize the clock
+    always #(CLOCK_PERIOD / 2) CLK <= ~CLK; // Generate the clock
+
+    initial begin
+        // Initialize signals with reset
+        RST <= 1;
+        Stall_M <= 0;
+        Stall_W <= 0;
+        Stall_E <= 0;
+        Flush_M <= 0;
+        FDIV_W_En <= 0;
+        ALU_Control_E <= ALU_ADD;
+        RM_E <= FRM_RNE;
+        RD_E <= 5'd0;
+        SrcA_E <= 32'h0;
+        SrcB_E <= 32'h0;
+        @(posedge CLK);
+        RST <= 0;
+        @(posedge CLK);
+        assert (!FDIV_Busy && !FDIV_Done) else $error("Error: FP divider should be idle after reset");
+
+        // Test addition rounds the bits shifted out of the smaller operand
+        fp_op(ALU_FADD, FRM_RNE, 32'h3FC0_0000, 32'h4010_0000, 32'h4070_0000, "FADD 1.5 + 2.25");
+        fp_op(ALU_FADD, FRM_RNE, 32'h3F80_0000, 32'h322B_CC77, 32'h3F80_0000, "FADD 1 + 1e-8 RNE");
+        fp_op(ALU_FADD, FRM_RUP, 32'h3F80_0000, 32'h322B_CC77, 32'h3F80_0001, "FADD 1 + 1e-8 RUP");
+        fp_op(ALU_FADD, FRM_RDN, 32'hBF80_0000, 32'hB22B_CC77, 32'hBF80_0001, "FADD -1 + -1e-8 RDN");
+        fp_op(ALU_FADD, FRM_RTZ, 32'hBF80_0000, 32'hB22B_CC77, 32'hBF80_0000, "FADD -1 + -1e-8 RTZ");
+        fp_op(ALU_FSUB, FRM_RNE, 32'h3F80_0000, 32'h3380_0001, 32'h3F7F_FFFF, "FSUB 1 - just over half an ulp");
+
+        // Test an exact zero sum is only negative when rounding down
+        fp_op(ALU_FADD, FRM_RNE, 32'h3F80_0000, 32'hBF80_0000, 32'h0000_0000, "FADD 1 + -1 RNE");
+        fp_op(ALU_FADD, FRM_RDN, 32'h3F80_0000, 32'hBF80_0000, 32'h8000_0000, "FADD 1 + -1 RDN");
+        fp_op(ALU_FADD, FRM_RNE, 32'h8000_0000, 32'h8000_0000, 32'h8000_0000, "FADD -0 + -0");
+
+        // Test subnormal sums and differences cross the normal boundary both ways
+        fp_op(ALU_FSUB, FRM_RNE, 32'h0080_0000, 32'h007F_FFFF, 32'h0000_0001, "FSUB smallest normal - largest subnormal");
+        fp_op(ALU_FADD, FRM_RNE, 32'h0040_0000, 32'h0040_0000, 32'h0080_0000, "FADD subnormals to a normal");
+
+        // Test overflow goes to infinity unless rounding towards zero
+        fp_op(ALU_FADD, FRM_RNE, 32'h7F7F_FFFF, 32'h7F7F_FFFF, 32'h7F80_0000, "FADD overflow RNE");
+        fp_op(ALU_FADD, FRM_RTZ, 32'h7F7F_FFFF, 32'h7F7F_FFFF, 32'h7F7F_FFFF, "FADD overflow RTZ");
+
+        // Test multiplication in each direction, underflow to subnormals and overflow
+        fp_op(ALU_FMUL, FRM_RNE, 32'h4040_0000, 32'hC0E0_0000, 32'hC1A8_0000, "FMUL 3 * -7");
+        fp_op(ALU_FMUL, FRM_RNE, 32'h3DCC_CCCD, 32'h3DCC_CCCD, 32'h3C23_D70B, "FMUL 0.1 * 0.1 RNE");
+        fp_op(ALU_FMUL, FRM_RTZ, 32'h3DCC_CCCD, 32'h3DCC_CCCD, 32'h3C23_D70A, "FMUL 0.1 * 0.1 RTZ");
+        fp_op(ALU_FMUL, FRM_RNE, 32'h1E3C_E508, 32'h1E3C_E508, 32'h0001_16C2, "FMUL 1e-20 * 1e-20 is subnormal");
+        fp_op(ALU_FMUL, FRM_RNE, 32'h0000_0001, 32'h3F00_0000, 32'h0000_0000, "FMUL smallest subnormal / 2 RNE ties to even");
+        fp_op(ALU_FMUL, FRM_RUP, 32'h0000_0001, 32'h3F00_0000, 32'h0000_0001, "FMUL smallest subnormal / 2 RUP");
+        fp_op(ALU_FMUL, FRM_RNE, 32'h7149_F2CA, 32'h7149_F2CA, 32'h7F80_0000, "FMUL 1e30 * 1e30 overflow");
+        fp_op(ALU_FMUL, FRM_RUP, 32'h7149_F2CA, 32'hF149_F2CA, 32'hFF7F_FFFF, "FMUL 1e30 * -1e30 overflow RUP");
+
+        // Test special values
+        fp_op(ALU_FADD, FRM_RNE, 32'h7F80_0000, 32'hFF80_0000, FP_CANONICAL_NAN, "FADD inf + -inf");
+        fp_op(ALU_FADD, FRM_RNE, 32'h7F80_0001, 32'h3F80_0000, FP_CANONICAL_NAN, "FADD sNaN gives the canonical NaN");
+        fp_op(ALU_FSUB, FRM_RNE, 32'h3F80_0000, 32'h7F80_0000, 32'hFF80_0000, "FSUB 1 - inf");
+        fp_op(ALU_FMUL, FRM_RNE, 32'h0000_0000, 32'hFF80_0000, FP_CANONICAL_NAN, "FMUL 0 * -inf");
+        fp_op(ALU_FMUL, FRM_RNE, 32'h8000_0000, 32'h4040_0000, 32'h8000_0000, "FMUL -0 * 3");
+
+        // Test float to integer conversions round then saturate
+        fp_op(ALU_FCVT_W_S, FRM_RNE, 32'h4020_0000, 32'h0, 32'h0000_0002, "FCVT.W.S 2.5 RNE");
+        fp_op(ALU_FCVT_W_S, FRM_RNE, 32'h4060_0000, 32'h0, 32'h0000_0004, "FCVT.W.S 3.5 RNE");
+        fp_op(ALU_FCVT_W_S, FRM_RNE, 32'hC020_0000, 32'h0, 32'hFFFF_FFFE, "FCVT.W.S -2.5 RNE");
+        fp_op(ALU_FCVT_W_S, FRM_RMM, 32'hC020_0000, 32'h0, 32'hFFFF_FFFD, "FCVT.W.S -2.5 RMM");
+        fp_op(ALU_FCVT_W_S, FRM_RTZ, 32'hC02C_CCCD, 32'h0, 32'hFFFF_FFFE, "FCVT.W.S -2.7 RTZ");
+        fp_op(ALU_FCVT_W_S, FRM_RUP, 32'h4006_6666, 32'h0, 32'h0000_0003, "FCVT.W.S 2.1 RUP");
+        fp_op(ALU_FCVT_W_S, FRM_RDN, 32'hC006_6666, 32'h0, 32'hFFFF_FFFD, "FCVT.W.S -2.1 RDN");
+        fp_op(ALU_FCVT_W_S, FRM_RUP, 32'h3A83_126F, 32'h0, 32'h0000_0001, "FCVT.W.S 0.001 RUP");
+        fp_op(ALU_FCVT_W_S, FRM_RNE, 32'h4C80_0000, 32'h0, 32'h0400_0000, "FCVT.W.S 2^26 is already whole");
+        fp_op(ALU_FCVT_W_S, FRM_RNE, 32'h4F32_D05E, 32'h0, 32'h7FFF_FFFF, "FCVT.W.S 3e9 saturates");
+        fp_op(ALU_FCVT_W_S, FRM_RNE, 32'hCF32_D05E, 32'h0, 32'h8000_0000, "FCVT.W.S -3e9 saturates");
+        fp_op(ALU_FCVT_W_S, FRM_RNE, 32'h7FC0_0000, 32'h0, 32'h7FFF_FFFF, "FCVT.W.S NaN");
+        fp_op(ALU_FCVT_WU_S, FRM_RNE, 32'h4F32_D05E, 32'h0, 32'hB2D0_5E00, "FCVT.WU.S 3e9");
+        fp_op(ALU_FCVT_WU_S, FRM_RNE, 32'h4F7F_FFFF, 32'h0, 32'hFFFF_FF00, "FCVT.WU.S largest below 2^32");
+        fp_op(ALU_FCVT_WU_S, FRM_RNE, 32'hBF80_0000, 32'h0, 32'h0000_0000, "FCVT.WU.S -1 saturates");
+
+        // Test integer to float conversions round above 2^24
+        fp_op(ALU_FCVT_S_W, FRM_RNE, 32'h0000_0007, 32'h0, 32'h40E0_0000, "FCVT.S.W 7");
+        fp_op(ALU_FCVT_S_W, FRM_RNE, 32'hFFFF_FFFF, 32'h0, 32'hBF80_0000, "FCVT.S.W -1");
+        fp_op(ALU_FCVT_S_W, FRM_RNE, 32'h8000_0000, 32'h0, 32'hCF00_0000, "FCVT.S.W -2^31");
+        fp_op(ALU_FCVT_S_W, FRM_RNE, 32'h0000_0000, 32'h0, 32'h0000_0000, "FCVT.S.W 0");
+        fp_op(ALU_FCVT_S_W, FRM_RNE, 32'h0100_0001, 32'h0, 32'h4B80_0000, "FCVT.S.W 2^24 + 1 RNE");
+        fp_op(ALU_FCVT_S_W, FRM_RNE, 32'h0100_0003, 32'h0, 32'h4B80_0002, "FCVT.S.W 2^24 + 3 RNE");
+        fp_op(ALU_FCVT_S_W, FRM_RUP, 32'h0100_0001, 32'h0, 32'h4B80_0001, "FCVT.S.W 2^24 + 1 RUP");
+        fp_op(ALU_FCVT_S_WU, FRM_RNE, 32'hFFFF_FFFF, 32'h0, 32'h4F80_0000, "FCVT.S.WU 2^32 - 1 RNE");
+        fp_op(ALU_FCVT_S_WU, FRM_RTZ, 32'hFFFF_FFFF, 32'h0, 32'h4F7F_FFFF, "FCVT.S.WU 2^32 - 1 RTZ");
+
+        // Test compares, NaNs are unordered and the zeros are equal
+        fp_op(ALU_FLT, FRM_RNE, 32'hC000_0000, 32'hBF80_0000, 32'h0000_0001, "FLT -2 < -1");
+        fp_op(ALU_FLE, FRM_RNE, 32'h8000_0000, 32'h0000_0000, 32'h0000_0001, "FLE -0 <= 0");
+        fp_op(ALU_FLT, FRM_RNE, 32'h8000_0000, 32'h0000_0000, 32'h0000_0000, "FLT -0 < 0");
+        fp_op(ALU_FEQ, FRM_RNE, 32'h8000_0000, 32'h0000_0000, 32'h0000_0001, "FEQ -0 == 0");
+        fp_op(ALU_FEQ, FRM_RNE, 32'h7FC0_0000, 32'h7FC0_0000, 32'h0000_0000, "FEQ NaN == NaN");
+        fp_op(ALU_FLE, FRM_RNE, 32'h7FC0_0000, 32'h3F80_0000, 32'h0000_0000, "FLE NaN <= 1");
+
+        // Test min/max order the zeros and only return a NaN when both are
+        fp_op(ALU_FMIN, FRM_RNE, 32'h0000_0000, 32'h8000_0000, 32'h8000_0000, "FMIN 0, -0");
+        fp_op(ALU_FMAX, FRM_RNE, 32'h8000_0000, 32'h0000_0000, 32'h0000_0000, "FMAX -0, 0");
+        fp_op(ALU_FMAX, FRM_RNE, 32'hC000_0000, 32'hBF80_0000, 32'hBF80_0000, "FMAX -2, -1");
+        fp_op(ALU_FMIN, FRM_RNE, 32'h7FC0_0000, 32'h3F80_0000, 32'h3F80_0000, "FMIN NaN, 1");
+        fp_op(ALU_FMAX, FRM_RNE, 32'h7F80_0001, 32'h7FC0_0000, FP_CANONICAL_NAN, "FMAX NaN, NaN");
+
+        // Test sign injection and classify
+        fp_op(ALU_FSGNJ, FRM_RNE, 32'h3F80_0000, 32'h8000_0000, 32'hBF80_0000, "FSGNJ");
+        fp_op(ALU_FSGNJN, FRM_RNE, 32'h3F80_0000, 32'h8000_0000, 32'h3F80_0000, "FSGNJN");
+        fp_op(ALU_FSGNJX, FRM_RNE, 32'hBF80_0000, 32'h8000_0000, 32'h3F80_0000, "FSGNJX");
+        fp_op(ALU_FCLASS, FRM_RNE, 32'hFF80_0000, 32'h0, 32'h0000_0001, "FCLASS -inf");
+        fp_op(ALU_FCLASS, FRM_RNE, 32'hBF80_0000, 32'h0, 32'h0000_0002, "FCLASS negative normal");
+        fp_op(ALU_FCLASS, FRM_RNE, 32'h8000_0000, 32'h0, 32'h0000_0008, "FCLASS -0");
+        fp_op(ALU_FCLASS, FRM_RNE, 32'h0000_0001, 32'h0, 32'h0000_0020, "FCLASS positive subnormal");
+        fp_op(ALU_FCLASS, FRM_RNE, 32'h7F80_0001, 32'h0, 32'h0000_0100, "FCLASS sNaN");
+        fp_op(ALU_FCLASS, FRM_RNE, 32'h7FC0_0000, 32'h0, 32'h0000_0200, "FCLASS qNaN");
+
+        // Test back to back issue produces one result per cycle with its own rounding mode
+        ALU_Control_E <= ALU_FMUL;
+        RM_E <= FRM_RTZ;
+        SrcA_E <= 32'h3DCC_CCCD;
+        SrcB_E <= 32'h3DCC_CCCD;
+        @(posedge CLK);
+        ALU_Control_E <= ALU_FADD;
+        RM_E <= FRM_RUP;
+        SrcA_E <= 32'h3F80_0000;
+        SrcB_E <= 32'h322B_CC77;
+        @(posedge CLK);
+        ALU_Control_E <= ALU_ADD;
+        @(posedge CLK);
+        assert (FPU_W && FPU_Out_W == 32'h3C23_D70A) else $error("Error: First back to back FMUL, expected 0x3C23D70A, got 0x%h", $sampled(FPU_Out_W));
+        @(posedge CLK);
+        assert (FPU_W && FPU_Out_W == 32'h3F80_0001) else $error("Error: Second back to back FADD, expected 0x3F800001, got 0x%h", $sampled(FPU_Out_W));
+        @(posedge CLK);
+        assert (!FPU_W) else $error("Error: Integer instruction selected the FPU result");
+
+        // Test a stalled writeback holds the result
+        ALU_Control_E <= ALU_FCVT_S_W;
+        RM_E <= FRM_RNE;
+        SrcA_E <= 32'h0000_0007;
+        @(posedge CLK);
+        ALU_Control_E <= ALU_ADD;
+        @(posedge CLK);
+        Stall_M <= 1;
+        Stall_W <= 1;
+        @(posedge CLK);
+        @(posedge CLK);
+        assert (FPU_W && FPU_Out_W == 32'h40E0_0000) else $error("Error: Result not held during stall, expected 0x40E00000, got 0x%h", $sampled(FPU_Out_W));
+        Stall_M <= 0;
+        Stall_W <= 0;
+        @(posedge CLK);
+
+        // Test division rounds in each direction and into the subnormal range
+        fp_divide(ALU_FDIV, FRM_RNE, 32'h3F80_0000, 32'h4040_0000, 32'h3EAA_AAAB, 0, "FDIV 1 / 3 RNE");
+        fp_divide(ALU_FDIV, FRM_RTZ, 32'h3F80_0000, 32'h4040_0000, 32'h3EAA_AAAA, 0, "FDIV 1 / 3 RTZ");
+        fp_divide(ALU_FDIV, FRM_RDN, 32'hC000_0000, 32'h4040_0000, 32'hBF2A_AAAB, 0, "FDIV -2 / 3 RDN");
+        fp_divide(ALU_FDIV, FRM_RNE, 32'h43B1_8000, 32'h42E2_0000, 32'h4049_0FDC, 0, "FDIV 355 / 113");
+        fp_divide(ALU_FDIV, FRM_RNE, 32'h006C_E3EE, 32'h4974_2400, 32'h0000_0007, 0, "FDIV 1e-38 / 1e6 is subnormal");
+        fp_divide(ALU_FDIV, FRM_RUP, 32'h0000_0001, 32'h4040_0000, 32'h0000_0001, 0, "FDIV smallest subnormal / 3 RUP");
+        fp_divide(ALU_FDIV, FRM_RNE, 32'h7E96_7699, 32'h3A83_126F, 32'h7F80_0000, 0, "FDIV 1e38 / 0.001 overflow");
+
+        // Test division special values finish straight away
+        fp_divide(ALU_FDIV, FRM_RNE, 32'hBF80_0000, 32'h0000_0000, 32'hFF80_0000, 1, "FDIV -1 / 0");
+        fp_divide(ALU_FDIV, FRM_RNE, 32'h0000_0000, 32'h0000_0000, FP_CANONICAL_NAN, 1, "FDIV 0 / 0");
+        fp_divide(ALU_FDIV, FRM_RNE, 32'h3F80_0000, 32'hFF80_0000, 32'h8000_0000, 1, "FDIV 1 / -inf");
+
+        // Test square roots of normals, subnormals and special values
+        fp_divide(ALU_FSQRT, FRM_RNE, 32'h4000_0000, 32'h0, 32'h3FB5_04F3, 0, "FSQRT 2 RNE");
+        fp_divide(ALU_FSQRT, FRM_RUP, 32'h4000_0000, 32'h0, 32'h3FB5_04F4, 0, "FSQRT 2 RUP");
+        fp_divide(ALU_FSQRT, FRM_RNE, 32'h4110_0000, 32'h0, 32'h4040_0000, 0, "FSQRT 9 is exact");
+        fp_divide(ALU_FSQRT, FRM_RTZ, 32'h3F00_0000, 32'h0, 32'h3F35_04F3, 0, "FSQRT 0.5 RTZ");
+        fp_divide(ALU_FSQRT, FRM_RNE, 32'h0000_0001, 32'h0, 32'h1A35_04F3, 0, "FSQRT smallest subnormal");
+        fp_divide(ALU_FSQRT, FRM_RNE, 32'h0001_16C2, 32'h0, 32'h1E3C_E4E7, 0, "FSQRT 1e-40");
+        fp_divide(ALU_FSQRT, FRM_RNE, 32'h8000_0000, 32'h0, 32'h8000_0000, 1, "FSQRT -0");
+        fp_divide(ALU_FSQRT, FRM_RNE, 32'hBF80_0000, 32'h0, FP_CANONICAL_NAN, 1, "FSQRT -1");
+
+        // Test the result is held until writeback takes it
+        ALU_Control_E <= ALU_FDIV;
+        SrcA_E <= 32'h4040_0000;
+        SrcB_E <= 32'h3F80_0000;
+        RD_E <= 5'd9;
+        @(posedge CLK);
+        ALU_Control_E <= ALU_ADD;
+        repeat (FP_DIV_CYCLES + 5) @(posedge CLK);
+        assert (FDIV_Done && FDIV_Busy && FDIV_Out == 32'h4040_0000 && FDIV_RD == 5'd9) else $error("Error: Result not held, got 0x%h for x%0d", $sampled(FDIV_Out), $sampled(FDIV_RD));
+        FDIV_W_En <= 1;
+        @(posedge CLK);
+        assert (!FDIV_Busy) else $error("Error: FP divider should free its destination as it is written");
+        FDIV_W_En <= 0;
+        @(posedge CLK);
+        assert (!FDIV_Done) else $error("Error: FP divider should be idle once written");
+
+        repeat (5) @ (posedge CLK); // Allow some extra time at the end for visual clarity
+        $stop;
+    end
+
+    // Issue an FP pipeline operation and check the result two cycles later in writeback
+    task fp_op(
+        input logic [ALU_CONTROL_WIDTH-1:0] op,
+        input logic [2:0] rm,
+        input logic [31:0] a,
+        input logic [31:0] b,
+        input logic [31:0] expected_FPU_Out_W,
+        input string name
+    );
+    begin
+        ALU_Control_E <= op;
+        RM_E <= rm;
+        SrcA_E <= a;
+        SrcB_E <= b;
+        repeat (2) @(posedge CLK); // Operands registered into memory then the unrounded result into writeback
+        @(posedge CLK);
+        assert (FPU_W && FPU_Out_W == expected_FPU_Out_W) else $error("Error: %s, expected 0x%h, got 0x%h", name, expected_FPU_Out_W, $sampled(FPU_Out_W));
+    end
+    endtask
+
+    // Issue a divide or square root, check it finishes exactly when expected then hand it to writeback
+    task fp_divide(
+        input logic [ALU_CONTROL_WIDTH-1:0] op,
+        input logic [2:0] rm,
+        input logic [31:0] a,
+        input logic [31:0] b,
+        input logic special, // NaN, infinity or zero operands are answered without iterating
+        input logic [31:0] expected_FDIV_Out,
+        input string name
+    );
+    int cycles;
+    begin
+        cycles = (special) ? 1 : FP_DIV_CYCLES + 2; // Bits, then rounding, then the result is registered
+        ALU_Control_E <= op;
+        RM_E <= rm;
+        SrcA_E <= a;
+        SrcB_E <= b;
+        RD_E <= 5'd3;
+        @(posedge CLK); // Divide leaves execute
+        ALU_Control_E <= ALU_ADD;
+        repeat (cycles - 1) begin
+            @(posedge CLK);
+            assert (!FDIV_Done) else $error("Error: %s, finished before %0d cycles", name, cycles);
+        end
+        @(posedge CLK);
+        assert (FDIV_Done) else $error("Error: %s, not finished after %0d cycles", name, cycles);
+        assert (FDIV_Out == expected_FDIV_Out) else $error("Error: %s, expected 0x%h, got 0x%h", name, expected_FDIV_Out, $sampled(FDIV_Out));
+        assert (FDIV_RD == 5'd3) else $error("Error: %s, expected rd x3, got x%0d", name, $sampled(FDIV_RD));
+        FDIV_W_En <= 1; // Writeback takes the result
+        @(posedge CLK);
+        FDIV_W_En <= 0;
+    end
+    endtask
+endmodule
@@ -0,0 +1,113 @@
+//////////////////////////////////////////////////////////////////////////////////                                                           
+// Third Year Project: RISC-V RV32i Pipelined Processor
+// File: Multiplier Testbench                                                   
+// Description: This is a testbench to ensure that the multiplier produces the correct product for each M-Extension variant
+//              two cycles after the operands are presented and holds it while writeback is stalled.
+// Author: Luke Shepherd                                                     
+// Date Created: October 2026                                                                                                                                                                                                                                                      
+//////////////////////////////////////////////////////////////////////////////////
+
+import definitions::*;
+
+module multiplier_testbench;
+    logic CLK; // Wrap module with a clock to better represent the outside system
+
+    // Input signals
+    logic Stall_M, Stall_W;
+    logic [ALU_CONTROL_WIDTH-1:0] ALU_Control;
+    logic [31:0] SrcA, SrcB;
+
+    // Output signals
+    logic [31:0] MUL_Out;
+
+    multiplier mul (
+        .CLK(CLK),
+        .Stall_M(Stall_M),
+        .Stall_W(Stall_W),
+        .ALU_Control_E(ALU_Control),
+        .SrcA_E(SrcA),
+        .SrcB_E(SrcB),
+        .MUL_Out_W(MUL_Out)
+    );
+
+    initial CLK <= 1; // Initialize the clock
+    always #(CLOCK_PERIOD / 2) CLK <= ~CLK; // Generate the clock
+
+    initial begin
+        // Initialize signals
+        Stall_M <= 0;
+        Stall_W <= 0;
+        ALU_Control <= ALU_MUL;
+        SrcA <= 32'h0;
+        SrcB <= 32'h0;
+        @(posedge CLK);
+
+        // Test basic signed multiply keeps the lower half
+        multiply(ALU_MUL, 32'h0000_0007, 32'hFFFF_FFFD, 32'hFFFF_FFEB); // 7 * -3 = -21
+
+        // Test lower half is the same for every variant of sign
+        multiply(ALU_MUL, 32'h1234_5678, 32'h9ABC_DEF0, 32'h242D_2080);
+
+        // Test upper half signed x signed
+        multiply(ALU_MULH, 32'h1234_5678, 32'h9ABC_DEF0, 32'hF8CC_93D6);
+        multiply(ALU_MULH, 32'h8000_0000, 32'h8000_0000, 32'h4000_0000); // Most negative squared
+        multiply(ALU_MULH, 32'hFFFF_FFFF, 32'h0000_0001, 32'hFFFF_FFFF); // -1 * 1 sign extends into the upper half
+
+        // Test upper half signed x unsigned
+        multiply(ALU_MULHSU, 32'h1234_5678, 32'h9ABC_DEF0, 32'h0B00_EA4E);
+        multiply(ALU_MULHSU, 32'hFFFF_FFFF, 32'hFFFF_FFFF, 32'hFFFF_FFFF); // -1 * (2^32 - 1)
+
+        // Test upper half unsigned x unsigned
+        multiply(ALU_MULHU, 32'hFFFF_FFFF, 32'hFFFF_FFFF, 32'hFFFF_FFFE);
+
+        // Test back to back issue produces one product per cycle
+        ALU_Control <= ALU_MUL;
+        SrcA <= 32'h0000_0003;
+        SrcB <= 32'h0000_0005;
+        @(posedge CLK);
+        ALU_Control <= ALU_MULHU;
+        SrcA <= 32'hFFFF_FFFF;
+        SrcB <= 32'h0000_0002;
+        @(posedge CLK);
+        ALU_Control <= ALU_MUL;
+        SrcA <= 32'h0;
+        SrcB <= 32'h0;
+        @(posedge CLK);
+        assert (MUL_Out == 32'h0000_000F) else $error("Error: Incorrect result produced for first back to back MUL, expected 0x0000000F, got 0x%h", $sampled(MUL_Out));
+        @(posedge CLK);
+        assert (MUL_Out == 32'h0000_0001) else $error("Error: Incorrect result produced for second back to back MULHU, expected 0x00000001, got 0x%h", $sampled(MUL_Out));
+
+        // Test a stalled writeback holds the product
+        ALU_Control <= ALU_MUL;
+        SrcA <= 32'h0000_0006;
+        SrcB <= 32'h0000_0007;
+        @(posedge CLK);
+        SrcA <= 32'h0;
+        @(posedge CLK);
+        Stall_M <= 1;
+        Stall_W <= 1;
+        @(posedge CLK);
+        @(posedge CLK);
+        assert (MUL_Out == 32'h0000_002A) else $error("Error: Product not held during stall, expected 0x0000002A, got 0x%h", $sampled(MUL_Out));
+        Stall_M <= 0;
+        Stall_W <= 0;
+
+        repeat (5) @ (posedge CLK); // Allow some extra time at the end for visual clarity
+        $stop;
+    end
+
+    task multiply(
+        input logic [ALU_CONTROL_WIDTH-1:0] control,
+        input logic [31:0] a, b,
+        input logic [31:0] expected_MUL_Out
+    );
+    begin
+        ALU_Control <= control;
+        SrcA <= a;
+        SrcB <= b;
+        repeat (2) @(posedge CLK); // Operands registered into memory then the product into writeback
+        @(posedge CLK);
+        assert (MUL_Out == expected_MUL_Out) else $error("Error: Incorrect result produced for %h * %h (ALU_Control %h), expected 0x%h, got 0x%h", a, b, control, expected_MUL_Out, $sampled(MUL_Out));
+    end
+    endtask
+endmodule
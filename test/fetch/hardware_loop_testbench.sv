@@ -0,0 +1,161 @@
+//////////////////////////////////////////////////////////////////////////////////
+// Third Year Project: RISC-V RV32i Pipelined Processor
+// File: Hardware Loop Testbench
+// Description: Ensures fetch loops back from the last instruction the right number of times,
+//              that execute's count follows it and that a redirect puts fetch's count back.
+// Author: Luke Shepherd
+// Date Created: October 2026
+//////////////////////////////////////////////////////////////////////////////////
+
+import definitions::*;
+
+module hardware_loop_testbench;
+    logic CLK, RST; // Wrap module with a clock to control the sim more easily and better represent the external system
+
+    // Input signals
+    logic PC_En, Restore, Resolve_E;
+    logic [31:0] PC_F;
+    logic [ALU_CONTROL_WIDTH-1:0] ALU_Control_E;
+    logic Loop_E;
+    logic [4:0] Offset_E;
+    logic [31:0] PC_E, PC_Plus_4_E, PC_Target_E, SrcA_E, Imm_Ext_E;
+
+    // Output signals
+    logic Loop_Back_F;
+    logic [31:0] Loop_Start_F;
+
+    hardware_loop hwloop (
+        .CLK(CLK),
+        .RST(RST),
+        .PC_En(PC_En),
+        .Restore(Restore),
+        .Resolve_E(Resolve_E),
+        .PC_F(PC_F),
+        .ALU_Control_E(ALU_Control_E),
+        .Loop_E(Loop_E),
+        .Offset_E(Offset_E),
+        .PC_E(PC_E),
+        .PC_Plus_4_E(PC_Plus_4_E),
+        .PC_Target_E(PC_Target_E),
+        .SrcA_E(SrcA_E),
+        .Imm_Ext_E(Imm_Ext_E),
+        .Loop_Back_F(Loop_Back_F),
+        .Loop_Start_F(Loop_Start_F)
+    );
+
+    initial CLK <= 1; // Initialize the clock
+    always #(CLOCK_PERIOD / 2) CLK <= ~CLK; // Generate the clock
+
+    initial begin
+        // Initialize signals with reset
+        RST <= 1;
+        PC_En <= 1;
+        Restore <= 0;
+        Resolve_E <= 1;
+        PC_F <= 32'h0;
+        ALU_Control_E <= ALU_ADD;
+        Loop_E <= 0;
+        Offset_E <= 5'b0;
+        PC_E <= 32'h2A2A_2A2A; // Bubble
+        PC_Plus_4_E <= 32'h2A2A_2A2A;
+        PC_Target_E <= 32'h0;
+        SrcA_E <= 32'h0;
+        Imm_Ext_E <= 32'h0;
+        @(posedge CLK);
+        RST <= 0;
+
+        // Test no loop is active after reset
+        PC_F <= 32'h0000_010C;
+        @(posedge CLK);
+        assert (!Loop_Back_F) else $error("Error: Loop active after reset");
+
+        // LP.SETUPI 0, 3, +16 at 0x100 loops over 0x104-0x10C, setting up refetches so fetch's count is restored
+        ALU_Control_E <= ALU_LP_SETUPI;
+        PC_E <= 32'h0000_0100;
+        PC_Plus_4_E <= 32'h0000_0104;
+        Offset_E <= 5'd4;
+        Imm_Ext_E <= 32'd3;
+        Restore <= 1;
+        @(posedge CLK);
+        ALU_Control_E <= ALU_ADD;
+        PC_E <= 32'h2A2A_2A2A;
+        PC_Plus_4_E <= 32'h2A2A_2A2A;
+        Restore <= 0;
+
+        // Test fetch goes round twice then falls through on the third pass
+        fetch(32'h0000_0108, 0, "Not the last instruction");
+        fetch(32'h0000_010C, 1, "First pass");
+        fetch(32'h0000_010C, 1, "Second pass");
+        fetch(32'h0000_010C, 0, "Third pass falls through");
+        fetch(32'h0000_010C, 0, "Loop finished");
+
+        // Test a redirect puts fetch's count back to execute's, which hasn't seen any of the loop ends
+        Restore <= 1;
+        @(posedge CLK);
+        Restore <= 0;
+        fetch(32'h0000_010C, 1, "Restored first pass");
+
+        // Test a held fetch doesn't use up an iteration
+        PC_En <= 0;
+        fetch(32'h0000_010C, 1, "Held");
+        fetch(32'h0000_010C, 1, "Held again");
+        PC_En <= 1;
+        fetch(32'h0000_010C, 1, "Second pass after hold");
+        fetch(32'h0000_010C, 0, "Third pass after hold");
+
+        // Test execute counts the same loop ends, a held instruction doesn't count
+        PC_F <= 32'h0;
+        PC_E <= 32'h0000_010C;
+        @(posedge CLK);
+        Resolve_E <= 0;
+        @(posedge CLK);
+        Resolve_E <= 1;
+        PC_E <= 32'h2A2A_2A2A;
+        Restore <= 1;
+        @(posedge CLK);
+        Restore <= 0;
+        fetch(32'h0000_010C, 1, "Restored after execute passed the end once");
+        fetch(32'h0000_010C, 0, "Restored third pass");
+
+        // Test the outer loop only goes round once the inner loop that ends with it has finished
+        ALU_Control_E <= ALU_LP_SETUP; // LP.SETUP 1, x, +16 at 0x100 with a count of 2
+        Loop_E <= 1;
+        PC_E <= 32'h0000_0100;
+        PC_Plus_4_E <= 32'h0000_0104;
+        PC_Target_E <= 32'h0000_0110;
+        SrcA_E <= 32'd2;
+        Restore <= 1;
+        @(posedge CLK);
+        ALU_Control_E <= ALU_LP_SETUPI; // LP.SETUPI 0, 2, +12 at 0x104
+        Loop_E <= 0;
+        PC_E <= 32'h0000_0104;
+        PC_Plus_4_E <= 32'h0000_0108;
+        Offset_E <= 5'd3; // Loops over 0x108-0x10C
+        Imm_Ext_E <= 32'd2;
+        @(posedge CLK);
+        ALU_Control_E <= ALU_ADD;
+        PC_E <= 32'h2A2A_2A2A;
+        PC_Plus_4_E <= 32'h2A2A_2A2A;
+        Restore <= 0;
+        fetch(32'h0000_010C, 1, "Inner first pass");
+        assert (Loop_Start_F == 32'h0000_0108) else $error("Error: Inner loop start wrong, got 0x%h", $sampled(Loop_Start_F));
+        fetch(32'h0000_010C, 1, "Outer first pass");
+        assert (Loop_Start_F == 32'h0000_0104) else $error("Error: Outer loop start wrong, got 0x%h", $sampled(Loop_Start_F));
+        fetch(32'h0000_010C, 0, "Outer loop falls through");
+
+        repeat (5) @ (posedge CLK); // Allow some extra time at the end for visual clarity
+        $stop;
+    end
+
+    task fetch(
+        input logic [31:0] pc,
+        input logic expected_Loop_Back_F,
+        input string name
+    );
+    begin
+        PC_F <= pc;
+        @(posedge CLK);
+        assert (Loop_Back_F == expected_Loop_Back_F) else $error("Error: %s, expected loop back %0d, got %0d", name, expected_Loop_Back_F, $sampled(Loop_Back_F));
+    end
+    endtask
+endmodule
@@ -3,51 +3,99 @@
 // File: Hazard Control Unit Testbench                                                
 // Description: Ensures that the hazard control unit produces the correct control signals for pipeline inputs.
 // Author: Luke Shepherd                                                     
-// Date Modified: March 2025                                                                                                                                                                                                                                                       
+// Date Modified: October 2026                                                                                                                                                                                                                                                       
 //////////////////////////////////////////////////////////////////////////////////
 
 import definitions::*;
 
 module hazard_control_unit_testbench;
-    logic CLK; // Wrap module with a clock to better represent the outside system
+    logic CLK, RST; // Wrap module with a clock to better represent the outside system, the load scoreboard uses it
 
     // Input signals
     logic [4:0] RS1_D, RS2_D, RD_E;
     logic [1:0] Result_Src_Sel_E;
     logic [4:0] RS1_E, RS2_E, RD_M, RD_W;
-    logic REG_W_En_M, REG_W_En_W;
-    logic Branch_Taken_E, Predict_Taken_E;
+    logic REG_W_En_E, REG_W_En_M, REG_W_En_W;
+    logic [1:0] FWD_SrcA_E, FWD_SrcB_E;
+    logic [4:0] RD_D, DIV_RD;
+    logic REG_W_En_D, DIV_Busy, DIV_Done;
+    logic [4:0] FDIV_RD;
+    logic FDIV_Busy, FDIV_Done;
+    logic Load_Miss_M, Fill_Done, Fill_W_En;
+    logic [4:0] Fill_RD;
+    logic CFU_Wait_E;
+    logic [ALU_CONTROL_WIDTH-1:0] ALU_Control_D, ALU_Control_E;
+    logic Branch_Taken_E, Predict_Taken_E, Redirect_En;
+    logic Instr_Ready_F, MEM_W_En_M, Data_Ready_M, Data_Valid_W;
+    logic [1:0] Result_Src_Sel_M, Result_Src_Sel_W;
 
     // Output signals
     logic [1:0] FWD_SrcA, FWD_SrcB;
-    logic Stall_En, Flush_D, Flush_E, PC_En;
+    logic [1:0] FWD_SrcA_D, FWD_SrcB_D;
+    logic Stall_En, Flush_D, Flush_E, Flush_M, PC_En;
+    logic Stall_E, Stall_M, Stall_W, Flush_W;
 
     hazard_control_unit hcu (
+        .CLK(CLK),
+        .RST(RST),
         .RS1_D(RS1_D), 
         .RS2_D(RS2_D), 
         .RD_E(RD_E),
         .Result_Src_Sel_E(Result_Src_Sel_E),
+        .REG_W_En_E(REG_W_En_E),
         .RS1_E(RS1_E), 
         .RS2_E(RS2_E), 
         .RD_M(RD_M), 
         .RD_W(RD_W),
         .REG_W_En_M(REG_W_En_M), 
         .REG_W_En_W(REG_W_En_W),
+        .FWD_SrcA_E(FWD_SrcA_E),
+        .FWD_SrcB_E(FWD_SrcB_E),
+        .RD_D(RD_D),
+        .REG_W_En_D(REG_W_En_D),
+        .ALU_Control_D(ALU_Control_D),
+        .ALU_Control_E(ALU_Control_E),
+        .DIV_Busy(DIV_Busy),
+        .DIV_Done(DIV_Done),
+        .DIV_RD(DIV_RD),
+        .FDIV_Busy(FDIV_Busy),
+        .FDIV_Done(FDIV_Done),
+        .FDIV_RD(FDIV_RD),
+        .Load_Miss_M(Load_Miss_M),
+        .Fill_Done(Fill_Done),
+        .Fill_W_En(Fill_W_En),
+        .Fill_RD(Fill_RD),
+        .CFU_Wait_E(CFU_Wait_E),
         .Branch_Taken_E(Branch_Taken_E), 
         .Predict_Taken_E(Predict_Taken_E),
+        .Redirect_En(Redirect_En),
+        .Instr_Ready_F(Instr_Ready_F),
+        .MEM_W_En_M(MEM_W_En_M),
+        .Result_Src_Sel_M(Result_Src_Sel_M),
+        .Result_Src_Sel_W(Result_Src_Sel_W),
+        .Data_Ready_M(Data_Ready_M),
+        .Data_Valid_W(Data_Valid_W),
         .FWD_SrcA(FWD_SrcA), 
         .FWD_SrcB(FWD_SrcB),
+        .FWD_SrcA_D(FWD_SrcA_D),
+        .FWD_SrcB_D(FWD_SrcB_D),
         .Stall_En(Stall_En), 
         .Flush_D(Flush_D), 
         .Flush_E(Flush_E), 
-        .PC_En(PC_En)
+        .Flush_M(Flush_M),
+        .PC_En(PC_En),
+        .Stall_E(Stall_E),
+        .Stall_M(Stall_M),
+        .Stall_W(Stall_W),
+        .Flush_W(Flush_W)
     );
 
     initial CLK <= 1; // Initialize the clock
     always #(CLOCK_PERIOD / 2) CLK <= ~CLK; // Generate the clock
 
     initial begin
-        // Initialize signals
+        // Initialize signals with reset
+        RST <= 1'b1;
         RS1_D <= 5'b0;
         RS2_D <= 5'b0;
         RD_E <= 5'b0;
@@ -56,11 +104,37 @@ module hazard_control_unit_testbench;
         RS2_E <= 5'b0;
         RD_M <= 5'b0;
         RD_W <= 5'b0;
+        REG_W_En_E <= 1'b0;
         REG_W_En_M <= 1'b0;
         REG_W_En_W <= 1'b0;
+        FWD_SrcA_E <= FWD_NONE;
+        FWD_SrcB_E <= FWD_NONE;
+        RD_D <= 5'b0;
+        REG_W_En_D <= 1'b0;
+        ALU_Control_D <= ALU_ADD;
+        ALU_Control_E <= ALU_ADD;
+        DIV_Busy <= 1'b0;
+        DIV_Done <= 1'b0;
+        DIV_RD <= 5'b0;
+        FDIV_Busy <= 1'b0;
+        FDIV_Done <= 1'b0;
+        FDIV_RD <= 5'b0;
+        Load_Miss_M <= 1'b0;
+        Fill_Done <= 1'b0;
+        Fill_W_En <= 1'b0;
+        Fill_RD <= 5'b0;
+        CFU_Wait_E <= 1'b0;
         Branch_Taken_E <= 1'b0;
         Predict_Taken_E <= 1'b0;
+        Redirect_En <= 1'b0;
+        Instr_Ready_F <= 1'b1; // Memory always ready unless testing back-pressure
+        MEM_W_En_M <= 1'b0;
+        Result_Src_Sel_M <= RESULT_ALU;
+        Result_Src_Sel_W <= RESULT_ALU;
+        Data_Ready_M <= 1'b1;
+        Data_Valid_W <= 1'b1;
         @(posedge CLK);
+        RST <= 1'b0;
 
         // Test regular operation 
         RS1_D <= 5'b00000;  // x0
@@ -76,7 +150,7 @@ module hazard_control_unit_testbench;
         Branch_Taken_E <= 1'b0; // Ensure branch and predict taken are the same
         Predict_Taken_E <= 1'b0;
         @(posedge CLK);
-        check_signals(FWD_NONE, FWD_NONE, 0, 0, 0, 1);
+        check_signals(FWD_NONE, FWD_NONE, 0, 0, 0, 0, 1);
 
         // Test regular operation with partial condition passing
         RS1_D <= 5'b00011;  // x3
@@ -92,7 +166,7 @@ module hazard_control_unit_testbench;
         Branch_Taken_E <= 1'b0; // Ensure branch and predict taken are the same
         Predict_Taken_E <= 1'b0;
         @(posedge CLK);
-        check_signals(FWD_NONE, FWD_NONE, 0, 0, 0, 1);
+        check_signals(FWD_NONE, FWD_NONE, 0, 0, 0, 0, 1);
 
         // Test regular operation with partial condition passing
         RS1_D <= 5'b00011;  // x3
@@ -108,7 +182,7 @@ module hazard_control_unit_testbench;
         Branch_Taken_E <= 1'b0; // Ensure branch and predict taken are the same
         Predict_Taken_E <= 1'b0;
         @(posedge CLK);
-        check_signals(FWD_NONE, FWD_NONE, 0, 0, 0, 1);
+        check_signals(FWD_NONE, FWD_NONE, 0, 0, 0, 0, 1);
 
         // Test SrcA memory forwarding
         RS1_D <= 5'b00000;  // N/A
@@ -124,7 +198,7 @@ module hazard_control_unit_testbench;
         Branch_Taken_E <= 1'b0; // Ensure no branch misprediction
         Predict_Taken_E <= 1'b0;
         @(posedge CLK);
-        check_signals(FWD_MEM, FWD_NONE, 0, 0, 0, 1);
+        check_signals(FWD_MEM, FWD_NONE, 0, 0, 0, 0, 1);
 
         // Test SrcA writeback forwarding
         RS1_D <= 5'b00000;  // N/A
@@ -140,7 +214,7 @@ module hazard_control_unit_testbench;
         Branch_Taken_E <= 1'b0; // Ensure no branch misprediction
         Predict_Taken_E <= 1'b0;
         @(posedge CLK);
-        check_signals(FWD_WB, FWD_NONE, 0, 0, 0, 1);
+        check_signals(FWD_WB, FWD_NONE, 0, 0, 0, 0, 1);
 
         // Test SrcB memory forwarding
         RS1_D <= 5'b00000;  // N/A
@@ -156,7 +230,7 @@ module hazard_control_unit_testbench;
         Branch_Taken_E <= 1'b0; // Ensure no branch misprediction
         Predict_Taken_E <= 1'b0;
         @(posedge CLK);
-        check_signals(FWD_NONE, FWD_MEM, 0, 0, 0, 1);
+        check_signals(FWD_NONE, FWD_MEM, 0, 0, 0, 0, 1);
 
         // Test SrcB writeback forwarding
         RS1_D <= 5'b00000;  // N/A
@@ -172,7 +246,7 @@ module hazard_control_unit_testbench;
         Branch_Taken_E <= 1'b0; // Ensure no branch misprediction
         Predict_Taken_E <= 1'b0;
         @(posedge CLK);
-        check_signals(FWD_NONE, FWD_WB, 0, 0, 0, 1);
+        check_signals(FWD_NONE, FWD_WB, 0, 0, 0, 0, 1);
 
         // Test branch misprediction untaken
         RS1_D <= 5'b00000;  // N/A
@@ -188,7 +262,7 @@ module hazard_control_unit_testbench;
         Branch_Taken_E <= 1'b1; // Mispredict untaken
         Predict_Taken_E <= 1'b0;
         @(posedge CLK);
-        check_signals(FWD_NONE, FWD_NONE, 0, 1, 1, 1); // Should flush both stages
+        check_signals(FWD_NONE, FWD_NONE, 0, !REGISTERED_REDIRECT, !REGISTERED_REDIRECT, 0, 1); // Should flush both stages unless the redirect is registered
         
         // Test branch misprediction taken
         RS1_D <= 5'b00000;  // N/A
@@ -204,7 +278,7 @@ module hazard_control_unit_testbench;
         Branch_Taken_E <= 1'b0; // Mispredict taken
         Predict_Taken_E <= 1'b1;
         @(posedge CLK);
-        check_signals(FWD_NONE, FWD_NONE, 0, 1, 1, 1); // Should flush both stages
+        check_signals(FWD_NONE, FWD_NONE, 0, !REGISTERED_REDIRECT, !REGISTERED_REDIRECT, 0, 1); // Should flush both stages unless the redirect is registered
         
         // Test load RAW hazard (Insert bubble Stall+Flush)
         RS1_D <= 5'b00011;  // x3
@@ -220,7 +294,275 @@ module hazard_control_unit_testbench;
         Branch_Taken_E <= 1'b0; // Ensure no branch misprediction
         Predict_Taken_E <= 1'b0;
         @(posedge CLK);
-        check_signals(FWD_NONE, FWD_NONE, 1, 0, 1, 0); // Should flush idex and stall ifid to insert a bubble
+        check_signals(FWD_NONE, FWD_NONE, 1, 0, 1, 0, 0); // Should flush idex and stall ifid to insert a bubble
+
+        // Test multiply RAW hazard behaves like a load
+        Result_Src_Sel_E <= RESULT_MUL;
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 1, 0, 1, 0, 0); // Product only ready in writeback
+        Result_Src_Sel_E <= RESULT_MEM;
+
+        // Test registered redirect takes priority over the load RAW hazard of a misfetched instruction
+        Redirect_En <= REGISTERED_REDIRECT; // Fetch only raises this when the option is set
+        @(posedge CLK);
+        if (REGISTERED_REDIRECT) check_signals(FWD_NONE, FWD_NONE, 0, 1, 1, 1, 1); // Should also flush the misfetched instruction in execute
+        else check_signals(FWD_NONE, FWD_NONE, 1, 0, 1, 0, 0);
+        Redirect_En <= 1'b0;
+
+        // Test precomputed forwarding from the instruction in execute
+        RS1_D <= 5'b00001;  // x1
+        RS2_D <= 5'b00011;  // x3
+        RD_E <= 5'b00001;   // x1, clashes with rs1_D
+        Result_Src_Sel_E <= RESULT_ALU; // Not a load so no stall
+        RS1_E <= 5'b00000;  // N/A
+        RS2_E <= 5'b00000;  // N/A
+        RD_M <= 5'b11111;   // x31, no clashes with rs1/rs2_D
+        RD_W <= 5'b11111;   // N/A
+        REG_W_En_E <= 1'b1;
+        REG_W_En_M <= 1'b1;
+        REG_W_En_W <= 1'b0;
+        FWD_SrcA_E <= FWD_WB; // Registered selects should pass straight through when precomputed
+        FWD_SrcB_E <= FWD_MEM;
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 0, 0, 0, 0, 1);
+        check_precomputed(FWD_MEM, FWD_NONE);
+
+        // Test precomputed forwarding from the instruction in memory
+        RD_E <= 5'b11111;   // x31, no clashes with rs1/rs2_D
+        RD_M <= 5'b00011;   // x3, clashes with rs2_D
+        @(posedge CLK);
+        check_precomputed(FWD_NONE, FWD_WB);
+
+        // Test precomputed forwarding prefers the younger instruction
+        RD_E <= 5'b00011;   // x3, clashes with rs2_D
+        RD_M <= 5'b00011;   // x3, clashes with rs2_D
+        @(posedge CLK);
+        check_precomputed(FWD_NONE, FWD_MEM);
+
+        // Test precomputed forwarding ignores instructions that don't write or write x0
+        RS1_D <= 5'b00000;  // x0
+        RD_E <= 5'b00000;   // x0, clashes with rs1_D
+        RD_M <= 5'b00011;   // x3, clashes with rs2_D
+        REG_W_En_M <= 1'b0;
+        @(posedge CLK);
+        check_precomputed(FWD_NONE, FWD_NONE);
+
+        // Test instruction fetch not ready holds the PC and decode, sending a bubble into execute
+        RS1_D <= 5'b00000;  // N/A
+        RS2_D <= 5'b00000;  // N/A
+        RD_E <= 5'b11111;   // N/A
+        REG_W_En_E <= 1'b0;
+        REG_W_En_M <= 1'b0;
+        REG_W_En_W <= 1'b0;
+        Instr_Ready_F <= 1'b0;
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 1, 0, 1, 0, 0);
+        check_stalls(0, 0, 0, 0);
+        Instr_Ready_F <= 1'b1;
+
+        // Test store not accepted holds memory and everything before it, writeback gets a bubble
+        MEM_W_En_M <= 1'b1;
+        Data_Ready_M <= 1'b0;
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 1, 0, 0, 0, 0);
+        check_stalls(1, 1, 0, 1);
+
+        // Test misprediction waits while execute is held
+        Branch_Taken_E <= 1'b1; // Mispredict untaken
+        Predict_Taken_E <= 1'b0;
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 1, 0, 0, 0, 0);
+        check_stalls(1, 1, 0, 1);
+        Branch_Taken_E <= 1'b0;
+        MEM_W_En_M <= 1'b0;
+        Data_Ready_M <= 1'b1;
+
+        // Test load waiting on data in writeback holds the whole pipeline
+        REG_W_En_W <= 1'b1;
+        Result_Src_Sel_W <= RESULT_MEM;
+        Data_Valid_W <= 1'b0;
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 1, 0, 0, 0, 0);
+        check_stalls(1, 1, 1, 0);
+
+        // Test a bubble in writeback doesn't wait on data
+        REG_W_En_W <= 1'b0;
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 0, 0, 0, 0, 1);
+        check_stalls(0, 0, 0, 0);
+        Data_Valid_W <= 1'b1;
+
+        // Test divide about to start holds back a dependent instruction
+        Result_Src_Sel_E <= RESULT_ALU;
+        ALU_Control_E <= ALU_DIV;
+        RD_E <= 5'b00101;   // x5
+        RS1_D <= 5'b00101;  // x5, clashes with rd of the divide
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 1, 0, 1, 0, 0);
+
+        // Test an independent instruction carries on while the divider is busy
+        ALU_Control_E <= ALU_ADD;
+        RD_E <= 5'b11111;   // N/A
+        DIV_Busy <= 1'b1;
+        DIV_RD <= 5'b00101; // x5
+        RS1_D <= 5'b00110;  // x6
+        RS2_D <= 5'b00111;  // x7
+        RD_D <= 5'b01000;   // x8
+        REG_W_En_D <= 1'b1;
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 0, 0, 0, 0, 1);
+
+        // Test reading the divider's destination waits
+        RS2_D <= 5'b00101;  // x5
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 1, 0, 1, 0, 0);
+
+        // Test writing the divider's destination waits so the divide can't overwrite it later
+        RS2_D <= 5'b00111;  // x7
+        RD_D <= 5'b00101;   // x5
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 1, 0, 1, 0, 0);
+
+        // Test an instruction that doesn't write isn't held by a matching rd field
+        REG_W_En_D <= 1'b0;
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 0, 0, 0, 0, 1);
+
+        // Test a second divide waits for the divider
+        ALU_Control_D <= ALU_REMU;
+        RD_D <= 5'b01000;   // x8
+        REG_W_En_D <= 1'b0;
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 1, 0, 1, 0, 0);
+        ALU_Control_D <= ALU_ADD;
+
+        // Test a finished divide makes a gap when every instruction in flight writes
+        DIV_Busy <= 1'b0;
+        DIV_Done <= 1'b1;
+        REG_W_En_E <= 1'b1;
+        REG_W_En_M <= 1'b1;
+        REG_W_En_W <= 1'b1;
+        RD_M <= 5'b00000;   // x0 so nothing forwards
+        RD_W <= 5'b00000;
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 1, 0, 1, 0, 0);
+
+        // Test no gap is needed when a non-writing instruction is already on its way
+        REG_W_En_M <= 1'b0;
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 0, 0, 0, 0, 1);
+        DIV_Done <= 1'b0;
+
+        // Test an FP square root about to start holds back a dependent instruction like a divide
+        ALU_Control_E <= ALU_FSQRT;
+        RD_E <= 5'b01001;   // x9
+        RS1_D <= 5'b01001;  // x9, clashes with rd of the square root
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 1, 0, 1, 0, 0);
+
+        // Test an integer divide waits while the FP divider is busy, they share the scoreboard
+        ALU_Control_E <= ALU_ADD;
+        RD_E <= 5'b11111;   // N/A
+        RS1_D <= 5'b00110;  // x6
+        FDIV_Busy <= 1'b1;
+        FDIV_RD <= 5'b01001; // x9
+        ALU_Control_D <= ALU_DIV;
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 1, 0, 1, 0, 0);
+        ALU_Control_D <= ALU_ADD;
+
+        // Test reading the FP divider's destination waits
+        RS2_D <= 5'b01001;  // x9
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 1, 0, 1, 0, 0);
+        RS2_D <= 5'b00111;  // x7
+
+        // Test a finished FP divide makes a gap when every instruction in flight writes
+        FDIV_Busy <= 1'b0;
+        FDIV_Done <= 1'b1;
+        REG_W_En_M <= 1'b1;
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 1, 0, 1, 0, 0);
+        REG_W_En_M <= 1'b0;
+        FDIV_Done <= 1'b0;
+
+        // Test waiting on the CFU holds execute and everything before it, memory gets a bubble
+        CFU_Wait_E <= 1'b1;
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 1, 0, 0, 1, 0);
+        check_stalls(1, 0, 0, 0);
+
+        // Test the response lets execute move on
+        CFU_Wait_E <= 1'b0;
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 0, 0, 0, 0, 1);
+        check_stalls(0, 0, 0, 0);
+
+        // Test hardware loop setup flushes what was fetched behind it
+        ALU_Control_E <= ALU_LP_SETUP;
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 0, !REGISTERED_REDIRECT, !REGISTERED_REDIRECT, 0, 1); // Refetches like a mispredict unless the redirect is registered
+        ALU_Control_E <= ALU_ADD;
+
+        // Test a load missing in memory holds back a dependent instruction in decode
+        REG_W_En_E <= 1'b0;
+        REG_W_En_M <= 1'b1;
+        REG_W_En_W <= 1'b0;
+        RD_M <= 5'b01010;   // x10
+        Load_Miss_M <= 1'b1;
+        RS1_D <= 5'b01010;  // x10, clashes with rd of the missed load
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 1, 0, 1, 0, 0);
+
+        // Test the scoreboard keeps holding it once the load has left memory
+        Load_Miss_M <= 1'b0;
+        REG_W_En_M <= 1'b0;
+        RD_M <= 5'b11111;   // N/A
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 1, 0, 1, 0, 0);
+
+        // Test an independent instruction carries on under the miss
+        RS1_D <= 5'b00110;  // x6
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 0, 0, 0, 0, 1);
+
+        // Test writing the missed load's destination waits so the late result can't overwrite it
+        RD_D <= 5'b01010;   // x10
+        REG_W_En_D <= 1'b1;
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 1, 0, 1, 0, 0);
+        RD_D <= 5'b01000;   // x8
+
+        // Test the waiting result makes a gap when every instruction in flight writes
+        Fill_Done <= 1'b1;
+        Fill_RD <= 5'b01010; // x10
+        REG_W_En_E <= 1'b1;
+        REG_W_En_M <= 1'b1;
+        REG_W_En_W <= 1'b1;
+        RD_M <= 5'b00000;   // x0 so nothing forwards
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 1, 0, 1, 0, 0);
+
+        // Test the dependent is released as the result is written, it reads through the register file
+        REG_W_En_M <= 1'b0;
+        Fill_W_En <= 1'b1;
+        RS1_D <= 5'b01010;  // x10
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 0, 0, 0, 0, 1);
+        Fill_Done <= 1'b0;
+        Fill_W_En <= 1'b0;
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, 0, 0, 0, 0, 1);
+
+        // Test a write to the destination of a load in execute waits a cycle in case the load misses
+        RS1_D <= 5'b00110;  // x6
+        RD_E <= 5'b01100;   // x12
+        Result_Src_Sel_E <= RESULT_MEM;
+        RD_D <= 5'b01100;   // x12
+        @(posedge CLK);
+        check_signals(FWD_NONE, FWD_NONE, DCACHE_NONBLOCKING, 0, DCACHE_NONBLOCKING, 0, !DCACHE_NONBLOCKING);
+        Result_Src_Sel_E <= RESULT_ALU;
+        REG_W_En_D <= 1'b0;
         $stop; 
     end
 
@@ -230,15 +572,47 @@ module hazard_control_unit_testbench;
         input logic expected_Stall_En,
         input logic expected_Flush_D,
         input logic expected_Flush_E,
+        input logic expected_Flush_M,
         input logic expected_PC_En
     );
     begin
-        assert (FWD_SrcA == expected_FWD_SrcA) else $error("Error: Incorrect FWD_SrcA produced, expected %h, got %h", expected_FWD_SrcA, $sampled(FWD_SrcA));
-        assert (FWD_SrcB == expected_FWD_SrcB) else $error("Error: Incorrect FWD_SrcB produced, expected %h, got %h", expected_FWD_SrcB, $sampled(FWD_SrcB));
+        if (PRECOMPUTED_FORWARDING) begin // Execute only sees the registered selects
+            assert (FWD_SrcA == FWD_SrcA_E) else $error("Error: Incorrect FWD_SrcA produced, expected %h, got %h", $sampled(FWD_SrcA_E), $sampled(FWD_SrcA));
+            assert (FWD_SrcB == FWD_SrcB_E) else $error("Error: Incorrect FWD_SrcB produced, expected %h, got %h", $sampled(FWD_SrcB_E), $sampled(FWD_SrcB));
+        end
+        else begin
+            assert (FWD_SrcA == expected_FWD_SrcA) else $error("Error: Incorrect FWD_SrcA produced, expected %h, got %h", expected_FWD_SrcA, $sampled(FWD_SrcA));
+            assert (FWD_SrcB == expected_FWD_SrcB) else $error("Error: Incorrect FWD_SrcB produced, expected %h, got %h", expected_FWD_SrcB, $sampled(FWD_SrcB));
+        end
         assert (Stall_En == expected_Stall_En) else $error("Error: Incorrect Stall_En produced, expected %h, got %h", expected_Stall_En, $sampled(Stall_En));
         assert (Flush_D == expected_Flush_D) else $error("Error: Incorrect Flush_D produced, expected %h, got %h", expected_Flush_D, $sampled(Flush_D));
         assert (Flush_E == expected_Flush_E) else $error("Error: Incorrect Flush_E produced, expected %h, got %h", expected_Flush_E, $sampled(Flush_E));
+        assert (Flush_M == expected_Flush_M) else $error("Error: Incorrect Flush_M produced, expected %h, got %h", expected_Flush_M, $sampled(Flush_M));
         assert (PC_En == expected_PC_En) else $error("Error: Incorrect PC_En produced, expected %h, got %h", expected_PC_En, $sampled(PC_En));
     end
     endtask
+
+    task check_precomputed(
+        input logic [1:0] expected_FWD_SrcA_D,
+        input logic [1:0] expected_FWD_SrcB_D
+    );
+    begin
+        assert (FWD_SrcA_D == expected_FWD_SrcA_D) else $error("Error: Incorrect FWD_SrcA_D produced, expected %h, got %h", expected_FWD_SrcA_D, $sampled(FWD_SrcA_D));
+        assert (FWD_SrcB_D == expected_FWD_SrcB_D) else $error("Error: Incorrect FWD_SrcB_D produced, expected %h, got %h", expected_FWD_SrcB_D, $sampled(FWD_SrcB_D));
+    end
+    endtask
+
+    task check_stalls(
+        input logic expected_Stall_E,
+        input logic expected_Stall_M,
+        input logic expected_Stall_W,
+        input logic expected_Flush_W
+    );
+    begin
+        assert (Stall_E == expected_Stall_E) else $error("Error: Incorrect Stall_E produced, expected %h, got %h", expected_Stall_E, $sampled(Stall_E));
+        assert (Stall_M == expected_Stall_M) else $error("Error: Incorrect Stall_M produced, expected %h, got %h", expected_Stall_M, $sampled(Stall_M));
+        assert (Stall_W == expected_Stall_W) else $error("Error: Incorrect Stall_W produced, expected %h, got %h", expected_Stall_W, $sampled(Stall_W));
+        assert (Flush_W == expected_Flush_W) else $error("Error: Incorrect Flush_W produced, expected %h, got %h", expected_Flush_W, $sampled(Flush_W));
+    end
+    endtask
 endmodule
\ No newline at end of file
@@ -0,0 +1,58 @@
+//////////////////////////////////////////////////////////////////////////////////                                                           
+// Third Year Project: RISC-V RV32i Pipelined Processor
+// Module: Barrel Core Testbench                                                  
+// Description: Simulates the barrel core with the specified program.hex file,
+//              each hart starts at its own multiple of BARREL_HART_STRIDE.
+// Author: Luke Shepherd                                                     
+// Date Created: October 2026                                                                                                                                                                                                                                            
+//////////////////////////////////////////////////////////////////////////////////
+
+import definitions::*;
+
+module barrel_core_testbench ();
+    // Global control signals
+    logic CLK, RST;
+
+    // Performance counters
+    int Cycles, Instructions;
+    int Hart_Instructions [0:BARREL_HARTS-1];
+
+    barrel_core core (
+        .CLK(CLK),
+        .RST(RST)
+    );
+
+    initial CLK <= 1; // Initialize the clock
+    always #(CLOCK_PERIOD / 2) CLK <= ~CLK; // Generate the clock
+
+    always @ (posedge CLK) begin
+        if (RST) begin
+            Cycles <= 0;
+            Instructions <= 0;
+            for (int i = 0; i < BARREL_HARTS; i++) Hart_Instructions[i] <= 0;
+        end
+        else begin
+            Cycles <= Cycles + 1;
+            // Count instructions leaving decode, nothing is ever stalled or flushed
+            if (core.Instr_D != 32'h0000_0000) begin
+                Instructions <= Instructions + 1;
+                Hart_Instructions[core.Hart_D] <= Hart_Instructions[core.Hart_D] + 1;
+            end
+            // Harts must issue strictly in turn
+            assert (core.Hart_E == ((core.Hart_D == 0) ? BARREL_HARTS - 1 : core.Hart_D - 1)) 
+                else $error("Error: Hart order broken, hart %0d followed hart %0d", $sampled(core.Hart_D), $sampled(core.Hart_E));
+        end
+    end
+
+    initial begin
+        // Initialize basic signals with reset
+        RST <= 1;
+        @(posedge CLK);
+        RST <= 0;
+
+        repeat (500) @ (posedge CLK); 
+        $display("Cycles: %0d, Instructions: %0d, IPC: %0.3f", Cycles, Instructions, real'(Instructions) / Cycles);
+        for (int i = 0; i < BARREL_HARTS; i++) $display("Hart %0d: %0d instructions", i, Hart_Instructions[i]);
+        $stop;
+    end
+endmodule
@@ -2,8 +2,11 @@
 // Third Year Project: RISC-V RV32i Pipelined Processor
 // Module: Core Testbench                                                  
 // Description: Simulates the processor with the specified program.hex file.
+//              Runs until the program parks on a jump to itself, printing the counters at each EBREAK checkpoint.
+//              With AXI_MEMORY set the caches refill from AXI memory models, Bus_Latency, Bus_Beat_Gap and
+//              Bus_Max_Outstanding set how slow they are.
 // Author: Luke Shepherd                                                     
-// Date Modified: February 2025                                                                                                                                                                                                                                            
+// Date Modified: October 2026                                                                                                                                                                                                                                            
 //////////////////////////////////////////////////////////////////////////////////
 
 import definitions::*;
@@ -12,21 +15,194 @@ module core_testbench ();
     // Global control signals
     logic CLK, RST;
 
+    // Performance counters
+    int Cycles, Instructions, Fused_Pairs;
+
+    // AXI4 buses to the memory models, only used when AXI_MEMORY is set
+    wire I_ARVALID;
+    wire I_ARREADY;
+    wire [31:0] I_ARADDR;
+    wire [7:0] I_ARLEN;
+    wire [2:0] I_ARSIZE;
+    wire [1:0] I_ARBURST;
+    wire I_RVALID;
+    wire I_RREADY;
+    wire [31:0] I_RDATA;
+    wire [1:0] I_RRESP;
+    wire I_RLAST;
+    wire D_ARVALID;
+    wire D_ARREADY;
+    wire [31:0] D_ARADDR;
+    wire [7:0] D_ARLEN;
+    wire [2:0] D_ARSIZE;
+    wire [1:0] D_ARBURST;
+    wire D_RVALID;
+    wire D_RREADY;
+    wire [31:0] D_RDATA;
+    wire [1:0] D_RRESP;
+    wire D_RLAST;
+    wire D_AWVALID;
+    wire D_AWREADY;
+    wire [31:0] D_AWADDR;
+    wire [7:0] D_AWLEN;
+    wire [2:0] D_AWSIZE;
+    wire [1:0] D_AWBURST;
+    wire D_WVALID;
+    wire D_WREADY;
+    wire [31:0] D_WDATA;
+    wire [3:0] D_WSTRB;
+    wire D_WLAST;
+    wire D_BVALID;
+    wire D_BREADY;
+    wire [1:0] D_BRESP;
+    int Bus_Latency, Bus_Beat_Gap, Bus_Max_Outstanding; // Memory model timing
+
     core core (
         .CLK(CLK),
-        .RST(RST)
+        .RST(RST),
+        .I_ARVALID(I_ARVALID),
+        .I_ARREADY(I_ARREADY),
+        .I_ARADDR(I_ARADDR),
+        .I_ARLEN(I_ARLEN),
+        .I_ARSIZE(I_ARSIZE),
+        .I_ARBURST(I_ARBURST),
+        .I_RVALID(I_RVALID),
+        .I_RREADY(I_RREADY),
+        .I_RDATA(I_RDATA),
+        .I_RRESP(I_RRESP),
+        .I_RLAST(I_RLAST),
+        .D_ARVALID(D_ARVALID),
+        .D_ARREADY(D_ARREADY),
+        .D_ARADDR(D_ARADDR),
+        .D_ARLEN(D_ARLEN),
+        .D_ARSIZE(D_ARSIZE),
+        .D_ARBURST(D_ARBURST),
+        .D_RVALID(D_RVALID),
+        .D_RREADY(D_RREADY),
+        .D_RDATA(D_RDATA),
+        .D_RRESP(D_RRESP),
+        .D_RLAST(D_RLAST),
+        .D_AWVALID(D_AWVALID),
+        .D_AWREADY(D_AWREADY),
+        .D_AWADDR(D_AWADDR),
+        .D_AWLEN(D_AWLEN),
+        .D_AWSIZE(D_AWSIZE),
+        .D_AWBURST(D_AWBURST),
+        .D_WVALID(D_WVALID),
+        .D_WREADY(D_WREADY),
+        .D_WDATA(D_WDATA),
+        .D_WSTRB(D_WSTRB),
+        .D_WLAST(D_WLAST),
+        .D_BVALID(D_BVALID),
+        .D_BREADY(D_BREADY),
+        .D_BRESP(D_BRESP)
+    );
+
+    // Each bus has its own copy of the image, like the split memory
+    axi_memory_model #(.INIT_FILE(IMEM_INIT_FILE)) imem (
+        .CLK(CLK),
+        .RST(RST),
+        .Latency(Bus_Latency),
+        .Beat_Gap(Bus_Beat_Gap),
+        .Max_Outstanding(Bus_Max_Outstanding),
+        .ARVALID(I_ARVALID),
+        .ARREADY(I_ARREADY),
+        .ARADDR(I_ARADDR),
+        .ARLEN(I_ARLEN),
+        .ARSIZE(I_ARSIZE),
+        .ARBURST(I_ARBURST),
+        .RVALID(I_RVALID),
+        .RREADY(I_RREADY),
+        .RDATA(I_RDATA),
+        .RRESP(I_RRESP),
+        .RLAST(I_RLAST),
+        .AWVALID(1'b0),
+        .AWREADY(),
+        .AWADDR(32'h0),
+        .AWLEN(8'h0),
+        .AWSIZE(3'b010),
+        .AWBURST(2'b01),
+        .WVALID(1'b0),
+        .WREADY(),
+        .WDATA(32'h0),
+        .WSTRB(4'h0),
+        .WLAST(1'b0),
+        .BVALID(),
+        .BREADY(1'b1),
+        .BRESP()
+    );
+
+    axi_memory_model #(.INIT_FILE(DMEM_INIT_FILE)) dmem (
+        .CLK(CLK),
+        .RST(RST),
+        .Latency(Bus_Latency),
+        .Beat_Gap(Bus_Beat_Gap),
+        .Max_Outstanding(Bus_Max_Outstanding),
+        .ARVALID(D_ARVALID),
+        .ARREADY(D_ARREADY),
+        .ARADDR(D_ARADDR),
+        .ARLEN(D_ARLEN),
+        .ARSIZE(D_ARSIZE),
+        .ARBURST(D_ARBURST),
+        .RVALID(D_RVALID),
+        .RREADY(D_RREADY),
+        .RDATA(D_RDATA),
+        .RRESP(D_RRESP),
+        .RLAST(D_RLAST),
+        .AWVALID(D_AWVALID),
+        .AWREADY(D_AWREADY),
+        .AWADDR(D_AWADDR),
+        .AWLEN(D_AWLEN),
+        .AWSIZE(D_AWSIZE),
+        .AWBURST(D_AWBURST),
+        .WVALID(D_WVALID),
+        .WREADY(D_WREADY),
+        .WDATA(D_WDATA),
+        .WSTRB(D_WSTRB),
+        .WLAST(D_WLAST),
+        .BVALID(D_BVALID),
+        .BREADY(D_BREADY),
+        .BRESP(D_BRESP)
     );
 
     initial CLK <= 1; // Initialize the clock
     always #(CLOCK_PERIOD / 2) CLK <= ~CLK; // Generate the clock
 
+    always @ (posedge CLK) begin
+        if (RST) begin
+            Cycles <= 0;
+            Instructions <= 0;
+            Fused_Pairs <= 0;
+        end
+        else begin
+            Cycles <= Cycles + 1;
+            // Count instructions leaving execute, flushed slots carry the debug PC pattern
+            if (!core.Stall_E && !core.Flush_M && core.PC_E != 32'h2A2A_2A2A) Instructions <= Instructions + 1;
+            if (!core.Stall_En && !core.Flush_E && core.PC_D != 32'h2A2A_2A2A && core.decode.Fuse_Sel != FUSE_NONE) Fused_Pairs <= Fused_Pairs + 1;
+            // EBREAK is a NOP to the core so benchmarks use it to mark where a kernel starts and ends
+            if (!core.Stall_En && !core.Flush_E && core.PC_D != 32'h2A2A_2A2A && core.Instr_D == 32'h0010_0073)
+                $display("Checkpoint at 0x%h - Cycles: %0d, Instructions: %0d", core.PC_D, Cycles, Instructions);
+            // Accesses outside the memory are dropped rather than wrapping around, so report them
+            if (core.Data_Fault_M && !core.Stall_M)
+                $error("Error: Load/store outside the memory at 0x%h", core.ALU_Out_M);
+            if (!core.Stall_En && !core.Flush_E && core.PC_D != 32'h2A2A_2A2A && core.Instr_Fault_D)
+                $error("Error: Instruction fetched from outside the memory at 0x%h", core.PC_D);
+        end
+    end
+
     initial begin
         // Initialize basic signals with reset
         RST <= 1;
+        Bus_Latency <= 10;
+        Bus_Beat_Gap <= 1;
+        Bus_Max_Outstanding <= 4;
         @(posedge CLK);
         RST <= 0;
 
-        repeat (500) @ (posedge CLK); 
+        // Programs finish by jumping to themselves, give up after a long time in case one never does
+        while (!(core.Jump_En_E && core.PC_Target_E == core.PC_E) && Cycles < 100000) @ (posedge CLK);
+        $display("Cycles: %0d, Instructions: %0d, IPC: %0.3f, Fused pairs: %0d", Cycles, Instructions, real'(Instructions) / Cycles, Fused_Pairs);
+        $display("I-cache hits: %0d, misses: %0d", core.ICache_Hits, core.ICache_Misses);
         $stop;
     end
 endmodule
\ No newline at end of file
@@ -0,0 +1,226 @@
+//////////////////////////////////////////////////////////////////////////////////
+// Third Year Project: RISC-V RV32i Pipelined Processor
+// File: AXI4 Master Testbench
+// Description: Ensures that line refills and write backs from a cache become single INCR bursts, that a line read
+//              straight after its write back waits for the write response and gets the new data, and that the
+//              memory model's latency, bandwidth and outstanding limits show up in the cycles each line takes.
+//              Drives the cache side like the caches do, one word per request from the first word of the line.
+//              Assumes 4 word lines.
+// Author: Luke Shepherd
+// Date Created: October 2026
+//////////////////////////////////////////////////////////////////////////////////
+
+import definitions::*;
+
+module axi_master_testbench;
+    logic CLK, RST; // Wrap module with a clock to control the sim more easily and better represent the external system
+
+    // Cache side
+    logic Req, Write;
+    logic [31:0] Addr;
+    logic [31:0] W_Data;
+    logic Ready, Valid;
+    logic [31:0] R_Data;
+    logic [31:0] Responses [$];
+
+    // AXI4
+    wire ARVALID, ARREADY, RVALID, RREADY, RLAST, AWVALID, AWREADY, WVALID, WREADY, WLAST, BVALID, BREADY;
+    wire [31:0] ARADDR, RDATA, AWADDR, WDATA;
+    wire [7:0] ARLEN, AWLEN;
+    wire [2:0] ARSIZE, AWSIZE;
+    wire [1:0] ARBURST, RRESP, AWBURST, BRESP;
+    wire [3:0] WSTRB;
+
+    // Model timing
+    int Latency, Beat_Gap, Max_Outstanding;
+
+    logic [31:0] Shadow [1024]; // What every read should see
+    int Cycles, Base_Cycles, First_Cycles;
+
+    axi_master #(.BURST_WORDS(4)) master (
+        .CLK(CLK),
+        .RST(RST),
+        .Req(Req),
+        .Write(Write),
+        .Addr(Addr[31:2]),
+        .W_Data(W_Data),
+        .Ready(Ready),
+        .Valid(Valid),
+        .R_Data(R_Data),
+        .ARVALID(ARVALID),
+        .ARREADY(ARREADY),
+        .ARADDR(ARADDR),
+        .ARLEN(ARLEN),
+        .ARSIZE(ARSIZE),
+        .ARBURST(ARBURST),
+        .RVALID(RVALID),
+        .RREADY(RREADY),
+        .RDATA(RDATA),
+        .RRESP(RRESP),
+        .RLAST(RLAST),
+        .AWVALID(AWVALID),
+        .AWREADY(AWREADY),
+        .AWADDR(AWADDR),
+        .AWLEN(AWLEN),
+        .AWSIZE(AWSIZE),
+        .AWBURST(AWBURST),
+        .WVALID(WVALID),
+        .WREADY(WREADY),
+        .WDATA(WDATA),
+        .WSTRB(WSTRB),
+        .WLAST(WLAST),
+        .BVALID(BVALID),
+        .BREADY(BREADY),
+        .BRESP(BRESP)
+    );
+
+    axi_memory_model #(.ADDR_WIDTH(12)) mem (
+        .CLK(CLK),
+        .RST(RST),
+        .Latency(Latency),
+        .Beat_Gap(Beat_Gap),
+        .Max_Outstanding(Max_Outstanding),
+        .ARVALID(ARVALID),
+        .ARREADY(ARREADY),
+        .ARADDR(ARADDR),
+        .ARLEN(ARLEN),
+        .ARSIZE(ARSIZE),
+        .ARBURST(ARBURST),
+        .RVALID(RVALID),
+        .RREADY(RREADY),
+        .RDATA(RDATA),
+        .RRESP(RRESP),
+        .RLAST(RLAST),
+        .AWVALID(AWVALID),
+        .AWREADY(AWREADY),
+        .AWADDR(AWADDR),
+        .AWLEN(AWLEN),
+        .AWSIZE(AWSIZE),
+        .AWBURST(AWBURST),
+        .WVALID(WVALID),
+        .WREADY(WREADY),
+        .WDATA(WDATA),
+        .WSTRB(WSTRB),
+        .WLAST(WLAST),
+        .BVALID(BVALID),
+        .BREADY(BREADY),
+        .BRESP(BRESP)
+    );
+
+    initial CLK <= 1; // Initialize the clock
+    always #(CLOCK_PERIOD / 2) CLK <= ~CLK; // Generate the clock
+
+    always @ (posedge CLK) if (Valid) Responses.push_back(R_Data);
+
+    initial begin
+        // Initialize signals with reset
+        RST <= 1;
+        Req <= 0;
+        Write <= 0;
+        Addr <= 32'h0;
+        W_Data <= 32'h0;
+        Latency <= 1;
+        Beat_Gap <= 1;
+        Max_Outstanding <= 4;
+        for (int i = 0; i < 1024; i++) begin
+            mem.Mem[i] = 32'hE000_0000 + i;
+            Shadow[i] = 32'hE000_0000 + i;
+        end
+        @(posedge CLK);
+        RST <= 0;
+        @(posedge CLK);
+
+        // Test a refill is one burst answered like the BRAM at the fastest settings
+        read_line(32'h0000_0000, "Refill 0x000");
+        Base_Cycles = Cycles;
+        assert (mem.Read_Bursts == 1) else $error("Error: Refill should be one burst, got %0d", mem.Read_Bursts);
+
+        // Test latency and bandwidth add to the refill as expected
+        Latency <= 8;
+        read_line(32'h0000_0010, "Refill 0x010 latency 8");
+        assert (Cycles == Base_Cycles + 7) else $error("Error: Latency 8 refill took %0d cycles, expected %0d", Cycles, Base_Cycles + 7);
+        Latency <= 1;
+        Beat_Gap <= 3;
+        read_line(32'h0000_0020, "Refill 0x020 beat gap 3");
+        assert (Cycles == Base_Cycles + 6) else $error("Error: Beat gap 3 refill took %0d cycles, expected %0d", Cycles, Base_Cycles + 6);
+        Beat_Gap <= 1;
+
+        // Test a write back is one burst and lands in memory
+        write_line(32'h0000_0100, 32'h1111_0000, "Write back 0x100");
+        repeat (4) @(posedge CLK);
+        assert (mem.Write_Bursts == 1) else $error("Error: Write back should be one burst, got %0d", mem.Write_Bursts);
+        for (int i = 0; i < 4; i++)
+            assert (mem.Mem[64 + i] == Shadow[64 + i]) else $error("Error: Word %0d written as 0x%h, expected 0x%h", i, mem.Mem[64 + i], Shadow[64 + i]);
+
+        // Test reading a line straight after writing it back waits for the response rather than overtaking
+        Latency <= 8;
+        write_line(32'h0000_0200, 32'h2222_0000, "Write back 0x200 latency 8");
+        read_line(32'h0000_0200, "Refill 0x200 after its write back");
+        assert (Cycles > Base_Cycles + 7) else $error("Error: Refill of a line being written back didn't wait for the response");
+
+        // Test the outstanding limit holds a second write back until the first is answered
+        Max_Outstanding <= 1;
+        write_line(32'h0000_0300, 32'h3333_0000, "Write back 0x300 limit 1");
+        First_Cycles = Cycles;
+        write_line(32'h0000_0340, 32'h4444_0000, "Write back 0x340 limit 1");
+        assert (Cycles > First_Cycles) else $error("Error: Second write back should wait for the first response");
+        read_line(32'h0000_0340, "Refill 0x340 limit 1");
+        Max_Outstanding <= 4;
+        Latency <= 1;
+
+        repeat (5) @ (posedge CLK); // Allow some extra time at the end for visual clarity
+        $stop;
+    end
+
+    // Request a whole line like a cache refill, counting cycles until the last word returns, the data is checked
+    task read_line(
+        input logic [31:0] addr,
+        input string name
+    );
+    begin
+        Responses.delete();
+        Cycles = 0;
+        for (int i = 0; i < 4; i++) begin
+            Req <= 1;
+            Write <= 0;
+            Addr <= addr + 4*i;
+            do begin
+                @(posedge CLK);
+                Cycles++;
+            end while (!Ready && Cycles < 200);
+        end
+        Req <= 0;
+        while (Responses.size() < 4 && Cycles < 200) begin
+            @(posedge CLK);
+            Cycles++;
+        end
+        assert (Responses.size() == 4) else $error("Error: %s, expected 4 words, got %0d", name, Responses.size());
+        for (int i = 0; i < Responses.size(); i++)
+            assert (Responses[i] == Shadow[addr[11:2] + i]) else $error("Error: %s, word %0d expected 0x%h, got 0x%h", name, i, Shadow[addr[11:2] + i], Responses[i]);
+    end
+    endtask
+
+    // Send a whole line like a cache write back, counting cycles until the last word is taken
+    task write_line(
+        input logic [31:0] addr,
+        input logic [31:0] data, // Word i is written as data + i
+        input string name
+    );
+    begin
+        Cycles = 0;
+        for (int i = 0; i < 4; i++) begin
+            Req <= 1;
+            Write <= 1;
+            Addr <= addr + 4*i;
+            W_Data <= data + i;
+            Shadow[addr[11:2] + i] = data + i;
+            do begin
+                @(posedge CLK);
+                Cycles++;
+            end while (!Ready && Cycles < 200);
+        end
+        Req <= 0;
+        Write <= 0;
+    end
+    endtask
+endmodule
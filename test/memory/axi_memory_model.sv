@@ -0,0 +1,170 @@
+//////////////////////////////////////////////////////////////////////////////////
+// Third Year Project: RISC-V RV32i Pipelined Processor
+// File: AXI4 Memory Model
+// Description: Behavioural AXI4 slave memory for simulation, loaded from an image like the BRAM. The timing can be
+//              changed while running to see how the pipeline copes with slower memory systems.
+//              Latency:
+//                  Cycles from an address being taken to the first read beat or the write response, 1 answers the
+//                  next cycle like the BRAM.
+//              Beat_Gap:
+//                  Cycles between beats of a burst on each of the read and write data channels, 1 for a beat every
+//                  cycle, so the bandwidth is a word every Beat_Gap cycles.
+//              Max_Outstanding:
+//                  Reads and writes each taken before their last beat or response, further addresses wait.
+//              INCR bursts of whole words only, reads are answered in order and always OKAY.
+// Author: Luke Shepherd
+// Date Created: October 2026
+//////////////////////////////////////////////////////////////////////////////////
+
+import definitions::*;
+
+module axi_memory_model #(
+    parameter string INIT_FILE = MEM_INIT_FILE,
+    parameter int ADDR_WIDTH = MEM_ADDR_WIDTH // Bytes as a power of two, addresses wrap above this
+    ) (
+    input wire CLK, RST,
+
+    // Timing
+    input int Latency,
+    input int Beat_Gap,
+    input int Max_Outstanding,
+
+    // Read address channel
+    input wire ARVALID,
+    output wire ARREADY,
+    input wire [31:0] ARADDR,
+    input wire [7:0] ARLEN,
+    input wire [2:0] ARSIZE,
+    input wire [1:0] ARBURST,
+
+    // Read data channel
+    output logic RVALID,
+    input wire RREADY,
+    output logic [31:0] RDATA,
+    output wire [1:0] RRESP,
+    output logic RLAST,
+
+    // Write address channel
+    input wire AWVALID,
+    output wire AWREADY,
+    input wire [31:0] AWADDR,
+    input wire [7:0] AWLEN,
+    input wire [2:0] AWSIZE,
+    input wire [1:0] AWBURST,
+
+    // Write data channel
+    input wire WVALID,
+    output wire WREADY,
+    input wire [31:0] WDATA,
+    input wire [3:0] WSTRB,
+    input wire WLAST,
+
+    // Write response channel
+    output logic BVALID,
+    input wire BREADY,
+    output wire [1:0] BRESP
+    );
+
+    typedef struct {
+        logic [31:2] Addr;
+        int Beats;
+        longint Due; // Cycle the first beat or response may go
+    } burst_t;
+
+    logic [31:0] Mem [2**(ADDR_WIDTH-2)];
+    burst_t Reads [$]; // Taken addresses, the front is being answered
+    burst_t Writes [$]; // Taken addresses waiting on their data
+    longint Responses [$]; // Due cycles of write responses
+    int Read_Count, Write_Count; // Outstanding
+    int Read_Beat, Write_Beat, R_Wait, W_Wait;
+    longint Cycle;
+
+    // Totals for the testbench to report
+    int Read_Bursts, Write_Bursts;
+
+    initial $readmemh(INIT_FILE, Mem);
+
+    assign ARREADY = !RST && Read_Count < Max_Outstanding;
+    assign AWREADY = !RST && Write_Count < Max_Outstanding;
+    assign WREADY = !RST && Writes.size() != 0 && W_Wait == 0; // Data waits for its address
+    assign RRESP = 2'b00;
+    assign BRESP = 2'b00;
+
+    always @ (posedge CLK) begin
+        if (RST) begin
+            Reads.delete();
+            Writes.delete();
+            Responses.delete();
+            Read_Count = 0;
+            Write_Count = 0;
+            Read_Beat = 0;
+            Write_Beat = 0;
+            R_Wait = 0;
+            W_Wait = 0;
+            Cycle = 0;
+            Read_Bursts = 0;
+            Write_Bursts = 0;
+            RVALID <= 1'b0;
+            BVALID <= 1'b0;
+        end
+        else begin
+            Cycle++;
+
+            // Addresses
+            if (ARVALID && ARREADY) begin
+                if (ARBURST != 2'b01 || ARSIZE != 3'b010) $error("Error: Model only takes INCR bursts of words");
+                Reads.push_back('{ARADDR[31:2], ARLEN + 1, Cycle + Latency - 1});
+                Read_Count++;
+                Read_Bursts++;
+            end
+            if (AWVALID && AWREADY) begin
+                if (AWBURST != 2'b01 || AWSIZE != 3'b010) $error("Error: Model only takes INCR bursts of words");
+                Writes.push_back('{AWADDR[31:2], AWLEN + 1, 0});
+                Write_Count++;
+                Write_Bursts++;
+            end
+
+            // Write data, applied as it arrives
+            if (W_Wait > 0) W_Wait--;
+            if (WVALID && WREADY) begin
+                for (int b = 0; b < 4; b++)
+                    if (WSTRB[b]) Mem[(Writes[0].Addr + Write_Beat) % (2**(ADDR_WIDTH-2))][b*8 +: 8] = WDATA[b*8 +: 8];
+                W_Wait = Beat_Gap - 1;
+                if (WLAST != (Write_Beat == Writes[0].Beats - 1)) $error("Error: WLAST on the wrong beat");
+                if (Write_Beat == Writes[0].Beats - 1) begin
+                    void'(Writes.pop_front());
+                    Responses.push_back(Cycle + Latency - 1);
+                    Write_Beat = 0;
+                end
+                else Write_Beat++;
+            end
+
+            // Read data, held until taken
+            if (R_Wait > 0) R_Wait--;
+            if (RVALID && RREADY) begin
+                R_Wait = Beat_Gap - 1;
+                if (RLAST) begin
+                    void'(Reads.pop_front());
+                    Read_Count--;
+                    Read_Beat = 0;
+                end
+                else Read_Beat++;
+            end
+            if (!RVALID || RREADY) begin
+                if (Reads.size() != 0 && Cycle >= Reads[0].Due && R_Wait == 0) begin
+                    RVALID <= 1'b1;
+                    RDATA <= Mem[(Reads[0].Addr + Read_Beat) % (2**(ADDR_WIDTH-2))];
+                    RLAST <= (Read_Beat == Reads[0].Beats - 1);
+                end
+                else RVALID <= 1'b0;
+            end
+
+            // Write responses
+            if (BVALID && BREADY) begin
+                void'(Responses.pop_front());
+                Write_Count--;
+            end
+            if (!BVALID || BREADY) BVALID <= Responses.size() != 0 && Cycle >= Responses[0];
+        end
+    end
+endmodule
@@ -0,0 +1,249 @@
+//////////////////////////////////////////////////////////////////////////////////
+// Third Year Project: RISC-V RV32i Pipelined Processor
+// File: Non-blocking Data Cache Testbench
+// Description: Ensures that with NONBLOCKING a load miss is accepted straight away and its word comes back later on
+//              the fill port, that hits and a second miss carry on underneath it with the refills overlapping, that
+//              fills come out in miss order with the right data and that a store or another access to a line still
+//              being refilled waits for it. A held fill keeps its MSHR so a miss with none free waits.
+//              Uses the same in-order backing memory model and shadow copy as the blocking testbench.
+//              Assumes the default 1KB, 16 byte line, 2 way cache with 2 MSHRs.
+// Author: Luke Shepherd
+// Date Created: October 2026
+//////////////////////////////////////////////////////////////////////////////////
+
+import definitions::*;
+
+module data_cache_nonblocking_testbench;
+    logic CLK, RST; // Wrap module with a clock to control the sim more easily and better represent the external system
+
+    // Input signals
+    logic [31:0] Addr;
+    logic R_En;
+    logic [3:0] W_En;
+    logic [31:0] W_Data;
+
+    // Output signals
+    logic Ready;
+    logic [31:0] R_Data;
+
+    // Fill port
+    logic Miss, Fill_Valid, Fill_Taken, Hold_Fills;
+    logic [DCACHE_MSHR_BITS-1:0] Miss_ID, Fill_ID;
+    logic [31:0] Fill_Data;
+    logic [31:0] Expected [$]; // Words of the accepted misses in miss order
+    logic [DCACHE_MSHR_BITS-1:0] Expected_IDs [$];
+    logic [31:0] Fills [$];
+    logic [DCACHE_MSHR_BITS-1:0] Fill_IDs [$];
+    longint Fill_Cycles [$];
+
+    // Backing memory
+    wire Mem_Req, Mem_Write;
+    wire [31:2] Mem_Addr;
+    wire [31:0] Mem_W_Data;
+    logic Mem_Valid;
+    logic [31:0] Mem_R_Data;
+    int Latency; // Cycles from a read being taken to its response, 1 is the BRAM
+    logic Pipe_Valid [16];
+    logic [31:2] Pipe_Addr [16];
+    logic [31:0] Backing [1024];
+    logic [31:0] Shadow [1024]; // What every load should see
+
+    int Cycles;
+    longint Cycle;
+
+    data_cache #(
+        .NONBLOCKING(1'b1)
+    ) dcache (
+        .CLK(CLK),
+        .RST(RST),
+        .Addr(Addr[31:2]),
+        .R_En(R_En),
+        .W_En(W_En),
+        .W_Data(W_Data),
+        .Ready(Ready),
+        .R_Data(R_Data),
+        .Miss(Miss),
+        .Miss_ID(Miss_ID),
+        .Fill_Valid(Fill_Valid),
+        .Fill_ID(Fill_ID),
+        .Fill_Data(Fill_Data),
+        .Fill_Taken(Fill_Taken),
+        .Mem_Req(Mem_Req),
+        .Mem_Write(Mem_Write),
+        .Mem_Addr(Mem_Addr),
+        .Mem_W_Data(Mem_W_Data),
+        .Mem_Ready(1'b1),
+        .Mem_Valid(Mem_Valid),
+        .Mem_R_Data(Mem_R_Data)
+    );
+
+    initial CLK <= 1; // Initialize the clock
+    always #(CLOCK_PERIOD / 2) CLK <= ~CLK; // Generate the clock
+
+    // Writes land when taken, every read is answered in order Latency cycles later
+    always @ (posedge CLK) begin
+        if (Mem_Req && Mem_Write) Backing[Mem_Addr[11:2]] <= Mem_W_Data;
+        Pipe_Valid[0] <= Mem_Req && !Mem_Write && !RST;
+        Pipe_Addr[0] <= Mem_Addr;
+        for (int i = 1; i < 16; i++) begin
+            Pipe_Valid[i] <= Pipe_Valid[i-1];
+            Pipe_Addr[i] <= Pipe_Addr[i-1];
+        end
+    end
+
+    assign Mem_Valid = Pipe_Valid[Latency-1];
+    assign Mem_R_Data = Backing[Pipe_Addr[Latency-1][11:2]];
+
+    // Act as the writeback arbiter, taking each fill as soon as it is offered unless held
+    assign Fill_Taken = Fill_Valid && !Hold_Fills;
+
+    always @ (posedge CLK) begin
+        Cycle <= (RST) ? 0 : Cycle + 1;
+        if (Fill_Taken) begin
+            Fills.push_back(Fill_Data);
+            Fill_IDs.push_back(Fill_ID);
+            Fill_Cycles.push_back(Cycle);
+        end
+    end
+
+    initial begin
+        // Initialize signals with reset
+        RST <= 1;
+        Addr <= 32'h0;
+        R_En <= 0;
+        W_En <= 4'b0000;
+        W_Data <= 32'h0;
+        Hold_Fills <= 0;
+        Latency <= 1;
+        for (int i = 0; i < 16; i++) Pipe_Valid[i] <= 0;
+        for (int i = 0; i < 1024; i++) begin
+            Backing[i] = 32'hC000_0000 + i;
+            Shadow[i] = 32'hC000_0000 + i;
+        end
+        @(posedge CLK);
+        RST <= 0;
+        @(posedge CLK);
+
+        // Test a load miss is accepted straight away and answered on the fill port
+        load(32'h0000_0100, 0, 1, "Cold load miss 0x100");
+        check_fills("Cold load miss 0x100");
+
+        // Test a hit and a second miss carry on under a slow miss, the refills overlap
+        Latency <= 8;
+        load(32'h0000_0000, 0, 1, "Slow miss 0x000");
+        load(32'h0000_0020, 0, 1, "Slow miss 0x020 under 0x000");
+        load(32'h0000_0104, 0, 0, "Hit 0x104 under both misses");
+        check_fills("Slow misses 0x000 and 0x020");
+        assert (Fill_Cycles.size() == 2 && Fill_Cycles[1] - Fill_Cycles[0] < Latency) else $error("Error: Second refill should overlap the first");
+
+        // Test a miss with every MSHR taken waits for the oldest to free
+        load(32'h0000_0040, 0, 1, "Slow miss 0x040");
+        load(32'h0000_0060, 0, 1, "Slow miss 0x060");
+        load(32'h0000_0080, 1, 1, "Slow miss 0x080 with no free MSHR");
+        check_fills("Slow misses 0x040, 0x060 and 0x080");
+        Latency <= 1;
+
+        // Test an access to a line still being refilled waits for it then hits
+        load(32'h0000_00A0, 0, 1, "Load miss 0x0A0");
+        load(32'h0000_00A4, 1, 0, "Load 0x0A4 from the pending line");
+        load(32'h0000_00C0, 0, 1, "Load miss 0x0C0");
+        store(32'h0000_00C4, 4'b1111, 32'hFACE_CAFE, 1, "Store 0x0C4 to the pending line");
+        load(32'h0000_00C4, 0, 0, "Load stored word 0x0C4");
+        check_fills("Misses 0x0A0 and 0x0C0");
+
+        // Test a held fill keeps its MSHR, so a miss with none free waits until the fills are taken
+        Hold_Fills <= 1;
+        load(32'h0000_0300, 0, 1, "Held miss 0x300");
+        load(32'h0000_0340, 0, 1, "Held miss 0x340");
+        Addr <= 32'h0000_0380;
+        R_En <= 1;
+        repeat (30) @(posedge CLK);
+        assert (!Ready) else $error("Error: A miss should wait while every MSHR holds an unwritten load");
+        assert (Fills.size() == 0) else $error("Error: A held fill was taken");
+        Hold_Fills <= 0;
+        load(32'h0000_0380, 1, 1, "Miss 0x380 after the fills are taken");
+        check_fills("Held misses 0x300, 0x340 and 0x380");
+
+        repeat (5) @ (posedge CLK); // Allow some extra time at the end for visual clarity
+        $stop;
+    end
+
+    // Present a load like the memory stage does, holding it until it is accepted. A hit is checked the next cycle,
+    // a miss is expected on the fill port in order
+    task load(
+        input logic [31:0] addr,
+        input logic expected_Wait,
+        input logic expected_Miss,
+        input string name
+    );
+    logic missed;
+    begin
+        Addr <= addr;
+        R_En <= 1;
+        Cycles = 0;
+        do begin
+            @(posedge CLK);
+            Cycles++;
+        end while (!Ready && Cycles < 200);
+        missed = Miss;
+        R_En <= 0;
+        assert ((Cycles > 1) == expected_Wait) else $error("Error: %s, expected it %s", name, (expected_Wait) ? "to wait" : "accepted straight away");
+        assert (missed == expected_Miss) else $error("Error: %s, expected a %s", name, (expected_Miss) ? "miss" : "hit");
+        if (missed) begin
+            Expected.push_back(Shadow[addr[11:2]]);
+            Expected_IDs.push_back(Miss_ID);
+        end
+        else begin
+            @(posedge CLK);
+            assert (R_Data == Shadow[addr[11:2]]) else $error("Error: %s, expected 0x%h, got 0x%h", name, Shadow[addr[11:2]], $sampled(R_Data));
+        end
+    end
+    endtask
+
+    // Present a store, holding it until it is accepted
+    task store(
+        input logic [31:0] addr,
+        input logic [3:0] lanes,
+        input logic [31:0] data,
+        input logic expected_Wait,
+        input string name
+    );
+    begin
+        Addr <= addr;
+        W_En <= lanes;
+        W_Data <= data;
+        Cycles = 0;
+        do begin
+            @(posedge CLK);
+            Cycles++;
+        end while (!Ready && Cycles < 200);
+        W_En <= 4'b0000;
+        assert ((Cycles > 1) == expected_Wait) else $error("Error: %s, expected it %s", name, (expected_Wait) ? "to wait" : "accepted straight away");
+        for (int b = 0; b < 4; b++)
+            if (lanes[b]) Shadow[addr[11:2]][b*8 +: 8] = data[b*8 +: 8];
+    end
+    endtask
+
+    // Wait for every accepted miss to come back and free its MSHR, checking they come out in miss order with the right words
+    task check_fills(
+        input string name
+    );
+    begin
+        Cycles = 0;
+        while ((Fills.size() < Expected.size() || dcache.MSHR_Used != '0) && Cycles < 200) begin
+            @(posedge CLK);
+            Cycles++;
+        end
+        assert (Fills.size() == Expected.size()) else $error("Error: %s, expected %0d fills, got %0d", name, Expected.size(), Fills.size());
+        for (int i = 0; i < Fills.size() && i < Expected.size(); i++) begin
+            assert (Fill_IDs[i] == Expected_IDs[i]) else $error("Error: %s, fill %0d came from MSHR %0d, expected %0d", name, i, Fill_IDs[i], Expected_IDs[i]);
+            assert (Fills[i] == Expected[i]) else $error("Error: %s, fill %0d expected 0x%h, got 0x%h", name, i, Expected[i], Fills[i]);
+        end
+        Expected.delete();
+        Expected_IDs.delete();
+        Fills.delete();
+        Fill_IDs.delete();
+        Fill_Cycles.delete();
+    end
+    endtask
+endmodule
@@ -0,0 +1,172 @@
+//////////////////////////////////////////////////////////////////////////////////
+// Third Year Project: RISC-V RV32i Pipelined Processor
+// File: Data Cache Testbench
+// Description: Ensures that the data cache refills on a load or store miss, merges byte and halfword stores into
+//              cached words, writes dirty victims back through the write buffer without slowing the refill and
+//              never reads a line from memory before its write back lands. The backing memory model answers reads
+//              after a programmable latency and a shadow copy of memory checks every load, the cycles each access
+//              waits are reported.
+//              Assumes the default 1KB, 16 byte line, 2 way cache so addresses 512 bytes apart share a set.
+// Author: Luke Shepherd
+// Date Created: October 2026
+//////////////////////////////////////////////////////////////////////////////////
+
+import definitions::*;
+
+module data_cache_testbench;
+    logic CLK, RST; // Wrap module with a clock to control the sim more easily and better represent the external system
+
+    // Input signals
+    logic [31:0] Addr;
+    logic R_En;
+    logic [3:0] W_En;
+    logic [31:0] W_Data;
+
+    // Output signals
+    logic Ready;
+    logic [31:0] R_Data;
+
+    // Backing memory
+    wire Mem_Req, Mem_Write;
+    wire [31:2] Mem_Addr;
+    wire [31:0] Mem_W_Data;
+    logic Mem_Valid;
+    logic [31:0] Mem_R_Data;
+    int Latency; // Cycles from a read being taken to its response, 1 is the BRAM
+    logic Pipe_Valid [16];
+    logic [31:2] Pipe_Addr [16];
+    logic [31:0] Backing [1024];
+    logic [31:0] Shadow [1024]; // What every load should see
+
+    int Cycles, Clean_Cycles;
+
+    data_cache dcache (
+        .CLK(CLK),
+        .RST(RST),
+        .Addr(Addr[31:2]),
+        .R_En(R_En),
+        .W_En(W_En),
+        .W_Data(W_Data),
+        .Ready(Ready),
+        .R_Data(R_Data),
+        .Mem_Req(Mem_Req),
+        .Mem_Write(Mem_Write),
+        .Mem_Addr(Mem_Addr),
+        .Mem_W_Data(Mem_W_Data),
+        .Mem_Ready(1'b1),
+        .Mem_Valid(Mem_Valid),
+        .Mem_R_Data(Mem_R_Data),
+        .Miss(), // Blocking by default, the MSHRs have their own testbench
+        .Miss_ID(),
+        .Fill_Valid(),
+        .Fill_ID(),
+        .Fill_Data(),
+        .Fill_Taken(1'b0)
+    );
+
+    initial CLK <= 1; // Initialize the clock
+    always #(CLOCK_PERIOD / 2) CLK <= ~CLK; // Generate the clock
+
+    // Writes land when taken, every read is answered in order Latency cycles later
+    always @ (posedge CLK) begin
+        if (Mem_Req && Mem_Write) Backing[Mem_Addr[11:2]] <= Mem_W_Data;
+        Pipe_Valid[0] <= Mem_Req && !Mem_Write && !RST;
+        Pipe_Addr[0] <= Mem_Addr;
+        for (int i = 1; i < 16; i++) begin
+            Pipe_Valid[i] <= Pipe_Valid[i-1];
+            Pipe_Addr[i] <= Pipe_Addr[i-1];
+        end
+    end
+
+    assign Mem_Valid = Pipe_Valid[Latency-1];
+    assign Mem_R_Data = Backing[Pipe_Addr[Latency-1][11:2]];
+
+    initial begin
+        // Initialize signals with reset
+        RST <= 1;
+        Addr <= 32'h0;
+        R_En <= 0;
+        W_En <= 4'b0000;
+        W_Data <= 32'h0;
+        Latency <= 1;
+        for (int i = 0; i < 16; i++) Pipe_Valid[i] <= 0;
+        for (int i = 0; i < 1024; i++) begin
+            Backing[i] = 32'hC000_0000 + i;
+            Shadow[i] = 32'hC000_0000 + i;
+        end
+        @(posedge CLK);
+        RST <= 0;
+        @(posedge CLK);
+
+        // Test a cold load miss refills the line then the rest of it hits
+        access(32'h0000_0000, 4'b0000, 32'h0, 1, "Cold load miss 0x000");
+        Clean_Cycles = Cycles;
+        access(32'h0000_000C, 4'b0000, 32'h0, 0, "Same line load 0x00C");
+
+        // Test byte and halfword stores merge into the cached word
+        access(32'h0000_0001, 4'b0010, 32'h0000_AB00, 0, "Byte store hit 0x001");
+        access(32'h0000_0000, 4'b0000, 32'h0, 0, "Load merged byte 0x000");
+        access(32'h0000_0006, 4'b1100, 32'h1234_0000, 0, "Halfword store hit 0x006");
+        access(32'h0000_0004, 4'b0000, 32'h0, 0, "Load merged halfword 0x004");
+        assert (Backing[0] == 32'hC000_0000) else $error("Error: Store hit should stay in the cache until evicted");
+
+        // Test a store miss allocates the line then merges like a hit
+        access(32'h0000_0013, 4'b1000, 32'h5A00_0000, 1, "Byte store miss 0x013");
+        access(32'h0000_0010, 4'b0000, 32'h0, 0, "Load allocated line 0x010");
+
+        // Test a dirty victim doesn't slow its refill
+        access(32'h0000_0200, 4'b0000, 32'h0, 1, "Same set 0x200");
+        access(32'h0000_0400, 4'b0000, 32'h0, 1, "Dirty victim 0x400 evicts 0x000");
+        assert (Cycles == Clean_Cycles) else $error("Error: Dirty victim took %0d cycles against %0d for a clean one", Cycles, Clean_Cycles);
+
+        // Test reloading the victim straight away gets the written back data, not the stale memory
+        access(32'h0000_0000, 4'b0000, 32'h0, 1, "Reload victim 0x000");
+        access(32'h0000_0004, 4'b0000, 32'h0, 0, "Reload victim 0x004");
+        assert (Backing[0] == Shadow[0] && Backing[1] == Shadow[1]) else $error("Error: Victim line wasn't written back");
+
+        // Test two dirty victims queue in the buffer behind a slow memory
+        Latency <= 8;
+        access(32'h0000_0408, 4'b1111, 32'hDEAD_BEEF, 0, "Word store hit 0x408");
+        access(32'h0000_000C, 4'b0011, 32'h0000_F00D, 0, "Halfword store hit 0x00C");
+        access(32'h0000_0200, 4'b0000, 32'h0, 1, "Slow memory 0x200 evicts 0x400");
+        access(32'h0000_0600, 4'b0000, 32'h0, 1, "Slow memory 0x600 evicts 0x000");
+        repeat (20) @(posedge CLK); // Let the buffer drain
+        assert (Backing[10'h102] == 32'hDEAD_BEEF && Backing[3] == Shadow[3]) else $error("Error: Buffered victims weren't both written back");
+        access(32'h0000_0408, 4'b0000, 32'h0, 1, "Slow memory reload 0x408");
+        access(32'h0000_000C, 4'b0000, 32'h0, 1, "Slow memory reload 0x00C");
+        Latency <= 1;
+
+        repeat (5) @ (posedge CLK); // Allow some extra time at the end for visual clarity
+        $stop;
+    end
+
+    // Present an access like the memory stage does, holding it until it is accepted, load data is checked the next cycle
+    task access(
+        input logic [31:0] addr,
+        input logic [3:0] lanes, // None for a load
+        input logic [31:0] data,
+        input logic expected_Miss,
+        input string name
+    );
+    begin
+        Addr <= addr;
+        R_En <= (lanes == 4'b0000);
+        W_En <= lanes;
+        W_Data <= data;
+        Cycles = 0;
+        do begin
+            @(posedge CLK);
+            Cycles++;
+        end while (!Ready && Cycles < 200);
+        R_En <= 0;
+        W_En <= 4'b0000;
+        assert ((Cycles > 1) == expected_Miss) else $error("Error: %s, expected a %s", name, (expected_Miss) ? "miss" : "hit");
+        if (lanes == 4'b0000) begin
+            @(posedge CLK);
+            assert (R_Data == Shadow[addr[11:2]]) else $error("Error: %s, expected 0x%h, got 0x%h", name, Shadow[addr[11:2]], $sampled(R_Data));
+        end
+        else for (int b = 0; b < 4; b++)
+            if (lanes[b]) Shadow[addr[11:2]][b*8 +: 8] = data[b*8 +: 8];
+    end
+    endtask
+endmodule
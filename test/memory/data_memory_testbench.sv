@@ -1,31 +1,78 @@
 //////////////////////////////////////////////////////////////////////////////////                                                           
 // Third Year Project: RISC-V RV32i Pipelined Processor
 // File: Data Memory Testbench                                                   
-// Description: This is a testbench to ensure that the data memory stores and loads data correctly.
+// Description: This is a testbench to ensure that the data memory stores and loads data correctly
+//              and that accesses beyond the memory size are caught rather than wrapping around.
+//              With split memories the instruction memory window is checked through the fetch port.
 // Author: Luke Shepherd                                                     
-// Date Modified: March 2025                                                                                                                                                                                                                                                       
+// Date Modified: October 2026                                                                                                                                                                                                                                                       
 //////////////////////////////////////////////////////////////////////////////////
 
 import definitions::*;
 
 module data_memory_testbench;
-    logic CLK, MEM_W_En; 
+    logic CLK, MEM_W_En, Data_Fault; 
     logic [2:0] MEM_Control;
-    logic [11:0] RW_Addr;
+    logic [31:0] RW_Addr;
     logic [31:0] W_Data;
     logic [31:0] Data_Out;
+    logic [31:2] Fetch_Addr;
+    logic [31:0] Fetch_Data;
+
+    localparam int DATA_ADDR_WIDTH = (SPLIT_MEMORY) ? DMEM_ADDR_WIDTH : MEM_ADDR_WIDTH;
     
-    unified_memory dmem (
+    unified_memory #(
+        .DCACHE_EN(1'b0), // Checks the BRAM directly, the cache and store buffer have their own testbenches
+        .STORE_BUFFER_EN(1'b0)
+    ) dmem (
         .CLK(CLK),
         .RST(1'b0),
-        .Flush_D(1'b0),
-        .Stall_En(1'b0),
         .MEM_W_En(MEM_W_En),
+        .MEM_R_En(!MEM_W_En),
         .MEM_Control(MEM_Control),
         .RW_Addr(RW_Addr),
         .SrcB_Reg_M(W_Data),
+        .RD(5'b0),
         .R_Data(Data_Out),
-        .PC_Addr(10'b0)
+        .Data_Ready(),
+        .Data_Fault(Data_Fault),
+        .Load_Miss(),
+        .Fill_Done(),
+        .Fill_RD(),
+        .Fill_Out(),
+        .Fill_W_En(1'b0),
+        .Instr_Store(),
+        .Instr_Store_Addr(),
+        .Fetch_Req(1'b1),
+        .Fetch_Addr(Fetch_Addr),
+        .Fetch_Ready(),
+        .Fetch_Valid(),
+        .Fetch_Data(Fetch_Data),
+        .D_ARVALID(),
+        .D_ARREADY(1'b0),
+        .D_ARADDR(),
+        .D_ARLEN(),
+        .D_ARSIZE(),
+        .D_ARBURST(),
+        .D_RVALID(1'b0),
+        .D_RREADY(),
+        .D_RDATA(32'b0),
+        .D_RRESP(2'b0),
+        .D_RLAST(1'b0),
+        .D_AWVALID(),
+        .D_AWREADY(1'b0),
+        .D_AWADDR(),
+        .D_AWLEN(),
+        .D_AWSIZE(),
+        .D_AWBURST(),
+        .D_WVALID(),
+        .D_WREADY(1'b0),
+        .D_WDATA(),
+        .D_WSTRB(),
+        .D_WLAST(),
+        .D_BVALID(1'b0),
+        .D_BREADY(),
+        .D_BRESP(2'b0)
     );
 
     initial CLK <= 1; // Initialize the clock
@@ -33,6 +80,7 @@ module data_memory_testbench;
 
     initial begin
         MEM_W_En <= 0;
+        Fetch_Addr <= 30'b0;
         @(posedge CLK);
 
         // Test Store Byte
@@ -102,6 +150,46 @@ module data_memory_testbench;
         @(posedge CLK);
         @(posedge CLK);
         assert (Data_Out == 32'hFBBF_FAAF) else $error("Error: Unit did not load word correctly, expected 0xFBBFFAAF, got 0x%h", $sampled(Data_Out));
+
+        // Test a store just past the end of memory is caught and doesn't wrap onto address 0
+        MEM_W_En <= 1;
+        MEM_Control <= MEM_WORD;
+        RW_Addr <= 32'(1) << DATA_ADDR_WIDTH;
+        W_Data <= 32'hDEAD_BEEF;
+        @(posedge CLK);
+        assert (Data_Fault) else $error("Error: Store past the end of memory was not flagged");
+        @(posedge CLK);
+        assert (dmem.memory.ram_block[0] != 32'hDEAD_BEEF) else $error("Error: Store past the end of memory wrapped onto address 0");
+
+        // Test a load far outside memory is caught and reads zero
+        MEM_W_En <= 0;
+        RW_Addr <= 32'h4000_0004;
+        @(posedge CLK);
+        assert (Data_Fault) else $error("Error: Load outside memory was not flagged");
+        @(posedge CLK);
+        assert (Data_Out == 32'h0) else $error("Error: Load outside memory should read zero, got 0x%h", $sampled(Data_Out));
+
+        // Test the last word is still in range
+        RW_Addr <= (32'(1) << DATA_ADDR_WIDTH) - 4;
+        @(posedge CLK);
+        assert (!Data_Fault) else $error("Error: Last word of memory was flagged as out of range");
+
+        // Test split memories, a store in the window reaches instruction memory only and loads back uncached
+        if (SPLIT_MEMORY) begin
+            MEM_W_En <= 1;
+            MEM_Control <= MEM_WORD;
+            RW_Addr <= IMEM_WINDOW_BASE + 32'h10;
+            W_Data <= 32'h1234_5678;
+            @(posedge CLK);
+            assert (!Data_Fault) else $error("Error: Store to the instruction memory window was flagged");
+            MEM_W_En <= 0;
+            Fetch_Addr <= 30'h4;
+            @(posedge CLK); // Read back through both ports
+            @(posedge CLK);
+            assert (Fetch_Data == 32'h1234_5678) else $error("Error: Window store didn't reach instruction memory, fetched 0x%h", $sampled(Fetch_Data));
+            assert (dmem.memory.ram_block[4] != 32'h1234_5678) else $error("Error: Window store also reached data memory");
+            assert (Data_Out == 32'h1234_5678) else $error("Error: Load from the window read 0x%h", $sampled(Data_Out));
+        end
         
 
         operate(); // Test storing then reading from every address
@@ -0,0 +1,166 @@
+//////////////////////////////////////////////////////////////////////////////////
+// Third Year Project: RISC-V RV32i Pipelined Processor
+// File: Instruction Cache Testbench
+// Description: Ensures that the instruction cache refills on a miss, hits afterwards, replaces round-robin
+//              within a set, drops lines that are stored to and counts hits and misses. The backing memory
+//              model answers each request after a programmable latency with the byte address as the data,
+//              and the cycles each fetch waits are reported.
+//              Assumes the default 1KB, 16 byte line, 2 way cache so addresses 512 bytes apart share a set.
+// Author: Luke Shepherd
+// Date Created: October 2026
+//////////////////////////////////////////////////////////////////////////////////
+
+import definitions::*;
+
+module instruction_cache_testbench;
+    logic CLK, RST; // Wrap module with a clock to control the sim more easily and better represent the external system
+
+    // Input signals
+    logic [31:0] PC;
+    logic Stall_En, Snoop_En;
+    logic [31:0] Snoop_Addr;
+
+    // Output signals
+    logic Hit_F;
+    logic [31:0] Instr_Out;
+    logic [31:0] Hits, Misses;
+
+    // Backing memory
+    wire Fetch_Req;
+    wire [31:2] Fetch_Addr;
+    logic Fetch_Valid;
+    logic [31:0] Fetch_Data;
+    int Latency; // Cycles from a request being taken to its response, 1 is the BRAM
+    logic Pipe_Valid [16];
+    logic [31:2] Pipe_Addr [16];
+
+    int Cycles, Refill_Cycles;
+
+    instruction_cache icache (
+        .CLK(CLK),
+        .RST(RST),
+        .PC_F(PC[31:2]),
+        .Stall_En(Stall_En),
+        .Hit_F(Hit_F),
+        .Instr_Out(Instr_Out),
+        .Snoop_En(Snoop_En),
+        .Snoop_Addr(Snoop_Addr[31:2]),
+        .Fetch_Req(Fetch_Req),
+        .Fetch_Addr(Fetch_Addr),
+        .Fetch_Ready(1'b1),
+        .Fetch_Valid(Fetch_Valid),
+        .Fetch_Data(Fetch_Data),
+        .Hits(Hits),
+        .Misses(Misses)
+    );
+
+    initial CLK <= 1; // Initialize the clock
+    always #(CLOCK_PERIOD / 2) CLK <= ~CLK; // Generate the clock
+
+    // Every request is answered in order Latency cycles later
+    always @ (posedge CLK) begin
+        Pipe_Valid[0] <= Fetch_Req && !RST;
+        Pipe_Addr[0] <= Fetch_Addr;
+        for (int i = 1; i < 16; i++) begin
+            Pipe_Valid[i] <= Pipe_Valid[i-1];
+            Pipe_Addr[i] <= Pipe_Addr[i-1];
+        end
+    end
+
+    assign Fetch_Valid = Pipe_Valid[Latency-1];
+    assign Fetch_Data = {Pipe_Addr[Latency-1], 2'b00};
+
+    // Every hit must give the instruction for that PC the next cycle
+    assertInstrCorrect: assert property (@(posedge CLK) disable iff (RST) Hit_F |-> ##1 Instr_Out == $past(PC))
+            else $error("Error: Wrong instruction for 0x%h, got 0x%h", $sampled($past(PC)), $sampled(Instr_Out));
+
+    initial begin
+        // Initialize signals with reset
+        RST <= 1;
+        PC <= 32'h0;
+        Stall_En <= 1;
+        Snoop_En <= 0;
+        Snoop_Addr <= 32'h0;
+        Latency <= 1;
+        for (int i = 0; i < 16; i++) Pipe_Valid[i] <= 0;
+        @(posedge CLK);
+        RST <= 0;
+        @(posedge CLK);
+        assert (Hits == 0 && Misses == 0) else $error("Error: Counters should be clear after reset");
+
+        // Test a cold miss refills the line then the rest of it hits
+        fetch(32'h0000_0000, 1, "Cold miss 0x000");
+        Refill_Cycles = Cycles;
+        fetch(32'h0000_0004, 0, "Same line 0x004");
+        fetch(32'h0000_0008, 0, "Same line 0x008");
+        fetch(32'h0000_000C, 0, "Same line 0x00C");
+        fetch(32'h0000_0010, 1, "Next line 0x010");
+
+        // Test a second line in the same set takes the other way
+        fetch(32'h0000_0200, 1, "Same set 0x200");
+        fetch(32'h0000_0000, 0, "First way kept 0x000");
+
+        // Test a third line replaces round-robin, the first way goes then the second
+        fetch(32'h0000_0400, 1, "Third in set 0x400");
+        fetch(32'h0000_0204, 0, "Second way kept 0x204");
+        fetch(32'h0000_0000, 1, "First way replaced 0x000");
+        fetch(32'h0000_0404, 0, "Third kept 0x404");
+
+        // Test a store to a cached line drops it
+        Snoop_En <= 1;
+        Snoop_Addr <= 32'h0000_0014;
+        @(posedge CLK);
+        Snoop_En <= 0;
+        fetch(32'h0000_0010, 1, "Stored to 0x010");
+
+        // Test a store during the refill of its line makes it refill again
+        PC <= 32'h0000_0600;
+        Stall_En <= 0;
+        @(posedge CLK);
+        Snoop_En <= 1;
+        Snoop_Addr <= 32'h0000_0608;
+        @(posedge CLK);
+        Snoop_En <= 0;
+        Cycles = 2;
+        while (!Hit_F && Cycles < 100) begin
+            @(posedge CLK);
+            Cycles++;
+        end
+        Stall_En <= 1;
+        assert (Misses == 8) else $error("Error: Line stored to during its refill should refill again, %0d misses", $sampled(Misses));
+        assert (Cycles > Refill_Cycles) else $error("Error: Line stored to during its refill took %0d cycles, no more than one refill", Cycles);
+
+        // Test a slower backing memory only lengthens the refill
+        Latency <= 4;
+        fetch(32'h0000_0800, 1, "Slow memory 0x800");
+        assert (Cycles == Refill_Cycles + 3) else $error("Error: Latency 4 refill took %0d cycles, expected %0d", Cycles, Refill_Cycles + 3);
+        fetch(32'h0000_0804, 0, "Slow memory hit 0x804");
+        Latency <= 1;
+
+        // Test the counters, hits only count fetches that didn't wait
+        @(posedge CLK);
+        assert (Hits == 7 && Misses == 9) else $error("Error: Expected 7 hits and 9 misses, got %0d and %0d", $sampled(Hits), $sampled(Misses));
+
+        repeat (5) @ (posedge CLK); // Allow some extra time at the end for visual clarity
+        $stop;
+    end
+
+    // Present a PC like fetch does, holding it until it hits, then move on the next cycle
+    task fetch(
+        input logic [31:0] pc,
+        input logic expected_Miss,
+        input string name
+    );
+    begin
+        PC <= pc;
+        Stall_En <= 0;
+        Cycles = 0;
+        do begin
+            @(posedge CLK);
+            Cycles++;
+        end while (!Hit_F && Cycles < 100);
+        assert ((Cycles > 1) == expected_Miss) else $error("Error: %s, expected a %s", name, (expected_Miss) ? "miss" : "hit");
+        Stall_En <= 1; // Idle cycles aren't fetches
+    end
+    endtask
+endmodule
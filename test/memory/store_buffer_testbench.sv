@@ -0,0 +1,188 @@
+//////////////////////////////////////////////////////////////////////////////////
+// Third Year Project: RISC-V RV32i Pipelined Processor
+// File: Store Buffer Testbench
+// Description: Ensures that stores complete straight away while the memory can't take writes and only wait once
+//              the buffer is full, that loads see buffered bytes merged over memory, that stores to a buffered
+//              word coalesce into one write and that everything drains once the memory is free. The memory model
+//              always takes loads, returning data the next cycle like the BRAM, and takes writes when Write_Ready.
+//              Assumes the default 4 entry buffer.
+// Author: Luke Shepherd
+// Date Created: October 2026
+//////////////////////////////////////////////////////////////////////////////////
+
+import definitions::*;
+
+module store_buffer_testbench;
+    logic CLK, RST; // Wrap module with a clock to control the sim more easily and better represent the external system
+
+    // Input signals
+    logic [31:0] Addr;
+    logic R_En;
+    logic [3:0] W_En;
+    logic [31:0] W_Data;
+
+    // Output signals
+    logic Ready;
+    logic [3:0] Fwd_Lanes;
+    logic [31:0] Fwd_Data;
+    logic [31:0] Load_Data; // Memory word with the buffered bytes over it
+
+    // Memory
+    wire [31:2] Out_Addr;
+    wire Out_R_En;
+    wire [3:0] Out_W_En;
+    wire [31:0] Out_W_Data;
+    wire Out_Ready;
+    logic Write_Ready;
+    logic [31:0] Mem [256];
+    logic [31:0] Mem_Out;
+    logic [31:0] Shadow [256]; // What every load should see
+    int Writes;
+
+    store_buffer sb (
+        .CLK(CLK),
+        .RST(RST),
+        .Addr(Addr[31:2]),
+        .R_En(R_En),
+        .W_En(W_En),
+        .W_Data(W_Data),
+        .Ready(Ready),
+        .Fwd_Lanes(Fwd_Lanes),
+        .Fwd_Data(Fwd_Data),
+        .Out_Addr(Out_Addr),
+        .Out_R_En(Out_R_En),
+        .Out_W_En(Out_W_En),
+        .Out_W_Data(Out_W_Data),
+        .Out_Ready(Out_Ready)
+    );
+
+    initial CLK <= 1; // Initialize the clock
+    always #(CLOCK_PERIOD / 2) CLK <= ~CLK; // Generate the clock
+
+    assign Out_Ready = Out_R_En || Write_Ready;
+
+    always @ (posedge CLK) begin
+        if (Out_Ready && (|Out_W_En)) begin
+            for (int b = 0; b < 4; b++)
+                if (Out_W_En[b]) Mem[Out_Addr[9:2]][b*8 +: 8] <= Out_W_Data[b*8 +: 8];
+            Writes++;
+        end
+        Mem_Out <= Mem[Out_Addr[9:2]];
+    end
+
+    always_comb begin
+        for (int b = 0; b < 4; b++)
+            Load_Data[b*8 +: 8] = (Fwd_Lanes[b]) ? Fwd_Data[b*8 +: 8] : Mem_Out[b*8 +: 8];
+    end
+
+    initial begin
+        // Initialize signals with reset
+        RST <= 1;
+        Addr <= 32'h0;
+        R_En <= 0;
+        W_En <= 4'b0000;
+        W_Data <= 32'h0;
+        Write_Ready <= 0;
+        Writes = 0;
+        for (int i = 0; i < 256; i++) begin
+            Mem[i] = 32'hA000_0000 + i;
+            Shadow[i] = 32'hA000_0000 + i;
+        end
+        @(posedge CLK);
+        RST <= 0;
+        @(posedge CLK);
+
+        // Test stores complete while the memory can't take them until the buffer is full
+        store(32'h0000_0000, 4'b1111, 32'h1111_1111, "Store 0x00 into buffer");
+        store(32'h0000_0004, 4'b1111, 32'h2222_2222, "Store 0x04 into buffer");
+        store(32'h0000_0008, 4'b1111, 32'h3333_3333, "Store 0x08 into buffer");
+        store(32'h0000_000C, 4'b1111, 32'h4444_4444, "Store 0x0C into buffer");
+        assert (Writes == 0) else $error("Error: Nothing should be written while the memory is busy");
+
+        // Test loads forward from the buffer or read memory
+        load(32'h0000_0004, "Load 0x04 forwarded");
+        load(32'h0000_0040, "Load 0x40 from memory");
+
+        // Test a store into a full buffer waits for a drain
+        Addr <= 32'h0000_0010;
+        W_En <= 4'b1111;
+        W_Data <= 32'h5555_5555;
+        repeat (2) begin
+            @(posedge CLK);
+            assert (!Ready) else $error("Error: A store into a full buffer should wait while the memory is busy");
+        end
+        Write_Ready <= 1;
+        @(posedge CLK); // Oldest entry is written
+        assert (!Ready) else $error("Error: A store into a full buffer should wait for the drain to finish");
+        @(posedge CLK);
+        assert (Ready) else $error("Error: A store should take the entry freed by the drain");
+        W_En <= 4'b0000;
+        Shadow[4] = 32'h5555_5555;
+        repeat (8) @(posedge CLK);
+        assert (Writes == 5) else $error("Error: Expected 5 writes, got %0d", Writes);
+        for (int i = 0; i < 5; i++)
+            assert (Mem[i] == Shadow[i]) else $error("Error: Word %0d drained as 0x%h, expected 0x%h", i, Mem[i], Shadow[i]);
+
+        // Test byte stores to one word coalesce and partial words forward over memory
+        Write_Ready <= 0;
+        store(32'h0000_0020, 4'b0001, 32'h0000_0011, "Byte store 0x20");
+        store(32'h0000_0021, 4'b0010, 32'h0000_2200, "Byte store 0x21");
+        load(32'h0000_0020, "Load 0x20 half buffered");
+        store(32'h0000_0022, 4'b1100, 32'h3344_0000, "Halfword store 0x22");
+        store(32'h0000_0023, 4'b1000, 32'h5500_0000, "Byte store 0x23");
+        load(32'h0000_0020, "Load 0x20 all buffered");
+        Write_Ready <= 1;
+        repeat (3) @(posedge CLK);
+        assert (Writes == 6) else $error("Error: Coalesced stores should be one write, got %0d", Writes - 5);
+        assert (Mem[8] == Shadow[8]) else $error("Error: Coalesced word drained as 0x%h, expected 0x%h", Mem[8], Shadow[8]);
+
+        // Test a load straight after its store forwards even with the memory free
+        store(32'h0000_0030, 4'b1111, 32'h6666_6666, "Store 0x30");
+        load(32'h0000_0030, "Load 0x30 straight after");
+
+        // Test a store to the word being written takes a new entry rather than being lost
+        store(32'h0000_0050, 4'b0001, 32'h0000_0077, "Byte store 0x50");
+        store(32'h0000_0051, 4'b0010, 32'h0000_8800, "Byte store 0x51 as 0x50 drains");
+        repeat (3) @(posedge CLK);
+        assert (Mem[20] == Shadow[20]) else $error("Error: Word 0x50 drained as 0x%h, expected 0x%h", Mem[20], Shadow[20]);
+        load(32'h0000_0050, "Load 0x50 after drain");
+
+        repeat (5) @ (posedge CLK); // Allow some extra time at the end for visual clarity
+        $stop;
+    end
+
+    // Present a store like the memory stage does, it should be taken straight away while the buffer has room
+    task store(
+        input logic [31:0] addr,
+        input logic [3:0] lanes,
+        input logic [31:0] data,
+        input string name
+    );
+    begin
+        Addr <= addr;
+        W_En <= lanes;
+        W_Data <= data;
+        @(posedge CLK);
+        assert (Ready) else $error("Error: %s, should not wait", name);
+        W_En <= 4'b0000;
+        for (int b = 0; b < 4; b++)
+            if (lanes[b]) Shadow[addr[9:2]][b*8 +: 8] = data[b*8 +: 8];
+    end
+    endtask
+
+    // Present a load, it always goes straight to memory and the merged word is checked the next cycle
+    task load(
+        input logic [31:0] addr,
+        input string name
+    );
+    begin
+        Addr <= addr;
+        R_En <= 1;
+        @(posedge CLK);
+        assert (Ready) else $error("Error: %s, should not wait", name);
+        R_En <= 0;
+        @(posedge CLK);
+        assert (Load_Data == Shadow[addr[9:2]]) else $error("Error: %s, expected 0x%h, got 0x%h", name, Shadow[addr[9:2]], $sampled(Load_Data));
+    end
+    endtask
+endmodule
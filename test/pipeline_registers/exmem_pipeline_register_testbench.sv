@@ -3,14 +3,14 @@
 // Module: Execute to Memory Pipeline Register Testbench                                                  
 // Description: Tests that the pipeline register responds to control signals correctly and passes data through.
 // Author: Luke Shepherd                                                     
-// Date Modified: March 2025                                                                                                                                                                                                                                            
+// Date Modified: October 2026                                                                                                                                                                                                                                            
 //////////////////////////////////////////////////////////////////////////////////
 
 import definitions::*;
 
 module exmem_pipeline_register_testbench ();
     // Global control signals
-    logic CLK, RST;
+    logic CLK, RST, Flush_M, Stall_M;
 
     // Input signals
     logic REG_W_En_E, MEM_W_En_E; 
@@ -34,6 +34,8 @@ module exmem_pipeline_register_testbench ();
         // Global control signals
         .CLK(CLK),
         .RST(RST),
+        .Flush_M(Flush_M),
+        .Stall_M(Stall_M),
 
         // Inputs
         .REG_W_En_E(REG_W_En_E),
@@ -62,6 +64,8 @@ module exmem_pipeline_register_testbench ();
     initial begin
         // Initialize basic signals with reset
         RST <= 1;
+        Flush_M <= 0;
+        Stall_M <= 0;
         @(posedge CLK);
         RST <= 0;
 
@@ -71,6 +75,18 @@ module exmem_pipeline_register_testbench ();
         @(posedge CLK);
         RST <= 0;
 
+        // Test flush
+        operate(5);
+        Flush_M <= 1;
+        @(posedge CLK);
+        Flush_M <= 0;
+
+        // Test stall
+        operate(5);
+        Stall_M <= 1;
+        operate(3);
+        Stall_M <= 0;
+
         // Test normal operation and then end
         operate(5);
         $stop;
@@ -97,14 +113,26 @@ module exmem_pipeline_register_testbench ();
         else $error("Error: Register did not reset correctly, expected enable signals to be zero but got REG_W_En_M %h, MEM_W_En_M %h", 
             $sampled(REG_W_En_E), $sampled(MEM_W_En_E));
 
+    // Assert enables are cleared when the misfetched instruction in execute is flushed
+    assertRegisterFlushEnables: assert property (@(posedge CLK) 
+        ((Flush_M && !RST) |-> ##1 (REG_W_En_M == 1'b0 && MEM_W_En_M == 1'b0)))
+        else $error("Error: Register did not flush correctly, expected enable signals to be zero but got REG_W_En_M %h, MEM_W_En_M %h", 
+            $sampled(REG_W_En_M), $sampled(MEM_W_En_M));
+
+    // Assert register holds its contents when stalled
+    assertRegisterHolds: assert property (@(posedge CLK) 
+        ((Stall_M && !Flush_M && !RST) |-> ##1 (REG_W_En_M == $past(REG_W_En_M) && MEM_W_En_M == $past(MEM_W_En_M) && RD_M == $past(RD_M) && SrcB_Reg_M == $past(SrcB_Reg_M) && ALU_Out_M == $past(ALU_Out_M))))
+        else $error("Error: Register did not hold during stall, got REG_W_En_M %h MEM_W_En_M %h RD_M %h SrcB_Reg_M %h ALU_Out_M %h", 
+            $sampled(REG_W_En_M), $sampled(MEM_W_En_M), $sampled(RD_M), $sampled(SrcB_Reg_M), $sampled(ALU_Out_M));
+
     // Assert register passes enables and data correctly
     assertRegisterPassesEnables: assert property (@(posedge CLK)
-        ((RST == 0) |-> ##1 (REG_W_En_M == $past(REG_W_En_E) && MEM_W_En_M == $past(MEM_W_En_E))))
+        ((RST == 0 && !Flush_M && !Stall_M) |-> ##1 (REG_W_En_M == $past(REG_W_En_E) && MEM_W_En_M == $past(MEM_W_En_E))))
         else $error("Error: Register did not pass data correctly, expected enable signals to be REG_W_En_M %h MEM_W_En_M %h but got REG_W_En_M %h MEM_W_En_M %h", 
             $sampled($past(REG_W_En_E)), $sampled($past(MEM_W_En_E)), $sampled(REG_W_En_M), $sampled(MEM_W_En_M));
 
     assertRegisterPassesOther: assert property (@(posedge CLK)
-        ((RST == 0) |-> ##1 (MEM_Control_M == $past(MEM_Control_E) && Result_Src_Sel_M == $past(Result_Src_Sel_E) && RD_M == $past(RD_E) && SrcB_Reg_M == $past(SrcB_Reg_E) && ALU_Out_M == $past(ALU_Out_E) && PC_Plus_4_M == $past(PC_Plus_4_E))))
+        ((RST == 0 && !Flush_M && !Stall_M) |-> ##1 (MEM_Control_M == $past(MEM_Control_E) && Result_Src_Sel_M == $past(Result_Src_Sel_E) && RD_M == $past(RD_E) && SrcB_Reg_M == $past(SrcB_Reg_E) && ALU_Out_M == $past(ALU_Out_E) && PC_Plus_4_M == $past(PC_Plus_4_E))))
         else $error("Error: Register did not pass data correctly, expected MEM_Control_M %h Result_Src_Sel_M %h RD_M %h SrcB_Reg_M %h ALU_Out_M %h PC_Plus_4_M %h but got MEM_Control_M %h Result_Src_Sel_M %h RD_M %h SrcB_Reg_M %h ALU_Out_M %h PC_Plus_4_M %h", 
             $sampled($past(MEM_Control_E)), $sampled($past(Result_Src_Sel_E)), $sampled($past(RD_E)), $sampled($past(SrcB_Reg_E)), $sampled($past(ALU_Out_E)), $sampled($past(PC_Plus_4_E)),
             $sampled(MEM_Control_M), $sampled(Result_Src_Sel_M), $sampled(RD_M), $sampled(SrcB_Reg_M), $sampled(ALU_Out_M), $sampled(PC_Plus_4_M)); 
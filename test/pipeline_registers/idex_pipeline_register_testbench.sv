@@ -3,24 +3,26 @@
 // Module: Decode to Execute Pipeline Register Testbench                                                  
 // Description: Tests that the pipeline register responds to control signals correctly and passes data through.
 // Author: Luke Shepherd                                                     
-// Date Modified: March 2025                                                                                                                                                                                                                                            
+// Date Modified: October 2026                                                                                                                                                                                                                                            
 //////////////////////////////////////////////////////////////////////////////////
 
 import definitions::*;
 
 module idex_pipeline_register_testbench ();
     // Global control signals
-    logic CLK, RST, Flush_E;
+    logic CLK, RST, Flush_E, Stall_E, Stall_W;
 
     // Input signals
     logic REG_W_En_D, MEM_W_En_D, Jump_En_D, Branch_En_D;
     logic [2:0] MEM_Control_D;
-    logic [3:0] ALU_Control_D;
+    logic [ALU_CONTROL_WIDTH-1:0] ALU_Control_D;
     logic Branch_Src_Sel_D;
     logic ALU_SrcA_Sel_D, ALU_SrcB_Sel_D;
     logic [1:0] Result_Src_Sel_D;
     logic [4:0] RD_D, RS1_D, RS2_D;
     logic [31:0] REG_R_Data1_D, REG_R_Data2_D;
+    logic [1:0] FWD_SrcA_D, FWD_SrcB_D;
+    logic [31:0] SrcA_Reg_E, SrcB_Reg_E;
     logic [31:0] Imm_Ext_D;
     logic [31:0] PC_D, PC_Plus_4_D;
     logic Predict_Taken_D;
@@ -29,12 +31,13 @@ module idex_pipeline_register_testbench ();
     // Output signals
     logic REG_W_En_E, MEM_W_En_E, Jump_En_E, Branch_En_E;
     logic [2:0] MEM_Control_E;
-    logic [3:0] ALU_Control_E;
+    logic [ALU_CONTROL_WIDTH-1:0] ALU_Control_E;
     logic Branch_Src_Sel_E;
     logic ALU_SrcA_Sel_E, ALU_SrcB_Sel_E;
     logic [1:0] Result_Src_Sel_E;
     logic [4:0] RD_E, RS1_E, RS2_E;
     logic [31:0] REG_R_Data1_E, REG_R_Data2_E;
+    logic [1:0] FWD_SrcA_E, FWD_SrcB_E;
     logic [31:0] Imm_Ext_E;
     logic [31:0] PC_E, PC_Plus_4_E;
     logic Predict_Taken_E;
@@ -45,6 +48,8 @@ module idex_pipeline_register_testbench ();
         .CLK(CLK),
         .RST(RST),
         .Flush_E(Flush_E),
+        .Stall_E(Stall_E),
+        .Stall_W(Stall_W),
 
         // Input signals
         .REG_W_En_D(REG_W_En_D),
@@ -62,6 +67,10 @@ module idex_pipeline_register_testbench ();
         .RS2_D(RS2_D),
         .REG_R_Data1_D(REG_R_Data1_D),
         .REG_R_Data2_D(REG_R_Data2_D),
+        .FWD_SrcA_D(FWD_SrcA_D),
+        .FWD_SrcB_D(FWD_SrcB_D),
+        .SrcA_Reg_E(SrcA_Reg_E),
+        .SrcB_Reg_E(SrcB_Reg_E),
         .Imm_Ext_D(Imm_Ext_D),
         .PC_D(PC_D),
         .PC_Plus_4_D(PC_Plus_4_D),
@@ -84,6 +93,8 @@ module idex_pipeline_register_testbench ();
         .RS2_E(RS2_E),
         .REG_R_Data1_E(REG_R_Data1_E),
         .REG_R_Data2_E(REG_R_Data2_E),
+        .FWD_SrcA_E(FWD_SrcA_E),
+        .FWD_SrcB_E(FWD_SrcB_E),
         .Imm_Ext_E(Imm_Ext_E),
         .PC_E(PC_E),
         .PC_Plus_4_E(PC_Plus_4_E),
@@ -98,6 +109,8 @@ module idex_pipeline_register_testbench ();
         // Reset
         RST <= 1;
         Flush_E <= 0;
+        Stall_E <= 0;
+        Stall_W <= 0;
         @(posedge CLK);
         RST <= 0;
 
@@ -113,6 +126,15 @@ module idex_pipeline_register_testbench ();
         @(posedge CLK);
         Flush_E <= 0;
 
+        // Test stall with writeback moving on and then waiting on a load
+        operate(5);
+        Stall_E <= 1;
+        operate(3);
+        Stall_W <= 1;
+        operate(3);
+        Stall_E <= 0;
+        Stall_W <= 0;
+
         // Test normal operation and then end
         operate(5);
         $stop;
@@ -135,6 +157,10 @@ module idex_pipeline_register_testbench ();
             RS2_D <= $urandom;
             REG_R_Data1_D <= $urandom;
             REG_R_Data2_D <= $urandom;
+            FWD_SrcA_D <= $urandom;
+            FWD_SrcB_D <= $urandom;
+            SrcA_Reg_E <= $urandom;
+            SrcB_Reg_E <= $urandom;
             Imm_Ext_D <= $urandom;
             PC_D <= $urandom;
             PC_Plus_4_D <= $urandom;
@@ -164,31 +190,63 @@ module idex_pipeline_register_testbench ();
         else $error("Error: Register did not flush correctly, expected PC to be 0x2A2A2A2A but got PC_E %h, PC_Plus_4_E %h", 
             $sampled(PC_E), $sampled(PC_Plus_4_E));
 
+    assertRegisterFlushForwarding: assert property (@(posedge CLK) 
+        ((Flush_E || RST) |-> ##1 (FWD_SrcA_E == FWD_NONE && FWD_SrcB_E == FWD_NONE)))
+        else $error("Error: Register did not clear forwarding selects, got FWD_SrcA_E %h, FWD_SrcB_E %h", 
+            $sampled(FWD_SrcA_E), $sampled(FWD_SrcB_E));
+
+    assertRegisterFlushNOP: assert property (@(posedge CLK) 
+        ((Flush_E || RST) |-> ##1 (ALU_Control_E == ALU_ADD && Result_Src_Sel_E == RESULT_ALU && RD_E == 5'b0)))
+        else $error("Error: Register did not insert ADDI x0, x0, 0, got ALU_Control_E %h Result_Src_Sel_E %h RD_E %h", 
+            $sampled(ALU_Control_E), $sampled(Result_Src_Sel_E), $sampled(RD_E));
+
+    // --------------------------------------------------------
+
+    // Assert a held instruction keeps its controls but picks up its forwarded operands
+    assertRegisterHoldsControls: assert property (@(posedge CLK) 
+        ((Stall_E && !Flush_E && !RST) |-> ##1 (REG_W_En_E == $past(REG_W_En_E) && MEM_W_En_E == $past(MEM_W_En_E) && ALU_Control_E == $past(ALU_Control_E) && RD_E == $past(RD_E) && PC_E == $past(PC_E))))
+        else $error("Error: Register did not hold during stall, got REG_W_En_E %h MEM_W_En_E %h ALU_Control_E %h RD_E %h PC_E %h", 
+            $sampled(REG_W_En_E), $sampled(MEM_W_En_E), $sampled(ALU_Control_E), $sampled(RD_E), $sampled(PC_E));
+
+    assertRegisterHoldsOperands: assert property (@(posedge CLK) 
+        ((Stall_E && !Flush_E && !RST) |-> ##1 (REG_R_Data1_E == $past(SrcA_Reg_E) && REG_R_Data2_E == $past(SrcB_Reg_E))))
+        else $error("Error: Register did not capture forwarded operands, expected REG_R_Data1_E %h REG_R_Data2_E %h but got REG_R_Data1_E %h REG_R_Data2_E %h", 
+            $sampled($past(SrcA_Reg_E)), $sampled($past(SrcB_Reg_E)), $sampled(REG_R_Data1_E), $sampled(REG_R_Data2_E));
+
+    assertRegisterHoldsForwarding: assert property (@(posedge CLK) 
+        ((Stall_E && !Flush_E && !RST) |-> ##1 (FWD_SrcA_E == (($past(FWD_SrcA_E) == FWD_WB && $past(Stall_W)) ? FWD_WB : FWD_NONE))))
+        else $error("Error: Held forwarding select only kept for a waiting load in writeback, got FWD_SrcA_E %h", $sampled(FWD_SrcA_E));
+
     // --------------------------------------------------------
 
     // Assert register passes data through when supposed to (control signals low)
     assertRegisterPassesEnables: assert property (@(posedge CLK) 
-        ((!Flush_E && !RST) |-> ##1 (REG_W_En_E == $past(REG_W_En_D) && MEM_W_En_E == $past(MEM_W_En_D) && Jump_En_E == $past(Jump_En_D) && Branch_En_E == $past(Branch_En_D))))
+        ((!Flush_E && !Stall_E && !RST) |-> ##1 (REG_W_En_E == $past(REG_W_En_D) && MEM_W_En_E == $past(MEM_W_En_D) && Jump_En_E == $past(Jump_En_D) && Branch_En_E == $past(Branch_En_D))))
         else $error("Error: Register did not pass data correctly, expected enable signals to be REG_W_En_E %h MEM_W_En_E %h Jump_En_E %h Branch_En_E %h but got REG_W_En_E %h MEM_W_En_E %h Jump_En_E %h Branch_En_E %h", 
             $sampled($past(REG_W_En_D)), $sampled($past(MEM_W_En_D)), $sampled($past(Jump_En_D)), $sampled($past(Branch_En_D)), $sampled(REG_W_En_E), $sampled(MEM_W_En_E), $sampled(Jump_En_E), $sampled(Branch_En_E));
 
     assertRegisterPassesControls: assert property (@(posedge CLK) 
-        ((!Flush_E && !RST) |-> ##1 (MEM_Control_E == $past(MEM_Control_D) && ALU_Control_E == $past(ALU_Control_D))))
+        ((!Flush_E && !Stall_E && !RST) |-> ##1 (MEM_Control_E == $past(MEM_Control_D) && ALU_Control_E == $past(ALU_Control_D))))
         else $error("Error: Register did not pass data correctly, expected control signals to be MEM_Control_E %h ALU_Control_E %h but got MEM_Control_E %h ALU_Control_E %h", 
             $sampled($past(MEM_Control_D)), $sampled($past(ALU_Control_D)), $sampled(MEM_Control_E), $sampled(ALU_Control_E));
 
     assertRegisterPassesSelects: assert property (@(posedge CLK) 
-        ((!Flush_E && !RST) |-> ##1 (Branch_Src_Sel_E == $past(Branch_Src_Sel_D) && ALU_SrcA_Sel_E == $past(ALU_SrcA_Sel_D) && ALU_SrcB_Sel_E == $past(ALU_SrcB_Sel_D) && Result_Src_Sel_E == $past(Result_Src_Sel_D))))
+        ((!Flush_E && !Stall_E && !RST) |-> ##1 (Branch_Src_Sel_E == $past(Branch_Src_Sel_D) && ALU_SrcA_Sel_E == $past(ALU_SrcA_Sel_D) && ALU_SrcB_Sel_E == $past(ALU_SrcB_Sel_D) && Result_Src_Sel_E == $past(Result_Src_Sel_D))))
         else $error("Error: Register did not pass data correctly, expected select signals to be Branch_Src_Sel_E %h ALU_SrcA_Sel_E %h ALU_SrcB_Sel_E %h Result_Src_Sel_E %h but got Branch_Src_Sel_E %h ALU_SrcA_Sel_E %h ALU_SrcB_Sel_E %h Result_Src_Sel_E %h", 
             $sampled($past(Branch_Src_Sel_D)), $sampled($past(ALU_SrcA_Sel_D)), $sampled($past(ALU_SrcB_Sel_D)), $sampled($past(Result_Src_Sel_D)), $sampled(Branch_Src_Sel_E), $sampled(ALU_SrcA_Sel_E), $sampled(ALU_SrcB_Sel_E), $sampled(Result_Src_Sel_E));
 
     assertRegisterPassesRegisterData: assert property (@(posedge CLK) 
-        ((!Flush_E && !RST) |-> ##1 (RD_E == $past(RD_D) && RS1_E == $past(RS1_D) && RS2_E == $past(RS2_D) && REG_R_Data1_E == $past(REG_R_Data1_D) && REG_R_Data2_E == $past(REG_R_Data2_D))))
+        ((!Flush_E && !Stall_E && !RST) |-> ##1 (RD_E == $past(RD_D) && RS1_E == $past(RS1_D) && RS2_E == $past(RS2_D) && REG_R_Data1_E == $past(REG_R_Data1_D) && REG_R_Data2_E == $past(REG_R_Data2_D))))
         else $error("Error: Register did not pass data correctly, expected register data signals to be RD_E %h RS1_E %h RS2_E %h REG_R_Data1_E %h REG_R_Data2_E %h but got RD_E %h RS1_E %h RS2_E %h REG_R_Data1_E %h REG_R_Data2_E %h", 
             $sampled($past(RD_D)), $sampled($past(RS1_D)), $sampled($past(RS2_D)), $sampled($past(REG_R_Data1_D)), $sampled($past(REG_R_Data2_D)), $sampled(RD_E), $sampled(RS1_E), $sampled(RS2_E), $sampled(REG_R_Data1_E), $sampled(REG_R_Data2_E));
 
+    assertRegisterPassesForwarding: assert property (@(posedge CLK) 
+        ((!Flush_E && !Stall_E && !RST) |-> ##1 (FWD_SrcA_E == $past(FWD_SrcA_D) && FWD_SrcB_E == $past(FWD_SrcB_D))))
+        else $error("Error: Register did not pass data correctly, expected FWD_SrcA_E %h FWD_SrcB_E %h but got FWD_SrcA_E %h FWD_SrcB_E %h", 
+            $sampled($past(FWD_SrcA_D)), $sampled($past(FWD_SrcB_D)), $sampled(FWD_SrcA_E), $sampled(FWD_SrcB_E));
+
     assertRegisterPassesOther: assert property (@(posedge CLK)
-        ((!Flush_E && !RST) |-> ##1 (Imm_Ext_E == $past(Imm_Ext_D) && PC_E == $past(PC_D) && PC_Plus_4_E == $past(PC_Plus_4_D) && Predict_Taken_E == $past(Predict_Taken_D) && Valid_E == $past(Valid_D))))
+        ((!Flush_E && !Stall_E && !RST) |-> ##1 (Imm_Ext_E == $past(Imm_Ext_D) && PC_E == $past(PC_D) && PC_Plus_4_E == $past(PC_Plus_4_D) && Predict_Taken_E == $past(Predict_Taken_D) && Valid_E == $past(Valid_D))))
         else $error("Error: Register did not pass data correctly, expected signals to be Imm_Ext_E %h, PC_E %h, PC_Plus_4_E %h Predict_Taken %h Valid_D %h but got Imm_Ext_E %h, PC_E %h, PC_Plus_4_E %h Predict_Taken %h Valid_D %h", 
             $sampled($past(Imm_Ext_D)), $sampled($past(PC_D)), $sampled($past(PC_Plus_4_D)), $sampled($past(Predict_Taken_D)), $sampled($past(Valid_D)), $sampled(Imm_Ext_E), $sampled(PC_E), $sampled(PC_Plus_4_E), $sampled(Predict_Taken_E), $sampled(Valid_E));
 
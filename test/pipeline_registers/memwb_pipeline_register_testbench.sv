@@ -3,14 +3,14 @@
 // Module: Memory to Writeback Pipeline Register Testbench                                                  
 // Description: Tests that the pipeline register responds to control signals correctly and passes data through.
 // Author: Luke Shepherd                                                     
-// Date Modified: February 2025                                                                                                                                                                                                                                            
+// Date Modified: October 2026                                                                                                                                                                                                                                            
 //////////////////////////////////////////////////////////////////////////////////
 
 import definitions::*;
 
 module memwb_pipeline_register_testbench ();
     // Global control signals
-    logic CLK, RST;
+    logic CLK, RST, Flush_W, Stall_W;
 
     // Input signals
     logic REG_W_En_M; 
@@ -32,6 +32,8 @@ module memwb_pipeline_register_testbench ();
         // Global control signals
         .CLK(CLK),
         .RST(RST),
+        .Flush_W(Flush_W),
+        .Stall_W(Stall_W),
 
         // Inputs
         .REG_W_En_M(REG_W_En_M),
@@ -56,6 +58,8 @@ module memwb_pipeline_register_testbench ();
     initial begin
         // Initialize basic signals with reset
         RST <= 1;
+        Flush_W <= 0;
+        Stall_W <= 0;
         @(posedge CLK);
         RST <= 0;
 
@@ -65,6 +69,18 @@ module memwb_pipeline_register_testbench ();
         @(posedge CLK);
         RST <= 0;
 
+        // Test flush
+        operate(5);
+        Flush_W <= 1;
+        @(posedge CLK);
+        Flush_W <= 0;
+
+        // Test stall
+        operate(5);
+        Stall_W <= 1;
+        operate(3);
+        Stall_W <= 0;
+
         // Test normal operation and then end
         operate(5);
         $stop;
@@ -88,14 +104,25 @@ module memwb_pipeline_register_testbench ();
         ((RST == 1) |-> ##1 (REG_W_En_W == 1'b0)))
         else $error("Error: Register did not reset correctly, expected REG_W_En_W to be zero but got %h", $sampled(REG_W_En_W));
 
+    // Assert enables are cleared when a bubble is sent into writeback
+    assertRegisterFlushEnables: assert property (@(posedge CLK) 
+        ((Flush_W && !RST) |-> ##1 (REG_W_En_W == 1'b0)))
+        else $error("Error: Register did not flush correctly, expected REG_W_En_W to be zero but got %h", $sampled(REG_W_En_W));
+
+    // Assert register holds its contents when stalled
+    assertRegisterHolds: assert property (@(posedge CLK) 
+        ((Stall_W && !Flush_W && !RST) |-> ##1 (REG_W_En_W == $past(REG_W_En_W) && Result_Src_Sel_W == $past(Result_Src_Sel_W) && RD_W == $past(RD_W) && ALU_Out_W == $past(ALU_Out_W) && PC_Plus_4_W == $past(PC_Plus_4_W))))
+        else $error("Error: Register did not hold during stall, got REG_W_En_W %h Result_Src_Sel_W %h RD_W %h ALU_Out_W %h PC_Plus_4_W %h", 
+            $sampled(REG_W_En_W), $sampled(Result_Src_Sel_W), $sampled(RD_W), $sampled(ALU_Out_W), $sampled(PC_Plus_4_W));
+
     // Assert register passes enables and data correctly
     assertRegisterPassesEnables: assert property (@(posedge CLK)
-        ((RST == 0) |-> ##1 (REG_W_En_W == $past(REG_W_En_M))))
+        ((RST == 0 && !Flush_W && !Stall_W) |-> ##1 (REG_W_En_W == $past(REG_W_En_M))))
         else $error("Error: Register did not pass data correctly, expected REG_W_En_W to be %h but got REG_W_En_W %h", 
             $sampled($past(REG_W_En_M)), $sampled(REG_W_En_W));
 
     assertRegisterPassesOther: assert property (@(posedge CLK)
-        ((RST == 0) |-> ##1 (Result_Src_Sel_W == $past(Result_Src_Sel_M) && RD_W == $past(RD_M) && MEM_Out_W == MEM_Out_M && ALU_Out_W == $past(ALU_Out_M) && PC_Plus_4_W == $past(PC_Plus_4_M))))
+        ((RST == 0 && !Flush_W && !Stall_W) |-> ##1 (Result_Src_Sel_W == $past(Result_Src_Sel_M) && RD_W == $past(RD_M) && MEM_Out_W == MEM_Out_M && ALU_Out_W == $past(ALU_Out_M) && PC_Plus_4_W == $past(PC_Plus_4_M))))
         else $error("Error: Register did not pass data correctly, expected Result_Src_Sel_W %h RD_W %h MEM_Out_W %h ALU_Out_W %h PC_Plus_4_W %h but got Result_Src_Sel_W %h RD_W %h MEM_Out_W %h ALU_Out_W %h PC_Plus_4_W %h", 
             $sampled($past(Result_Src_Sel_M)), $sampled($past(RD_M)), $sampled(MEM_Out_M), $sampled($past(ALU_Out_M)), $sampled($past(PC_Plus_4_M)),
             $sampled(Result_Src_Sel_W), $sampled(RD_W), $sampled(MEM_Out_W), $sampled(ALU_Out_W), $sampled(PC_Plus_4_W)); 
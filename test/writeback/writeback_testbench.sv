@@ -1,9 +1,11 @@
 //////////////////////////////////////////////////////////////////////////////////                                                           
 // Third Year Project: RISC-V RV32i Pipelined Processor
 // File: Writeback Testbench                                                   
-// Description: This is a testbench to ensure that the Writeback multiplexer selects the correct result to write to the register file.
+// Description: This is a testbench to ensure that the Writeback multiplexer selects the correct result to write to the register file,
+//              and that a finished divide or FP divide only takes the write port when writeback leaves it free,
+//              with a missed load's result after both.
 // Author: Luke Shepherd                                                     
-// Date Created: February 2025                                                                                                                                                                                                                                                      
+// Date Modified: October 2026                                                                                                                                                                                                                                                      
 //////////////////////////////////////////////////////////////////////////////////
 
 import definitions::*;
@@ -14,14 +16,41 @@ module writeback_testbench;
     logic [31:0] Data_Out_Ext;
     logic [31:0] ALU_Out;
     logic [31:0] PC_Plus_4;
+    logic [31:0] MUL_Out;
+    logic FPU_W;
+    logic [31:0] FPU_Out;
+    logic REG_W_En_W, DIV_Done, FDIV_Done, Fill_Done;
+    logic [4:0] RD_W, DIV_RD, FDIV_RD, Fill_RD;
+    logic [31:0] DIV_Out, FDIV_Out, Fill_Out;
     logic [31:0] Result;
+    logic REG_W_En, DIV_W_En, FDIV_W_En, Fill_W_En;
+    logic [4:0] REG_W_Addr;
 
     writeback wb (
         .Result_Src_Sel_W(Result_Src_Sel),
+        .REG_W_En_W(REG_W_En_W),
+        .RD_W(RD_W),
         .Data_Out_Ext_W(Data_Out_Ext),
         .ALU_Out_W(ALU_Out),
         .PC_Plus_4_W(PC_Plus_4),
-        .Result_W(Result)
+        .MUL_Out_W(MUL_Out),
+        .FPU_W(FPU_W),
+        .FPU_Out_W(FPU_Out),
+        .DIV_Done(DIV_Done),
+        .DIV_RD(DIV_RD),
+        .DIV_Out(DIV_Out),
+        .FDIV_Done(FDIV_Done),
+        .FDIV_RD(FDIV_RD),
+        .FDIV_Out(FDIV_Out),
+        .Fill_Done(Fill_Done),
+        .Fill_RD(Fill_RD),
+        .Fill_Out(Fill_Out),
+        .Result_W(Result),
+        .REG_W_En(REG_W_En),
+        .REG_W_Addr(REG_W_Addr),
+        .DIV_W_En(DIV_W_En),
+        .FDIV_W_En(FDIV_W_En),
+        .Fill_W_En(Fill_W_En)
     );
 
     initial CLK <= 1; // Initialize the clock
@@ -33,6 +62,20 @@ module writeback_testbench;
         Data_Out_Ext <= 32'h0;
         ALU_Out <= 32'h0;
         PC_Plus_4 <= 32'h0;
+        MUL_Out <= 32'h0;
+        REG_W_En_W <= 1'b1;
+        RD_W <= 5'd1;
+        DIV_Done <= 1'b0;
+        DIV_RD <= 5'd2;
+        DIV_Out <= 32'h0;
+        FPU_W <= 1'b0;
+        FPU_Out <= 32'h0;
+        FDIV_Done <= 1'b0;
+        FDIV_RD <= 5'd3;
+        FDIV_Out <= 32'h0;
+        Fill_Done <= 1'b0;
+        Fill_RD <= 5'd4;
+        Fill_Out <= 32'h0;
         @(posedge CLK);
 
         // Test ALU result
@@ -58,6 +101,90 @@ module writeback_testbench;
         PC_Plus_4 <= 32'h4444_4444;
         @(posedge CLK);
         assert (Result == 32'h4444_4444) else $error("Error: Incorrect result produced for ALU select, expected 0x44444444, got 0x%h", $sampled(Result));
+
+        // Test multiplier result
+        Result_Src_Sel <= RESULT_MUL;
+        PC_Plus_4 <= 32'h0;
+        MUL_Out <= 32'h5555_5555;
+        @(posedge CLK);
+        assert (Result == 32'h5555_5555) else $error("Error: Incorrect result produced for MUL select, expected 0x55555555, got 0x%h", $sampled(Result));
+
+        // Test an FPU pipeline result shares the multiplier's select
+        FPU_W <= 1'b1;
+        FPU_Out <= 32'h3F80_0000;
+        @(posedge CLK);
+        assert (Result == 32'h3F80_0000) else $error("Error: Incorrect result produced for FPU select, expected 0x3F800000, got 0x%h", $sampled(Result));
+        FPU_W <= 1'b0;
+
+        // Test a finished divide waits while writeback is writing
+        DIV_Done <= 1'b1;
+        DIV_Out <= 32'h6666_6666;
+        @(posedge CLK);
+        check_port(1'b1, 5'd1, 32'h5555_5555, 1'b0);
+
+        // Test a finished divide takes the free write port
+        REG_W_En_W <= 1'b0;
+        @(posedge CLK);
+        check_port(1'b1, 5'd2, 32'h6666_6666, 1'b1);
+
+        // Test nothing is written when neither needs the port
+        DIV_Done <= 1'b0;
+        @(posedge CLK);
+        check_port(1'b0, 5'd1, 32'h5555_5555, 1'b0);
+
+        // Test a finished FP divide waits while writeback is writing then takes the free port
+        REG_W_En_W <= 1'b1;
+        FDIV_Done <= 1'b1;
+        FDIV_Out <= 32'h4049_0FDB;
+        @(posedge CLK);
+        check_port(1'b1, 5'd1, 32'h5555_5555, 1'b0);
+        assert (!FDIV_W_En) else $error("Error: FP divide took the write port from writeback");
+        REG_W_En_W <= 1'b0;
+        @(posedge CLK);
+        check_port(1'b1, 5'd3, 32'h4049_0FDB, 1'b0);
+        assert (FDIV_W_En) else $error("Error: FP divide didn't take the free write port");
+
+        // Test the integer divide goes first if both are ever done together
+        DIV_Done <= 1'b1;
+        @(posedge CLK);
+        check_port(1'b1, 5'd2, 32'h6666_6666, 1'b1);
+        assert (!FDIV_W_En) else $error("Error: FP divide and divide both took the write port");
+        DIV_Done <= 1'b0;
+        FDIV_Done <= 1'b0;
+
+        // Test a missed load's result waits while writeback is writing then takes the free port
+        REG_W_En_W <= 1'b1;
+        Fill_Done <= 1'b1;
+        Fill_Out <= 32'h7777_7777;
+        @(posedge CLK);
+        check_port(1'b1, 5'd1, 32'h5555_5555, 1'b0);
+        assert (!Fill_W_En) else $error("Error: Missed load took the write port from writeback");
+        REG_W_En_W <= 1'b0;
+        @(posedge CLK);
+        check_port(1'b1, 5'd4, 32'h7777_7777, 1'b0);
+        assert (Fill_W_En) else $error("Error: Missed load didn't take the free write port");
+
+        // Test a finished divide goes before a missed load
+        DIV_Done <= 1'b1;
+        @(posedge CLK);
+        check_port(1'b1, 5'd2, 32'h6666_6666, 1'b1);
+        assert (!Fill_W_En) else $error("Error: Missed load and divide both took the write port");
+        DIV_Done <= 1'b0;
+        Fill_Done <= 1'b0;
         $stop;
     end
+
+    task check_port(
+        input logic expected_REG_W_En,
+        input logic [4:0] expected_REG_W_Addr,
+        input logic [31:0] expected_Result,
+        input logic expected_DIV_W_En
+    );
+    begin
+        assert (REG_W_En == expected_REG_W_En) else $error("Error: Incorrect REG_W_En, expected %b, got %b", expected_REG_W_En, $sampled(REG_W_En));
+        assert (REG_W_Addr == expected_REG_W_Addr) else $error("Error: Incorrect REG_W_Addr, expected %0d, got %0d", expected_REG_W_Addr, $sampled(REG_W_Addr));
+        assert (Result == expected_Result) else $error("Error: Incorrect Result, expected 0x%h, got 0x%h", expected_Result, $sampled(Result));
+        assert (DIV_W_En == expected_DIV_W_En) else $error("Error: Incorrect DIV_W_En, expected %b, got %b", expected_DIV_W_En, $sampled(DIV_W_En));
+    end
+    endtask
 endmodule
\ No newline at end of file
@@ -0,0 +1,82 @@
+; Branch loops versus hardware loops benchmark
+; Kernel: a 4-tap FIR filter y[i] = h[0]x[i] + h[1]x[i+1] + h[2]x[i+2] + h[3]x[i+3]
+; over pseudo-random samples, summing the outputs as a checksum.
+; Run with the core testbench, which prints the cycle count at each EBREAK
+; checkpoint. The first pair brackets the branch loop kernel, the second pair
+; the hardware loop kernel. Both run the same body so the difference is the
+; loop overhead: the counter updates, the branches and the mispredict each time
+; the inner loop exits, against one refetch per inner loop setup.
+
+COUNT		equ	64			; Outputs
+TAPS		equ	4
+SEED		equ	0x2545F491
+SAMPLES		equ	0x800			; Clear of the program
+
+		org	0
+
+		li	x10, SEED		; Fill the samples from a xorshift32
+		li	x11, SAMPLES
+		li	x12, COUNT + TAPS - 1
+fill		slli	x5, x10, 13
+		xor	x10, x10, x5
+		srli	x5, x10, 17
+		xor	x10, x10, x5
+		slli	x5, x10, 5
+		xor	x10, x10, x5
+		andi	x5, x10, 0xFF		; Keep the products small
+		sw	x5, [x11]
+		addi	x11, x11, 4
+		addi	x12, x12, -1
+		bgtz	x12, fill
+
+		li	x10, COUNT		; Outputs left
+		li	x11, SAMPLES		; &x[i]
+		li	x13, 0			; Checksum
+		ebreak				; Checkpoint: branch loop kernel starts
+
+branch_outer	mv	x14, x11		; &x[i+k]
+		la	x15, taps		; &h[k]
+		li	x16, TAPS		; Taps left
+		li	x17, 0			; y[i]
+branch_inner	lw	x5, [x14]
+		lw	x6, [x15]
+		mul	x5, x5, x6
+		add	x17, x17, x5
+		addi	x14, x14, 4
+		addi	x15, x15, 4
+		addi	x16, x16, -1
+		bgtz	x16, branch_inner	; Mispredicts on the way out
+		add	x13, x13, x17
+		addi	x11, x11, 4
+		addi	x10, x10, -1
+		bgtz	x10, branch_outer
+		ebreak				; Checkpoint: branch loop kernel done
+
+		mv	x18, x13		; Keep the branch loop sum to compare
+		li	x10, COUNT
+		li	x11, SAMPLES
+		li	x13, 0
+		ebreak				; Checkpoint: hardware loop kernel starts
+
+		lp.setup 1, x10, hw_outer_end	; Outer loop, COUNT times
+		mv	x14, x11
+		la	x15, taps
+		li	x17, 0
+		lp.setupi 0, TAPS, hw_inner_end	; Inner loop, TAPS times
+		lw	x5, [x14]
+		lw	x6, [x15]
+		mul	x5, x5, x6
+		add	x17, x17, x5
+		addi	x14, x14, 4
+		addi	x15, x15, 4		; Fetch goes straight back to the LW
+hw_inner_end	add	x13, x13, x17
+		addi	x11, x11, 4		; Fetch goes straight back to the MV
+hw_outer_end	ebreak				; Checkpoint: hardware loop kernel done
+
+		bne	x13, x18, broken	; Both kernels must agree
+stop		j	stop
+
+broken		j	broken
+
+		align
+taps		defw	3, -1, 4, 2
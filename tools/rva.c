@@ -95,6 +95,7 @@
 #define SYM_ADRL_PC           0x2900
 #define SYM_ERR_NO_SHFT       0x2A00
 #define SYM_NO_REG_HASH       0x2B00
+#define SYM_BAD_ROUNDING      0x2C00
 #define SYM_ERR_BROKEN        0xFF00                  /* TEMP uncommitted @@@ */
 
 /* evaluate return error states */
@@ -304,6 +305,7 @@ unsigned int variable_item_size(int, unsigned int);
 
 int          get_thing(char*, unsigned int*, sym_table*);
 int          get_reg(char*, unsigned int*);
+unsigned int get_rounding(char*, unsigned int*, unsigned int*);
 
 void         redefine_symbol(char*, sym_record*, sym_table*);
 void         assemble_redef_label(unsigned int,  int, own_label*,
@@ -442,6 +444,7 @@ sym_table        *arch_table;    /* Table of possible processor architectures */
 sym_table    *operator_table;
 sym_table    *register_table;
 sym_table       *shift_table;
+sym_table    *rounding_table;
 sym_table         *csr_table;
 
 /*----------------------------------------------------------------------------*/
@@ -615,6 +618,13 @@ if (set_options(argc, argv))/* Parse command line and set options accordingly */
   shift_table = build_table("Shifts",SYM_TAB_CASE_FLAG,shift_name,shift_value);
   }
 
+  {                                      /* Floating point rounding modes (F) */
+  char *rounding_name[] = {"rne", "rtz", "rdn", "rup", "rmm", "dyn",    ""};
+  int  rounding_value[] = {    0,     1,     2,     3,     4,     7,    -1};
+  rounding_table = build_table("Rounding", SYM_TAB_CASE_FLAG,
+                                rounding_name, rounding_value);
+  }
+
   rv32i_mnemonic_table = sym_create_table("RV32 Mnemonics", SYM_TAB_CASE_FLAG);
 //csr_table            = sym_create_table("CSR Addresses",  SYM_TAB_CASE_FLAG);
   csr_table            = sym_create_table("CSR Addresses",  0);
@@ -864,6 +874,7 @@ printf("Symbol name [%s]\n", symbols_file_name);
     sym_delete_table(      operator_table, FALSE);
     sym_delete_table(      register_table, FALSE);
     sym_delete_table(         shift_table, FALSE);
+    sym_delete_table(      rounding_table, FALSE);
     }
   }
 else
@@ -1087,6 +1098,7 @@ switch (error_code & 0xFFFFFF00)
   case SYM_ADRL_PC:        printf("Only ADR allowed with destination PC");break;
   case SYM_ERR_NO_SHFT:     printf("Shift operator expected");            break;
   case SYM_NO_REG_HASH:     printf("'#' or register expected");           break;
+  case SYM_BAD_ROUNDING:    printf("Rounding mode expected");             break;
   case eval_no_operand:     printf("Operand expected");                   break;
   case eval_no_operator:    printf("Operator expected");                  break;
   case eval_not_closebr:    printf("Missing ')'");                        break;
@@ -1890,6 +1902,9 @@ if (if_stack[if_SP])
             else
               error_code = SYM_BAD_REG | position;
             }
+
+          if (error_code == eval_okay)             /* Optional rounding mode */
+            error_code = get_rounding(line, &position, &op_code);
           break;
 
 
@@ -2266,7 +2281,156 @@ if (if_stack[if_SP])
           break;
 
 
-        default:  
+        case 0x000D0000:                                /* Unary, rd, rs1 */
+          op_code = ((token & 0x00007F00) << 17)                 /* func7 */
+                  | ((token & 0x0000003E) << 19)            /* Fixed rs2 */
+                  | ((token & 0x01F00000) >> 18)
+                  | ((token & 0x0E000000) >> 13) | 0x00000003;
+          if ((reg = get_reg(line, &position)) >= 0)              /* Parse rd */
+            {
+            op_code = op_code | (reg << 7);
+            if (!cmp_next_non_space(line, &position, 0, ','))
+              error_code = SYM_NO_COMMA | position;
+            }
+          else
+            error_code = SYM_BAD_REG | position;
+
+          if (error_code == eval_okay)                           /* Parse rs1 */
+            {
+            if ((reg = get_reg(line, &position)) >= 0)
+              op_code = op_code | (reg << 15);
+            else
+              error_code = SYM_BAD_REG | position;
+            }
+
+          if (error_code == eval_okay)             /* Optional rounding mode */
+            error_code = get_rounding(line, &position, &op_code);
+          break;
+
+
+        case 0x000E0000:     /* Raw R-type, opcode, func3, func7, rd, rs1, rs2 */
+          {
+          unsigned int limit[3] = {0x7F, 0x07, 0x7F};
+          unsigned int field[3] = {0, 0, 0};
+          int i;
+
+          op_code = 0;
+          for (i = 0; (i < 3) && (error_code == eval_okay); i++)
+            {
+            error_code = evaluate(line, &position, &value, symbol_table);
+            if (allow_error(error_code, first_pass, last_pass))
+              error_code = eval_okay;
+            if (error_code == eval_okay)
+              {
+              if ((value & ~limit[i]) != 0)                /* Not valid value */
+                error_code = SYM_OORANGE;
+              else
+                {
+                field[i] = value;
+                if (!cmp_next_non_space(line, &position, 0, ','))
+                  error_code = SYM_NO_COMMA | position;
+                }
+              }
+            }
+          if ((error_code == eval_okay) && ((field[0] & 3) != 3))
+            error_code = SYM_OORANGE;          /* Compressed opcodes not here */
+          op_code = field[0] | (field[1] << 12) | (field[2] << 25);
+
+          for (i = 0; (i < 3) && (error_code == eval_okay); i++)
+            {                                        /* Parse rd, rs1, rs2 */
+            if ((reg = get_reg(line, &position)) >= 0)
+              {
+              op_code = op_code | (reg << ((i == 0) ? 7 : (i == 1) ? 15 : 20));
+              if ((i < 2) && !cmp_next_non_space(line, &position, 0, ','))
+                error_code = SYM_NO_COMMA | position;
+              }
+            else
+              error_code = SYM_BAD_REG | position;
+            }
+          }
+          break;
+
+
+        case 0x000F0000:        /* Hardware loop, L then count and/or label */
+          {                          /* func3: 0 starti, 1 endi, 2 count, */
+          unsigned int form;         /*  3 counti, 4 setup, 5 setupi      */
+
+          form = (token & 0x0E000000) >> 25;
+          op_code = ((token & 0x01F00000) >> 18)
+                  | ((token & 0x0E000000) >> 13) | 0x00000003;
+
+          error_code = evaluate(line, &position, &value, symbol_table);
+          if (allow_error(error_code, first_pass, last_pass))   /* Loop, L */
+            error_code = eval_okay;
+          if (error_code == eval_okay)
+            {
+            if ((value & 0xFFFFFFFE) != 0)
+              error_code = SYM_OORANGE;
+            else
+              {
+              op_code = op_code | (value << 7);
+              if (!cmp_next_non_space(line, &position, 0, ','))
+                error_code = SYM_NO_COMMA | position;
+              }
+            }
+
+          if ((error_code == eval_okay) && ((form == 2) || (form == 4)))
+            {                                            /* Count from rs1 */
+            if ((reg = get_reg(line, &position)) >= 0)
+              {
+              op_code = op_code | (reg << 15);
+              if ((form == 4) && !cmp_next_non_space(line, &position, 0, ','))
+                error_code = SYM_NO_COMMA | position;
+              }
+            else
+              error_code = SYM_BAD_REG | position;
+            }
+
+          if ((error_code == eval_okay) && ((form == 3) || (form == 5)))
+            {                                     /* Count as an immediate */
+            error_code = evaluate(line, &position, &value, symbol_table);
+            if (allow_error(error_code, first_pass, last_pass))
+              error_code = eval_okay;
+            if (error_code == eval_okay)
+              {
+              if ((value & 0xFFFFF000) != 0)
+                error_code = SYM_OORANGE;
+              else
+                {
+                op_code = op_code | (value << 20);
+                if ((form == 5) && !cmp_next_non_space(line, &position, 0, ','))
+                  error_code = SYM_NO_COMMA | position;
+                }
+              }
+            }
+
+          if ((error_code == eval_okay) && (form != 2) && (form != 3))
+            {                       /* Label, byte offset from this address */
+            error_code = evaluate(line, &position, &value, symbol_table);
+            if (allow_error(error_code, first_pass, last_pass))
+              error_code = eval_okay;
+            value = value - assembly_pointer;
+            if ((value & 3) != 0)
+              error_code = SYM_UNALIGNED_BRANCH;
+            else if (form == 5)           /* Short forward offset in words */
+              {
+              if ((value != 0) && ((value & 0xFFFFFF83) == 0))
+                op_code = op_code | (value << 13);
+              else error_code = SYM_OORANGE_BRANCH;
+              }
+            else
+              {
+              if (((value & 0xFFFFF800) == 0x00000000)
+               || ((value & 0xFFFFF800) == 0xFFFFF800))
+                op_code = op_code | ((value & 0x00000FFF) << 20);
+              else error_code = SYM_OORANGE_BRANCH;
+              }
+            }
+          }
+          break;
+
+
+        default:
           printf("Unprocessable opcode!\n");
           break;
         }
@@ -2745,6 +2909,25 @@ return result;
 int get_reg(char *line, unsigned int *pos)	/* Expand into code? @@@@ */
 { return get_thing(line, pos, register_table); }
 
+/* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -*/
+/* Floating point instructions which round take an optional ", rm" which      */
+/* replaces func3; without one the mnemonic's dynamic mode is kept.           */
+
+unsigned int get_rounding(char *line, unsigned int *pos, unsigned int *op_code)
+{
+int rm;
+
+if (((*op_code & 0x0000707F) != 0x00007053)           /* OP-FP with func3 dyn */
+ || !cmp_next_non_space(line, pos, 0, ','))
+  return eval_okay;
+
+if ((rm = get_thing(line, pos, rounding_table)) < 0)
+  return SYM_BAD_ROUNDING | *pos;
+
+*op_code = (*op_code & ~0x00007000) | (rm << 12);
+return eval_okay;
+}
+
 /*----------------------------------------------------------------------------*/
 
 unsigned int imm_jal(unsigned int value)
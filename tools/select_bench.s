@@ -0,0 +1,58 @@
+; Branchy versus branchless select benchmark
+; Kernel: if (x & 1) a = x; sum += a; over pseudo-random x from a xorshift32
+; generator so the branch can't be predicted.
+; Run with the core testbench, which prints the cycle count at each EBREAK
+; checkpoint. The first pair brackets the branchy kernel, the second pair the
+; branchless Zicond kernel.
+
+COUNT		equ	256
+SEED		equ	0x2545F491
+
+		org	0
+
+		li	x10, SEED		; x
+		li	x11, COUNT		; Iterations left
+		li	x12, 0			; a
+		li	x13, 0			; sum
+		ebreak				; Checkpoint: branchy kernel starts
+
+branchy		slli	x5, x10, 13		; xorshift32
+		xor	x10, x10, x5
+		srli	x5, x10, 17
+		xor	x10, x10, x5
+		slli	x5, x10, 5
+		xor	x10, x10, x5
+		andi	x6, x10, 1
+		beqz	x6, keep		; Random so mispredicts about half the time
+		mv	x12, x10
+keep		add	x13, x13, x12
+		addi	x11, x11, -1
+		bgtz	x11, branchy
+		ebreak				; Checkpoint: branchy kernel done
+
+		mv	x14, x13		; Keep the branchy sum to compare
+		li	x10, SEED
+		li	x11, COUNT
+		li	x12, 0
+		li	x13, 0
+		ebreak				; Checkpoint: branchless kernel starts
+
+branchless	slli	x5, x10, 13
+		xor	x10, x10, x5
+		srli	x5, x10, 17
+		xor	x10, x10, x5
+		slli	x5, x10, 5
+		xor	x10, x10, x5
+		andi	x6, x10, 1
+		czero.eqz x7, x10, x6		; x7 := x6 ? x : 0
+		czero.nez x12, x12, x6		; a := x6 ? 0 : a
+		or	x12, x12, x7		; Only one side can be non-zero
+		add	x13, x13, x12
+		addi	x11, x11, -1
+		bgtz	x11, branchless
+		ebreak				; Checkpoint: branchless kernel done
+
+		bne	x13, x14, broken	; Both kernels must agree
+stop		j	stop
+
+broken		j	broken
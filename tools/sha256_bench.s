@@ -0,0 +1,292 @@
+; SHA-256 benchmark, RV32I shifts against the Zknh sigma and sum instructions
+; Kernel: one SHA-256 block compression of the padded message 'abc', checked
+; against the standard digest BA7816BF...F20015AD.
+; Run with the core testbench, which prints the cycle count at each EBREAK
+; checkpoint. The first pair brackets the RV32I kernel, the second pair the
+; Zknh kernel. Each kernel hashes one 64-byte block so cycles per byte is the
+; difference between a pair of checkpoints divided by 64.
+
+HASH		equ	0xC00			; Hash state
+W		equ	0xC20			; Message schedule, the block is copied to W[0..15]
+
+		org	0
+
+		ebreak			; Checkpoint: RV32I kernel starts
+base_start	; Copy the initial hash and the message block into place
+		la	x20, h_init
+		li	x21, HASH
+		li	x22, 24		; 8 hash words then 16 message words
+base_copy	lw	x5, [x20]
+		sw	x5, [x21]
+		addi	x20, x20, 4
+		addi	x21, x21, 4
+		addi	x22, x22, -1
+		bgtz	x22, base_copy
+
+		; Message schedule, W[t] = sig1(W[t-2]) + W[t-7] + sig0(W[t-15]) + W[t-16]
+		li	x20, W + 64	; &W[16]
+		li	x22, W + 256	; &W[64]
+base_sched	lw	x5, -8[x20]	; W[t-2]
+		srli	x6, x5, 17
+		slli	x7, x5, 15
+		or	x6, x6, x7
+		srli	x28, x5, 19
+		slli	x7, x5, 13
+		or	x28, x28, x7
+		xor	x6, x6, x28
+		srli	x28, x5, 10
+		xor	x6, x6, x28	; sig1
+		lw	x5, -60[x20]	; W[t-15]
+		srli	x7, x5, 7
+		slli	x28, x5, 25
+		or	x7, x7, x28
+		srli	x29, x5, 18
+		slli	x28, x5, 14
+		or	x29, x29, x28
+		xor	x7, x7, x29
+		srli	x29, x5, 3
+		xor	x7, x7, x29	; sig0
+		lw	x28, -28[x20]	; W[t-7]
+		lw	x29, -64[x20]	; W[t-16]
+		add	x6, x6, x7
+		add	x6, x6, x28
+		add	x6, x6, x29
+		sw	x6, [x20]
+		addi	x20, x20, 4
+		bne	x20, x22, base_sched
+
+		; 64 rounds with a..h in x10..x17
+		li	x23, HASH
+		lw	x10, [x23]
+		lw	x11, 4[x23]
+		lw	x12, 8[x23]
+		lw	x13, 12[x23]
+		lw	x14, 16[x23]
+		lw	x15, 20[x23]
+		lw	x16, 24[x23]
+		lw	x17, 28[x23]
+		li	x20, W
+		la	x21, k_table
+base_round	srli	x5, x14, 6	; Sum1(e)
+		slli	x6, x14, 26
+		or	x5, x5, x6
+		srli	x6, x14, 11
+		slli	x7, x14, 21
+		or	x6, x6, x7
+		xor	x5, x5, x6
+		srli	x6, x14, 25
+		slli	x7, x14, 7
+		or	x6, x6, x7
+		xor	x5, x5, x6
+		xor	x6, x15, x16	; Ch(e, f, g)
+		and	x6, x6, x14
+		xor	x6, x6, x16
+		add	x5, x5, x6
+		add	x5, x5, x17
+		lw	x6, [x21]	; K[t]
+		lw	x7, [x20]	; W[t]
+		add	x5, x5, x6
+		add	x5, x5, x7	; T1
+		srli	x6, x10, 2
+		slli	x7, x10, 30
+		or	x6, x6, x7
+		srli	x7, x10, 13
+		slli	x28, x10, 19
+		or	x7, x7, x28
+		xor	x6, x6, x7
+		srli	x7, x10, 22
+		slli	x28, x10, 10
+		or	x7, x7, x28
+		xor	x6, x6, x7	; Sum0(a)
+		or	x7, x10, x11	; Maj(a, b, c)
+		and	x7, x7, x12
+		and	x28, x10, x11
+		or	x7, x7, x28
+		add	x6, x6, x7	; T2
+		mv	x17, x16
+		mv	x16, x15
+		mv	x15, x14
+		add	x14, x13, x5
+		mv	x13, x12
+		mv	x12, x11
+		mv	x11, x10
+		add	x10, x5, x6
+		addi	x20, x20, 4
+		addi	x21, x21, 4
+		bne	x20, x22, base_round
+
+		; Add the working variables into the hash
+		lw	x5, [x23]
+		add	x5, x5, x10
+		sw	x5, [x23]
+		lw	x5, 4[x23]
+		add	x5, x5, x11
+		sw	x5, 4[x23]
+		lw	x5, 8[x23]
+		add	x5, x5, x12
+		sw	x5, 8[x23]
+		lw	x5, 12[x23]
+		add	x5, x5, x13
+		sw	x5, 12[x23]
+		lw	x5, 16[x23]
+		add	x5, x5, x14
+		sw	x5, 16[x23]
+		lw	x5, 20[x23]
+		add	x5, x5, x15
+		sw	x5, 20[x23]
+		lw	x5, 24[x23]
+		add	x5, x5, x16
+		sw	x5, 24[x23]
+		lw	x5, 28[x23]
+		add	x5, x5, x17
+		sw	x5, 28[x23]
+		ebreak			; Checkpoint: RV32I kernel done
+
+		; Check the digest
+		la	x20, digest
+		li	x21, HASH
+		li	x22, 8
+base_check	lw	x5, [x20]
+		lw	x6, [x21]
+		bne	x5, x6, broken
+		addi	x20, x20, 4
+		addi	x21, x21, 4
+		addi	x22, x22, -1
+		bgtz	x22, base_check
+
+		ebreak			; Checkpoint: Zknh kernel starts
+zknh_start	; Copy the initial hash and the message block into place
+		la	x20, h_init
+		li	x21, HASH
+		li	x22, 24		; 8 hash words then 16 message words
+zknh_copy	lw	x5, [x20]
+		sw	x5, [x21]
+		addi	x20, x20, 4
+		addi	x21, x21, 4
+		addi	x22, x22, -1
+		bgtz	x22, zknh_copy
+
+		; Message schedule, W[t] = sig1(W[t-2]) + W[t-7] + sig0(W[t-15]) + W[t-16]
+		li	x20, W + 64	; &W[16]
+		li	x22, W + 256	; &W[64]
+zknh_sched	lw	x5, -8[x20]	; W[t-2]
+		sha256sig1 x6, x5
+		lw	x5, -60[x20]	; W[t-15]
+		sha256sig0 x7, x5
+		lw	x28, -28[x20]	; W[t-7]
+		lw	x29, -64[x20]	; W[t-16]
+		add	x6, x6, x7
+		add	x6, x6, x28
+		add	x6, x6, x29
+		sw	x6, [x20]
+		addi	x20, x20, 4
+		bne	x20, x22, zknh_sched
+
+		; 64 rounds with a..h in x10..x17
+		li	x23, HASH
+		lw	x10, [x23]
+		lw	x11, 4[x23]
+		lw	x12, 8[x23]
+		lw	x13, 12[x23]
+		lw	x14, 16[x23]
+		lw	x15, 20[x23]
+		lw	x16, 24[x23]
+		lw	x17, 28[x23]
+		li	x20, W
+		la	x21, k_table
+zknh_round	sha256sum1 x5, x14	; Sum1(e)
+		xor	x6, x15, x16	; Ch(e, f, g)
+		and	x6, x6, x14
+		xor	x6, x6, x16
+		add	x5, x5, x6
+		add	x5, x5, x17
+		lw	x6, [x21]	; K[t]
+		lw	x7, [x20]	; W[t]
+		add	x5, x5, x6
+		add	x5, x5, x7	; T1
+		sha256sum0 x6, x10	; Sum0(a)
+		or	x7, x10, x11	; Maj(a, b, c)
+		and	x7, x7, x12
+		and	x28, x10, x11
+		or	x7, x7, x28
+		add	x6, x6, x7	; T2
+		mv	x17, x16
+		mv	x16, x15
+		mv	x15, x14
+		add	x14, x13, x5
+		mv	x13, x12
+		mv	x12, x11
+		mv	x11, x10
+		add	x10, x5, x6
+		addi	x20, x20, 4
+		addi	x21, x21, 4
+		bne	x20, x22, zknh_round
+
+		; Add the working variables into the hash
+		lw	x5, [x23]
+		add	x5, x5, x10
+		sw	x5, [x23]
+		lw	x5, 4[x23]
+		add	x5, x5, x11
+		sw	x5, 4[x23]
+		lw	x5, 8[x23]
+		add	x5, x5, x12
+		sw	x5, 8[x23]
+		lw	x5, 12[x23]
+		add	x5, x5, x13
+		sw	x5, 12[x23]
+		lw	x5, 16[x23]
+		add	x5, x5, x14
+		sw	x5, 16[x23]
+		lw	x5, 20[x23]
+		add	x5, x5, x15
+		sw	x5, 20[x23]
+		lw	x5, 24[x23]
+		add	x5, x5, x16
+		sw	x5, 24[x23]
+		lw	x5, 28[x23]
+		add	x5, x5, x17
+		sw	x5, 28[x23]
+		ebreak			; Checkpoint: Zknh kernel done
+
+		; Check the digest
+		la	x20, digest
+		li	x21, HASH
+		li	x22, 8
+zknh_check	lw	x5, [x20]
+		lw	x6, [x21]
+		bne	x5, x6, broken
+		addi	x20, x20, 4
+		addi	x21, x21, 4
+		addi	x22, x22, -1
+		bgtz	x22, zknh_check
+
+stop		j	stop
+
+broken		j	broken
+
+		align	
+h_init		defw	0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A	; Initial hash, followed by the block so one loop copies both
+		defw	0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19
+block		defw	0x61626380, 0x00000000, 0x00000000, 0x00000000	; 'abc' padded to a block, big-endian words
+		defw	0x00000000, 0x00000000, 0x00000000, 0x00000000
+		defw	0x00000000, 0x00000000, 0x00000000, 0x00000000
+		defw	0x00000000, 0x00000000, 0x00000000, 0x00000018
+k_table		defw	0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5	; Round constants
+		defw	0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5
+		defw	0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3
+		defw	0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174
+		defw	0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC
+		defw	0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA
+		defw	0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7
+		defw	0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967
+		defw	0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13
+		defw	0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85
+		defw	0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3
+		defw	0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070
+		defw	0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5
+		defw	0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3
+		defw	0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208
+		defw	0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+digest		defw	0xBA7816BF, 0x8F01CFEA, 0x414140DE, 0x5DAE2223
+		defw	0xB00361A3, 0x96177A9C, 0xB410FF61, 0xF20015AD